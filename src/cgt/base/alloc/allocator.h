@@ -30,6 +30,7 @@
 #define __CGTL__CGT_BASE_ALLOC_ALLOCATOR_H_
 
 #include "cgt/base/alloc/storage.h"
+#include "cgt/base/alloc/arena.h"
 #include <stdlib.h>
 #include <malloc.h>
 
@@ -56,6 +57,11 @@ namespace cgt
        *
        * A chunk-based allocator, implementation based on the example found in
        * <b>The C++ Programming Language, 3rd Edition, by Bjarne Stroustrup, page 570</b>.
+       *
+       * An allocator created with an arena (see _Arena) takes its items from
+       * the arena instead of the static storage, and so do the allocators
+       * copied (or rebound) from it. That's how a container is bound to an
+       * arena owned by another structure.
        */
 
       template<typename _TpItem>
@@ -79,21 +85,29 @@ namespace cgt
 
             template <class _U> struct rebind { typedef _Allocator<_U> other; };
 
-            _Allocator() { };
-            _Allocator(const _Allocator&) { };
-            template <class _U> _Allocator(const _Allocator<_U>&) { };
+            _Allocator() : _arena (NULL) { };
+            explicit _Allocator(_Arena* const _a) : _arena (_a) { };
+            _Allocator(const _Allocator& _a) : _arena (_a.arena ()) { };
+            template <class _U> _Allocator(const _Allocator<_U>& _a) : _arena (_a.arena ()) { };
             ~_Allocator() { };
 
             pointer address(reference x) const { return &x; }
             const_pointer address(const_reference x) const { return &x; }
 
-            pointer allocate(size_type size, _Allocator<_TpItem>::const_pointer hint = 0) { return static_cast<pointer>(_storage.allocate ()); }
-            void deallocate(pointer p, size_type n) { _storage.deallocate (p); }
+            pointer allocate(size_type size, _Allocator<_TpItem>::const_pointer hint = 0) { return (_arena ? static_cast<pointer>(_arena->allocate (sizeof (_TpItem))) : _storage.allocate ()); }
+            void deallocate(pointer p, size_type n) { if (_arena) _arena->deallocate (p, sizeof (_TpItem)); else _storage.deallocate (p); }
             size_type max_size() const { return (size_t (-1) / sizeof (_TpItem)); }
             void construct(pointer p, const _TpItem& val) { new (static_cast<_TpItem *>(p)) _TpItem (val); }
             void destroy(pointer p) { p->~_TpItem (); }
 
+            /** the arena of the allocator, or NULL if it uses the static storage */
+            _Arena* arena () const { return _arena; }
+
+            const bool operator==(const _Allocator& _a) const { return (_arena == _a._arena); }
+            const bool operator!=(const _Allocator& _a) const { return (_arena != _a._arena); }
+
           private:
+            _Arena* _arena; /** < the arena, or NULL to use the static storage */
             static _Storage<_TpItem> _storage; /** < each allocator has its own \i static storage, that's why we need to guarantee mutual exclusion */
         };
 
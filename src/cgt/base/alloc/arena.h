@@ -0,0 +1,203 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/alloc/arena.h
+ * \brief Contains definition of an arena: a chunk-based storage owned by a single structure.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_ALLOC_ARENA_H_
+#define __CGTL__CGT_BASE_ALLOC_ARENA_H_
+
+#include <stdlib.h>
+
+#include "cgt/base/exception/mem_except.h"
+#include "cgt/misc/cxxtest_defs.h"
+
+UT_CXXTEST_DEFINE_CLASS(arena_cxx);
+
+
+namespace cgt
+{
+  namespace base
+  {
+    namespace alloc
+    {
+      const static size_t _ARENA_CHUNK_SIZE = 0xFFFFF; /* 1M-1 */
+      const static size_t _ARENA_ALIGN = sizeof (void*);
+      const static size_t _ARENA_MAX_BLOCK = 32 * _ARENA_ALIGN;
+
+      /*!
+       * \class _Arena
+       * \brief A chunk-based storage for blocks of any size, freed at once when destroyed.
+       * \author Leandro Costa
+       * \date 2011
+       *
+       * Like _Storage, the arena takes memory from the system in chunks
+       * and keeps the free blocks in lists, but it isn't static nor bound
+       * to a type: blocks are rounded up to a multiple of a pointer's size
+       * and there's a free list for each size, so all the lists of a
+       * structure (a graph, for instance) can share an arena. Blocks are
+       * taken from the last chunk one after another, and a deallocated
+       * block is reused by the next allocation of the same size.
+       *
+       * Blocks bigger than _ARENA_MAX_BLOCK are taken from malloc.
+       *
+       * All chunks are released when the arena is destroyed, so blocks
+       * must not be used after that. The arena isn't thread-safe: it's
+       * meant to be owned by a structure that isn't thread-safe either.
+       */
+
+      class _Arena
+      {
+        private:
+          UT_CXXTEST_FRIEND_CLASS(::arena_cxx);
+
+        private:
+          /*!
+           * \struct _Block
+           * \brief A free block, linked to the next free block of the same size.
+           */
+
+          struct _Block
+          {
+            _Block* _next;
+          };
+
+          /*!
+           * \struct _Chunk
+           * \brief The header of a chunk, followed by _ARENA_CHUNK_SIZE bytes.
+           */
+
+          struct _Chunk
+          {
+            _Chunk* _next;
+            size_t  _pad; /** < keeps the blocks aligned to 2 pointers, like malloc does */
+          };
+
+          const static size_t _NUM_SIZES = _ARENA_MAX_BLOCK / _ARENA_ALIGN;
+
+        public:
+          _Arena () : _head (NULL), _ptr (NULL), _end (NULL), _size (0)
+          {
+            for (size_t i = 0; i < _NUM_SIZES; i++)
+              _free [i] = NULL;
+          }
+
+          ~_Arena () { _destroy (); }
+
+        private:
+          _Arena (const _Arena&);
+          _Arena& operator=(const _Arena&);
+
+        private:
+          static size_t _index (const size_t& _n) { return (_n ? (_n - 1) / _ARENA_ALIGN : 0); }
+
+          void _add_chunk ()
+          {
+            _Chunk* _c = static_cast<_Chunk *>(malloc (sizeof (_Chunk) + _ARENA_CHUNK_SIZE));
+
+            if (! _c)
+              throw cgt::base::exception::mem_except ("Not available memory");
+
+            _c->_next = _head;
+            _head = _c;
+            _ptr = reinterpret_cast<char *>(_c + 1);
+            _end = _ptr + _ARENA_CHUNK_SIZE;
+            _size += _ARENA_CHUNK_SIZE;
+          }
+
+          void _destroy ()
+          {
+            while (_head)
+            {
+              _Chunk* _c = _head;
+              _head = _head->_next;
+              free (_c);
+            }
+          }
+
+        public:
+          void* allocate (const size_t& _n)
+          {
+            if (_n > _ARENA_MAX_BLOCK)
+            {
+              void* _p = malloc (_n);
+
+              if (! _p)
+                throw cgt::base::exception::mem_except ("Not available memory");
+
+              return _p;
+            }
+
+            size_t i = _index (_n);
+
+            if (_free [i])
+            {
+              _Block* _b = _free [i];
+              _free [i] = _b->_next;
+              return _b;
+            }
+
+            size_t _blocksize = (i + 1) * _ARENA_ALIGN;
+
+            if (static_cast<size_t>(_end - _ptr) < _blocksize)
+              _add_chunk ();
+
+            void* _p = _ptr;
+            _ptr += _blocksize;
+
+            return _p;
+          }
+
+          void deallocate (void* _p, const size_t& _n)
+          {
+            if (_n > _ARENA_MAX_BLOCK)
+              free (_p);
+            else
+            {
+              size_t i = _index (_n);
+              static_cast<_Block *>(_p)->_next = _free [i];
+              _free [i] = static_cast<_Block *>(_p);
+            }
+          }
+
+          /** the memory taken from the system in chunks, in bytes */
+          size_t capacity () const { return _size; }
+
+        private:
+          _Chunk* _head;              /** < the last allocated chunk, linked to the previous ones */
+          char*   _ptr;               /** < the first unused byte of the last chunk */
+          char*   _end;               /** < the end of the last chunk */
+          size_t  _size;
+          _Block* _free [_NUM_SIZES]; /** < the free blocks of each size */
+      };
+    }
+  }
+}
+
+#endif // __CGTL__CGT_BASE_ALLOC_ARENA_H_
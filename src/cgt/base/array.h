@@ -0,0 +1,213 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/array.h
+ * \brief Contains definition of a contiguous array container.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_ARRAY_H_
+#define __CGTL__CGT_BASE_ARRAY_H_
+
+#ifdef CGTL_DO_NOT_USE_STL
+#include <stdlib.h>
+#include <new>
+#else
+#include <vector>
+#endif
+
+
+namespace cgt
+{
+  namespace base
+  {
+    /*!
+     * \class array
+     * \brief A growable array that keeps its items contiguous in memory.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * Unlike cgt::base::vector, that keeps an array of pointers to items
+     * allocated one by one, the array stores the items themselves in a single
+     * block, so it's the container to be used for per-vertex and per-edge
+     * data scanned sequentially (indexed by vertex id, CSR arrays, etc.).
+     * Without CGTL_DO_NOT_USE_STL it's just a std::vector.
+     *
+     * The interface is the subset of std::vector used by the library.
+     */
+
+#ifdef CGTL_DO_NOT_USE_STL
+    template<typename _TpItem>
+      class array
+      {
+        private:
+          typedef array<_TpItem> _Self;
+
+        public:
+          typedef _TpItem*        iterator;
+          typedef const _TpItem*  const_iterator;
+
+        public:
+          array () : _ptr (NULL), _size (0), _capacity (0) { }
+          explicit array (size_t _n, const _TpItem& _i = _TpItem ()) : _ptr (NULL), _size (0), _capacity (0) { resize (_n, _i); }
+          array (const _Self& _a) : _ptr (NULL), _size (0), _capacity (0) { *this = _a; }
+          ~array () { clear (); free (_ptr); }
+
+        public:
+          _Self& operator=(const _Self& _a);
+
+        private:
+          void _realloc (size_t _n);
+
+        public:
+          void reserve (size_t _n) { if (_n > _capacity) _realloc (_n); }
+          void resize (size_t _n, const _TpItem& _i = _TpItem ());
+          void clear () { while (_size) _ptr [--_size].~_TpItem (); }
+          void swap (_Self& _a);
+
+          void push_back (const _TpItem& _i)
+          {
+            if (_size == _capacity)
+              _realloc (_capacity ? 2 * _capacity : 8);
+
+            new (&(_ptr [_size])) _TpItem (_i);
+            _size++;
+          }
+
+          void pop_back () { _ptr [--_size].~_TpItem (); }
+
+        public:
+          size_t size () const { return _size; }
+          size_t capacity () const { return _capacity; }
+          const bool empty () const { return (! _size); }
+
+          _TpItem& operator[](size_t _pos) { return _ptr [_pos]; }
+          const _TpItem& operator[](size_t _pos) const { return _ptr [_pos]; }
+          _TpItem& front () { return _ptr [0]; }
+          const _TpItem& front () const { return _ptr [0]; }
+          _TpItem& back () { return _ptr [_size - 1]; }
+          const _TpItem& back () const { return _ptr [_size - 1]; }
+
+          iterator begin () { return _ptr; }
+          iterator end () { return _ptr + _size; }
+          const_iterator begin () const { return _ptr; }
+          const_iterator end () const { return _ptr + _size; }
+
+        private:
+          _TpItem*  _ptr;
+          size_t    _size;
+          size_t    _capacity;
+      };
+
+    template<typename _TpItem>
+      array<_TpItem>& array<_TpItem>::operator=(const _Self& _a)
+      {
+        if (this != &_a)
+        {
+          clear ();
+          reserve (_a._size);
+
+          for (size_t i = 0; i < _a._size; i++)
+            new (&(_ptr [i])) _TpItem (_a._ptr [i]);
+
+          _size = _a._size;
+        }
+
+        return *this;
+      }
+
+    template<typename _TpItem>
+      void array<_TpItem>::_realloc (size_t _n)
+      {
+        /*
+         * items are copied to the new block (not moved with realloc),
+         * since they aren't required to be trivially copyable.
+         */
+
+        _TpItem* _p = static_cast<_TpItem *>(malloc (_n * sizeof (_TpItem)));
+
+        for (size_t i = 0; i < _size; i++)
+        {
+          new (&(_p [i])) _TpItem (_ptr [i]);
+          _ptr [i].~_TpItem ();
+        }
+
+        free (_ptr);
+        _ptr = _p;
+        _capacity = _n;
+      }
+
+    template<typename _TpItem>
+      void array<_TpItem>::resize (size_t _n, const _TpItem& _i)
+      {
+        if (_n > _size)
+        {
+          /* grows like push_back, so growing an array one item at a time is amortized O(1) */
+          if (_n > _capacity)
+            _realloc (_n > 2 * _capacity ? _n : 2 * _capacity);
+
+          while (_size < _n)
+            new (&(_ptr [_size++])) _TpItem (_i);
+        }
+        else
+        {
+          while (_size > _n)
+            _ptr [--_size].~_TpItem ();
+        }
+      }
+
+    template<typename _TpItem>
+      void array<_TpItem>::swap (_Self& _a)
+      {
+        _TpItem* _p = _ptr;
+        _ptr = _a._ptr;
+        _a._ptr = _p;
+
+        size_t _s = _size;
+        _size = _a._size;
+        _a._size = _s;
+
+        size_t _c = _capacity;
+        _capacity = _a._capacity;
+        _a._capacity = _c;
+      }
+#else
+    template<typename _TpItem>
+      class array : public std::vector<_TpItem>
+      {
+        private:
+          typedef std::vector<_TpItem> _Base;
+
+        public:
+          array () : _Base () { }
+          explicit array (size_t _n, const _TpItem& _i = _TpItem ()) : _Base (_n, _i) { }
+      };
+#endif
+  }
+}
+
+#endif // __CGTL__CGT_BASE_ARRAY_H_
@@ -0,0 +1,98 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/array_stack.h
+ * \brief Contains definition of a stack container kept in an array.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_ARRAY_STACK_H_
+#define __CGTL__CGT_BASE_ARRAY_STACK_H_
+
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace base
+  {
+    /*!
+     * \class array_stack
+     * \brief A stack container kept in an array, for the states of searches.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * The items are kept in an array, from the bottom to the top. Popped
+     * positions aren't destroyed, but overwritten by the next pushes, so
+     * the array only grows (doubling, amortized \b O(1)) when the stack is
+     * deeper than it has ever been, and pop doesn't allocate or free
+     * anything: unlike cgt::base::stack, there's no list item for each
+     * item, and pop doesn't return a copy that must be deleted.
+     *
+     * The reference returned by pop is valid until the next item is
+     * pushed; the one returned by top, until the stack grows.
+     */
+
+    template<typename _TpItem>
+      class array_stack
+      {
+        public:
+          array_stack () : _size (0) { }
+
+        public:
+          void insert (const _TpItem &_item) { push (_item); }
+          void push (const _TpItem &_item);
+          const _TpItem& pop () { return _items [--_size]; }
+          _TpItem& top () { return _items [_size - 1]; }
+          const _TpItem& top () const { return _items [_size - 1]; }
+
+        public:
+          size_t size () const { return _size; }
+          const bool empty () const { return (! _size); }
+
+          /** removes all items, keeping the array */
+          void clear () { _size = 0; }
+
+        private:
+          array<_TpItem>  _items;
+          size_t          _size;
+      };
+
+    template<typename _TpItem>
+      void array_stack<_TpItem>::push (const _TpItem &_item)
+      {
+        if (_size == _items.size ())
+          _items.push_back (_item);
+        else
+          _items [_size] = _item;
+
+        _size++;
+      }
+  }
+}
+
+#endif // __CGTL__CGT_BASE_ARRAY_STACK_H_
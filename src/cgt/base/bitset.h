@@ -0,0 +1,261 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/bitset.h
+ * \brief Contains definition of a growable set of bits packed in words.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_BITSET_H_
+#define __CGTL__CGT_BASE_BITSET_H_
+
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace base
+  {
+    typedef unsigned long _BitWord;
+
+    const static size_t _BITS_PER_WORD = 8 * sizeof (_BitWord);
+
+    /** the number of words needed to keep \b _n bits */
+    inline size_t _num_words (const size_t& _n) { return (_n + _BITS_PER_WORD - 1) / _BITS_PER_WORD; }
+
+    /** the number of bits set in \b _w */
+    inline size_t _popcount (_BitWord _w)
+    {
+#ifdef __GNUC__
+      return __builtin_popcountl (_w);
+#else
+      size_t _c = 0;
+
+      for (; _w; _w &= _w - 1)
+        _c++;
+
+      return _c;
+#endif
+    }
+
+    /** the position of the lowest bit set in \b _w (that can't be 0) */
+    inline size_t _lowest_bit (_BitWord _w)
+    {
+#ifdef __GNUC__
+      return __builtin_ctzl (_w);
+#else
+      size_t _b = 0;
+
+      for (; ! (_w & 1); _w >>= 1)
+        _b++;
+
+      return _b;
+#endif
+    }
+
+
+    /*!
+     * \class bitset
+     * \brief A set of integers from 0 to size () - 1, kept as bits packed in words.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * Unions, intersections and differences combine whole words at once
+     * (loops the compiler can vectorize), so a set of \b n integers is
+     * combined with another in \b O(n / w), where \b w is the number of bits
+     * of a word. Operations that take raw words (or_words, and_words, etc.)
+     * read num_words () words, and are used to combine a set with a row of
+     * a bit matrix (see _GraphBitMatrix).
+     *
+     * Bits beyond size () are always 0.
+     */
+
+    class bitset
+    {
+      public:
+        bitset () : _size (0) { }
+        explicit bitset (const size_t& _n) : _size (_n), _words (_num_words (_n), 0) { }
+
+      public:
+        size_t size () const { return _size; }
+        size_t num_words () const { return _words.size (); }
+
+        /** grows (or shrinks) the set to \b _n bits: new bits are 0 */
+        void resize (const size_t& _n);
+
+        const _BitWord* data () const { return (_words.empty () ? NULL : &(_words [0])); }
+
+      public:
+        bool test (const size_t& _i) const { return (_words [_i / _BITS_PER_WORD] >> (_i % _BITS_PER_WORD)) & 1; }
+        void set (const size_t& _i) { _words [_i / _BITS_PER_WORD] |= (static_cast<_BitWord>(1) << (_i % _BITS_PER_WORD)); }
+        void reset (const size_t& _i) { _words [_i / _BITS_PER_WORD] &= ~(static_cast<_BitWord>(1) << (_i % _BITS_PER_WORD)); }
+
+        /** resets all bits */
+        void clear ();
+
+        size_t count () const;
+        bool any () const;
+
+        /** the first bit set from \b _i on, or size () if there's none */
+        size_t find_next (const size_t& _i) const;
+        size_t find_first () const { return find_next (0); }
+
+      public:
+        bitset& operator&=(const bitset& _b) { and_words (_b.data ()); return *this; }
+        bitset& operator|=(const bitset& _b) { or_words (_b.data ()); return *this; }
+
+        /** removes the bits set in \b _b (sets of the same size) */
+        bitset& and_not (const bitset& _b) { and_not_words (_b.data ()); return *this; }
+
+        void and_words (const _BitWord* _w);
+        void or_words (const _BitWord* _w);
+        void and_not_words (const _BitWord* _w);
+
+        /** the number of bits set both here and in \b _w, without changing the set */
+        size_t count_and_words (const _BitWord* _w) const;
+
+        const bool operator==(const bitset& _b) const;
+        const bool operator!=(const bitset& _b) const { return ! (*this == _b); }
+
+        void swap (bitset& _b);
+
+      private:
+        size_t            _size;
+        array<_BitWord>   _words;
+    };
+
+    inline void bitset::resize (const size_t& _n)
+    {
+      size_t _nw = _num_words (_n);
+
+      if (_n < _size)
+      {
+        for (size_t i = _n; i < _size && i < _nw * _BITS_PER_WORD; i++)
+          reset (i);
+      }
+
+      _words.resize (_nw, 0);
+      _size = _n;
+    }
+
+    inline void bitset::clear ()
+    {
+      for (size_t i = 0; i < _words.size (); i++)
+        _words [i] = 0;
+    }
+
+    inline size_t bitset::count () const
+    {
+      size_t _c = 0;
+
+      for (size_t i = 0; i < _words.size (); i++)
+        _c += _popcount (_words [i]);
+
+      return _c;
+    }
+
+    inline bool bitset::any () const
+    {
+      for (size_t i = 0; i < _words.size (); i++)
+        if (_words [i])
+          return true;
+
+      return false;
+    }
+
+    inline size_t bitset::find_next (const size_t& _i) const
+    {
+      size_t k = _i / _BITS_PER_WORD;
+
+      if (_i >= _size)
+        return _size;
+
+      _BitWord _w = _words [k] & (~static_cast<_BitWord>(0) << (_i % _BITS_PER_WORD));
+
+      while (! _w)
+      {
+        if (++k == _words.size ())
+          return _size;
+
+        _w = _words [k];
+      }
+
+      return k * _BITS_PER_WORD + _lowest_bit (_w);
+    }
+
+    inline void bitset::and_words (const _BitWord* _w)
+    {
+      for (size_t i = 0; i < _words.size (); i++)
+        _words [i] &= _w [i];
+    }
+
+    inline void bitset::or_words (const _BitWord* _w)
+    {
+      for (size_t i = 0; i < _words.size (); i++)
+        _words [i] |= _w [i];
+    }
+
+    inline void bitset::and_not_words (const _BitWord* _w)
+    {
+      for (size_t i = 0; i < _words.size (); i++)
+        _words [i] &= ~_w [i];
+    }
+
+    inline size_t bitset::count_and_words (const _BitWord* _w) const
+    {
+      size_t _c = 0;
+
+      for (size_t i = 0; i < _words.size (); i++)
+        _c += _popcount (_words [i] & _w [i]);
+
+      return _c;
+    }
+
+    inline const bool bitset::operator==(const bitset& _b) const
+    {
+      if (_size != _b._size)
+        return false;
+
+      for (size_t i = 0; i < _words.size (); i++)
+        if (_words [i] != _b._words [i])
+          return false;
+
+      return true;
+    }
+
+    inline void bitset::swap (bitset& _b)
+    {
+      size_t _s = _size;
+      _size = _b._size;
+      _b._size = _s;
+
+      _words.swap (_b._words);
+    }
+  }
+}
+
+#endif // __CGTL__CGT_BASE_BITSET_H_
@@ -0,0 +1,260 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/bucket_queue.h
+ * \brief Contains definition of a monotone queue of indices with small unsigned integer keys (Dial's buckets).
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_BUCKET_QUEUE_H_
+#define __CGTL__CGT_BASE_BUCKET_QUEUE_H_
+
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace base
+  {
+    /*!
+     * \class bucket_queue
+     * \brief A monotone priority queue of indices with an unsigned integer key each, kept in a bucket per key (Dial's buckets).
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * It has the interface of cgt::base::indexed_heap, for keys that never
+     * go below the key of the last index popped, as in Dijkstra Algorithm.
+     * The keys in the queue lie from the last key popped to that key plus
+     * \b C, where \b C is the greatest value of an edge, so they're kept in
+     * a ring of more than \b C buckets, one per key, and the ring is walked
+     * from the last key popped on. push and decrease are \b O(1), with no
+     * comparisons between keys, and all pops of a search walk once around
+     * the distances it reaches: Dijkstra runs in <b>O(E + D)</b>, for a
+     * greatest distance \b D.
+     *
+     * The ring starts with 64 buckets, and doubles (its indices are moved
+     * to their new buckets) when a key is pushed beyond it, so it takes
+     * memory in proportion to \b C: it suits keys with a small range, like
+     * unsigned char and unsigned short ones (see cgt::base::radix_heap for
+     * wider keys). Indices with the same key aren't popped in any
+     * particular order, and top and top_key may walk the ring (so they
+     * aren't const).
+     */
+
+    template<typename _TpKey>
+      class bucket_queue
+      {
+        public:
+          static const size_t npos = static_cast<size_t>(-1);
+
+        public:
+          bucket_queue () : _size (0), _last (0), _head (64, npos) { }
+
+        public:
+          const bool empty () const { return (_size == 0); }
+          size_t size () const { return _size; }
+
+          /** the index with the lowest key */
+          const size_t& top () { _walk (); return _head [_slot (_last)]; }
+          const _TpKey& top_key () { return _keys [top ()]; }
+
+          const bool contains (const size_t& _i) const { return (_i < _in.size () && _in [_i]); }
+
+          /** the key of \b _i (the last one it had, if it's not in the heap) */
+          const _TpKey& key (const size_t& _i) const { return _keys [_i]; }
+
+        public:
+          /** inserts \b _i, that can't be in the queue, with key \b _key (not lower than the last key popped) */
+          void push (const size_t& _i, const _TpKey& _key);
+
+          /** lowers the key of \b _i, that must be in the queue, to \b _key (not lower than the last key popped) */
+          void decrease (const size_t& _i, const _TpKey& _key) { _unlink (_i); _keys [_i] = _key; _link (_i); }
+
+          /** inserts \b _i, or lowers its key if it's greater than \b _key: false if nothing changed */
+          bool push_or_decrease (const size_t& _i, const _TpKey& _key);
+
+          /** removes the index with the lowest key, and returns it */
+          size_t pop ();
+
+          /** removes all indices, keeping the arrays: the next keys can be as low as 0 */
+          void clear ();
+
+          /** makes room for indices up to \b _n - 1 */
+          void reserve (const size_t& _n) { _next.reserve (_n); _prev.reserve (_n); _in.reserve (_n); _keys.reserve (_n); }
+
+        private:
+          size_t _slot (const _TpKey& _key) const { return (static_cast<size_t>(_key) & (_head.size () - 1)); }
+
+          /** puts \b _i in the bucket of its key */
+          void _link (const size_t& _i);
+          void _unlink (const size_t& _i);
+
+          /** moves _last on to the first key with an index */
+          void _walk ();
+
+          /** doubles the ring until it has more than \b _span buckets */
+          void _grow (const size_t& _span);
+
+        private:
+          size_t        _size;
+          _TpKey        _last;    /** < the last key popped: no key is lower */
+          array<size_t> _head;    /** < the first index of each bucket (a power of 2 of them) */
+
+          array<size_t> _next;    /** < index -> the next index of its bucket */
+          array<size_t> _prev;    /** < index -> the previous index of its bucket */
+          array<char>   _in;      /** < index -> if it's in the queue */
+          array<_TpKey> _keys;    /** < index -> its key */
+      };
+
+    template<typename _TpKey>
+      const size_t bucket_queue<_TpKey>::npos;
+
+    template<typename _TpKey>
+      void bucket_queue<_TpKey>::push (const size_t& _i, const _TpKey& _key)
+      {
+        if (_i >= _in.size ())
+        {
+          _next.resize (_i + 1, npos);
+          _prev.resize (_i + 1, npos);
+          _in.resize (_i + 1, 0);
+          _keys.resize (_i + 1, _key);
+        }
+
+        _keys [_i] = _key;
+        _link (_i);
+        _size++;
+      }
+
+    template<typename _TpKey>
+      bool bucket_queue<_TpKey>::push_or_decrease (const size_t& _i, const _TpKey& _key)
+      {
+        if (! contains (_i))
+          push (_i, _key);
+        else if (_key < _keys [_i])
+          decrease (_i, _key);
+        else
+          return false;
+
+        return true;
+      }
+
+    template<typename _TpKey>
+      size_t bucket_queue<_TpKey>::pop ()
+      {
+        size_t _top = top ();
+
+        _unlink (_top);
+        _size--;
+
+        return _top;
+      }
+
+    template<typename _TpKey>
+      void bucket_queue<_TpKey>::clear ()
+      {
+        for (size_t b = 0; _size && b < _head.size (); b++)
+        {
+          for (size_t i = _head [b]; i != npos; i = _next [i])
+          {
+            _in [i] = 0;
+            _size--;
+          }
+
+          _head [b] = npos;
+        }
+
+        _size = 0;
+        _last = 0;
+      }
+
+    template<typename _TpKey>
+      void bucket_queue<_TpKey>::_link (const size_t& _i)
+      {
+        if (static_cast<size_t>(_keys [_i] - _last) >= _head.size ())
+          _grow (_keys [_i] - _last);
+
+        size_t _b = _slot (_keys [_i]);
+
+        _in [_i] = 1;
+        _prev [_i] = npos;
+        _next [_i] = _head [_b];
+
+        if (_head [_b] != npos)
+          _prev [_head [_b]] = _i;
+
+        _head [_b] = _i;
+      }
+
+    template<typename _TpKey>
+      void bucket_queue<_TpKey>::_unlink (const size_t& _i)
+      {
+        if (_prev [_i] != npos)
+          _next [_prev [_i]] = _next [_i];
+        else
+          _head [_slot (_keys [_i])] = _next [_i];
+
+        if (_next [_i] != npos)
+          _prev [_next [_i]] = _prev [_i];
+
+        _in [_i] = 0;
+      }
+
+    template<typename _TpKey>
+      void bucket_queue<_TpKey>::_walk ()
+      {
+        if (_size)
+          while (_head [_slot (_last)] == npos)
+            _last++;
+      }
+
+    template<typename _TpKey>
+      void bucket_queue<_TpKey>::_grow (const size_t& _span)
+      {
+        /* takes the indices out of the ring, and puts them back in the new one */
+
+        array<size_t> _items;
+        _items.reserve (_size);
+
+        for (size_t b = 0; _items.size () < _size && b < _head.size (); b++)
+          for (size_t i = _head [b]; i != npos; i = _next [i])
+            _items.push_back (i);
+
+        size_t _n = 2 * _head.size ();
+
+        while (_n <= _span)
+          _n *= 2;
+
+        _head.clear ();
+        _head.resize (_n, npos);
+
+        for (size_t k = 0; k < _items.size (); k++)
+          _link (_items [k]);
+      }
+  }
+}
+
+#endif // __CGTL__CGT_BASE_BUCKET_QUEUE_H_
@@ -52,34 +52,37 @@ namespace cgt
      * \date 2009
      *
      * This is a general-purpose hash container, table size starts with 2 and
-     * increases exponentially. The hash function is _HashFunc, and each item is
+     * increases exponentially. The hash function is _TpFunc (_HashFunc by default,
+     * any functor with a <b>size_t operator()(const _TpKey&) const</b> can be
+     * used instead), and each item is
      * represented by a _HashItem structure, that contains key and data to be stored.
      * Table increases when the number of elements of the hash is equal to the table
      * size, and it happens in time complexity \b O(n) (worst case), where \b n is the
      * number of elements stored in the hash.
      */
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc = cgt::base::alloc::_Allocator<_HashItem<pair<const _TpKey, _TpItem> > > >
+    template<typename _TpKey, typename _TpItem, typename _Alloc = cgt::base::alloc::_Allocator<_HashItem<pair<const _TpKey, _TpItem> > >, typename _TpFunc = _HashFunc<_TpKey> >
       class hash
       {
         private:
-          friend class _HashIterator<_TpKey, _TpItem, _Alloc, cgt::base::iterator::_TpCommon>;
-          friend class _HashIterator<_TpKey, _TpItem, _Alloc, cgt::base::iterator::_TpConst>;
+          friend class _HashIterator<_TpKey, _TpItem, _Alloc, _TpFunc, cgt::base::iterator::_TpCommon>;
+          friend class _HashIterator<_TpKey, _TpItem, _Alloc, _TpFunc, cgt::base::iterator::_TpConst>;
 
         private:
-          typedef hash<_TpKey, _TpItem, _Alloc>           _Self;
+          typedef hash<_TpKey, _TpItem, _Alloc, _TpFunc>  _Self;
           typedef _HashItem<pair<const _TpKey, _TpItem> > _Item;
-          typedef _HashFunc<_TpKey>                       _Func;
+          typedef _TpFunc                                 _Func;
 
         private:
           typedef typename _Alloc::template rebind<_Item>::other allocator_type;
 
         public:
-          typedef _HashIterator<_TpKey, _TpItem, _Alloc>            iterator;
-          typedef _HashIterator<_TpKey, _TpItem, _Alloc, cgt::base::iterator::_TpConst>  const_iterator;
+          typedef _HashIterator<_TpKey, _TpItem, _Alloc, _TpFunc>            iterator;
+          typedef _HashIterator<_TpKey, _TpItem, _Alloc, _TpFunc, cgt::base::iterator::_TpConst>  const_iterator;
 
         public:
           hash () : _size (0), _tabsize (2) { _init (); }
+          explicit hash (const _Alloc& _a) : _size (0), _tabsize (2), _alloc (_a) { _init (); }
           hash (const hash& _h) : _table (NULL), _size (0), _tabsize (0) { *this = _h; }
           virtual ~hash () { _remove_all (); free (_table); }
 
@@ -97,6 +100,7 @@ namespace cgt
 
         public:
           void insert (const _TpKey& _key, const _TpItem& _item);
+          void remove (const _TpKey& _key);
           size_t size () const { return _size; }
           const bool empty () const { return (! _size); }
 
@@ -119,8 +123,8 @@ namespace cgt
       };
 
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      hash<_TpKey, _TpItem, _Alloc>& hash<_TpKey, _TpItem, _Alloc>::operator=(const _Self& _s)
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      hash<_TpKey, _TpItem, _Alloc, _TpFunc>& hash<_TpKey, _TpItem, _Alloc, _TpFunc>::operator=(const _Self& _s)
       {
         if (_table)
         {
@@ -148,15 +152,15 @@ namespace cgt
         return *this;
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      void hash<_TpKey, _TpItem, _Alloc>::_init ()
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      void hash<_TpKey, _TpItem, _Alloc, _TpFunc>::_init ()
       {
         _table = (_Item **) malloc (_tabsize * sizeof (_Item **));
         bzero (_table, _tabsize * sizeof (_Item **));
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      void hash<_TpKey, _TpItem, _Alloc>::_increase ()
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      void hash<_TpKey, _TpItem, _Alloc, _TpFunc>::_increase ()
       {
         _tabsize *= 2;
         _table = (_Item **) realloc (_table, _tabsize * sizeof (_Item **));
@@ -176,8 +180,8 @@ namespace cgt
         }
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      void hash<_TpKey, _TpItem, _Alloc>::_insert (_Item* const _p)
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      void hash<_TpKey, _TpItem, _Alloc, _TpFunc>::_insert (_Item* const _p)
       {
         _Item** _ptr = &(_table [_get_position (_p->_item.first)]);
         while (*_ptr)
@@ -187,8 +191,8 @@ namespace cgt
         _size++;
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      _HashItem<pair<const _TpKey, _TpItem> >* hash<_TpKey, _TpItem, _Alloc>::_pop (_Item** const _p)
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      _HashItem<pair<const _TpKey, _TpItem> >* hash<_TpKey, _TpItem, _Alloc, _TpFunc>::_pop (_Item** const _p)
       {
         _Item* _ptr = *_p;
         *_p = (*_p)->_next;
@@ -198,8 +202,8 @@ namespace cgt
         return _ptr;
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      void hash<_TpKey, _TpItem, _Alloc>::_remove_all ()
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      void hash<_TpKey, _TpItem, _Alloc, _TpFunc>::_remove_all ()
       {
         for (size_t i = 0; i < _tabsize; i++)
         {
@@ -213,14 +217,14 @@ namespace cgt
         }
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      const size_t hash<_TpKey, _TpItem, _Alloc>::_get_position (const _TpKey& _key) const
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      const size_t hash<_TpKey, _TpItem, _Alloc, _TpFunc>::_get_position (const _TpKey& _key) const
       {
         return (_hash_func (_key) % _tabsize);
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      _TpItem** hash<_TpKey, _TpItem, _Alloc>::_get_head ()
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      _TpItem** hash<_TpKey, _TpItem, _Alloc, _TpFunc>::_get_head ()
       {
         _TpItem** _ptr = &(_table [0]);
 
@@ -230,8 +234,8 @@ namespace cgt
         return _ptr;
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      void hash<_TpKey, _TpItem, _Alloc>::insert (const _TpKey& _key, const _TpItem& _item)
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      void hash<_TpKey, _TpItem, _Alloc, _TpFunc>::insert (const _TpKey& _key, const _TpItem& _item)
       {
         if (_size == _tabsize)
           _increase ();
@@ -241,8 +245,24 @@ namespace cgt
         _insert (_ptr);
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      _TpItem* hash<_TpKey, _TpItem, _Alloc>::operator[](const _TpKey& _key)
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      void hash<_TpKey, _TpItem, _Alloc, _TpFunc>::remove (const _TpKey& _key)
+      {
+        _Item** _ptr = &(_table [_get_position (_key)]);
+
+        while (*_ptr && (*_ptr)->_item.first != _key)
+          _ptr = &((*_ptr)->_next);
+
+        if (*_ptr)
+        {
+          _Item* _p = _pop (_ptr);
+          _alloc.destroy (_p);
+          _alloc.deallocate (_p, 1);
+        }
+      }
+
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      _TpItem* hash<_TpKey, _TpItem, _Alloc, _TpFunc>::operator[](const _TpKey& _key)
       {
         _TpItem* _ptr = NULL;
 
@@ -257,8 +277,8 @@ namespace cgt
         return _ptr;
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      _HashIterator<_TpKey, _TpItem, _Alloc> hash<_TpKey, _TpItem, _Alloc>::begin ()
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      _HashIterator<_TpKey, _TpItem, _Alloc, _TpFunc> hash<_TpKey, _TpItem, _Alloc, _TpFunc>::begin ()
       {
         size_t _pos = 0;
 
@@ -271,8 +291,8 @@ namespace cgt
           return end ();
       }
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      _HashIterator<_TpKey, _TpItem, _Alloc, cgt::base::iterator::_TpConst> hash<_TpKey, _TpItem, _Alloc>::begin () const
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      _HashIterator<_TpKey, _TpItem, _Alloc, _TpFunc, cgt::base::iterator::_TpConst> hash<_TpKey, _TpItem, _Alloc, _TpFunc>::begin () const
       {
         size_t _pos = 0;
 
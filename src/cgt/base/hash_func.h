@@ -65,6 +65,23 @@ namespace cgt
         return _h;
       }
 
+    /*!
+     * \struct _HashFunc
+     * \brief The hash-function for pointers: uses the address, discarding the alignment bits.
+     * \author Leandro Costa
+     * \date 2011
+     */
+
+    template<typename _TpKey>
+      struct _HashFunc<_TpKey*>
+      {
+        const size_t operator()(_TpKey* const& _key) const
+        {
+          size_t _h = reinterpret_cast<size_t>(_key) >> 3;
+          return (_h ^ (_h >> 16));
+        }
+      };
+
     template<>
       const size_t _HashFunc<int>::operator()(const int& _key) const
       {
@@ -40,7 +40,7 @@ namespace cgt
 {
   namespace base
   {
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
       class hash;
 
 
@@ -53,15 +53,15 @@ namespace cgt
      * This is the default iterator for hash container.
      */
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
-      class _HashIterator : public _HashIteratorBase<_TpKey, _TpItem, _Alloc, _TpIterator>
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
+      class _HashIterator : public _HashIteratorBase<_TpKey, _TpItem, _Alloc, _TpFunc, _TpIterator>
     {
       private:
         typedef _HashItem<pair<const _TpKey, _TpItem> >                                 _Item;
-        typedef _HashIteratorBase<_TpKey, _TpItem, _Alloc, _TpIterator>                 _Base;
-        typedef _HashIterator<_TpKey, _TpItem, _Alloc, _TpIterator>                     _Self;
-        typedef _HashIterator<_TpKey, _TpItem, _Alloc, cgt::base::iterator::_TpCommon>  _SelfCommon;
-        typedef hash<_TpKey, _TpItem, _Alloc>                                           _Hash;
+        typedef _HashIteratorBase<_TpKey, _TpItem, _Alloc, _TpFunc, _TpIterator>                 _Base;
+        typedef _HashIterator<_TpKey, _TpItem, _Alloc, _TpFunc, _TpIterator>                     _Self;
+        typedef _HashIterator<_TpKey, _TpItem, _Alloc, _TpFunc, cgt::base::iterator::_TpCommon>  _SelfCommon;
+        typedef hash<_TpKey, _TpItem, _Alloc, _TpFunc>                                           _Hash;
 
       private:
         typedef typename _TpIterator<pair<const _TpKey, _TpItem> >::pointer   pointer;
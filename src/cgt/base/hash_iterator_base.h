@@ -42,7 +42,7 @@ namespace cgt
 {
   namespace base
   {
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
       class hash;
 
     /*!
@@ -57,19 +57,19 @@ namespace cgt
      * constructor of a const iterator receiving a common iterator as argument.
      */
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc, template<typename> class _TpIterator>
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc, template<typename> class _TpIterator>
       class _HashIteratorBase;
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      class _HashIteratorBase<_TpKey, _TpItem, _Alloc, cgt::base::iterator::_TpCommon> : public cgt::base::iterator::_IteratorPtr<_HashItem<pair<const _TpKey, _TpItem> >, cgt::base::iterator::_TpCommon>
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      class _HashIteratorBase<_TpKey, _TpItem, _Alloc, _TpFunc, cgt::base::iterator::_TpCommon> : public cgt::base::iterator::_IteratorPtr<_HashItem<pair<const _TpKey, _TpItem> >, cgt::base::iterator::_TpCommon>
     {
       private:
-        friend class _HashIteratorBase<_TpKey, _TpItem, _Alloc, cgt::base::iterator::_TpConst>;
+        friend class _HashIteratorBase<_TpKey, _TpItem, _Alloc, _TpFunc, cgt::base::iterator::_TpConst>;
 
       private:
         typedef _HashItem<pair<const _TpKey, _TpItem> >                                     _Item;
         typedef cgt::base::iterator::_IteratorPtr<_Item, cgt::base::iterator::_TpCommon>    _Base;
-        typedef hash<_TpKey, _TpItem, _Alloc>                                               _Hash;
+        typedef hash<_TpKey, _TpItem, _Alloc, _TpFunc>                                      _Hash;
 
       public:
         _HashIteratorBase () : _Base (NULL), _ptr_hash (NULL) { }
@@ -80,14 +80,14 @@ namespace cgt
         _Hash* _ptr_hash; /** < pointer to the hash, shouldn't be destructed */
     };
 
-    template<typename _TpKey, typename _TpItem, typename _Alloc>
-      class _HashIteratorBase<_TpKey, _TpItem, _Alloc, cgt::base::iterator::_TpConst> : public cgt::base::iterator::_IteratorPtr<_HashItem<pair<const _TpKey, _TpItem> >, cgt::base::iterator::_TpConst>
+    template<typename _TpKey, typename _TpItem, typename _Alloc, typename _TpFunc>
+      class _HashIteratorBase<_TpKey, _TpItem, _Alloc, _TpFunc, cgt::base::iterator::_TpConst> : public cgt::base::iterator::_IteratorPtr<_HashItem<pair<const _TpKey, _TpItem> >, cgt::base::iterator::_TpConst>
     {
       private:
         typedef _HashItem<pair<const _TpKey, _TpItem> >                                     _Item;
         typedef cgt::base::iterator::_IteratorPtr<_Item, cgt::base::iterator::_TpConst>     _Base;
-        typedef _HashIteratorBase<_TpKey, _TpItem, _Alloc, cgt::base::iterator::_TpCommon>  _SelfCommon;
-        typedef hash<_TpKey, _TpItem, _Alloc>                                               _Hash;
+        typedef _HashIteratorBase<_TpKey, _TpItem, _Alloc, _TpFunc, cgt::base::iterator::_TpCommon>  _SelfCommon;
+        typedef hash<_TpKey, _TpItem, _Alloc, _TpFunc>                                      _Hash;
 
       public:
         _HashIteratorBase () : _Base (NULL), _ptr_hash (NULL) { }
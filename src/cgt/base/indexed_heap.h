@@ -0,0 +1,226 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/indexed_heap.h
+ * \brief Contains definition of a d-ary heap of indices that knows the position of each one.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_INDEXED_HEAP_H_
+#define __CGTL__CGT_BASE_INDEXED_HEAP_H_
+
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace base
+  {
+    /*!
+     * \class indexed_heap
+     * \brief A min-heap of indices (node ids, positions, etc.) with a key each, whose keys can decrease.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * The heap keeps, besides the array of indices in heap order, the key
+     * and the position in the heap of each index (in arrays by index), so
+     * contains is \b O(1), and decrease moves an index up from where it is
+     * in \b O(log n), with no search: unlike cgt::base::heap, whose
+     * modify_by finds the item and rebuilds the heap in \b O(n). Each node
+     * of the tree has \b _Arity children (4 by default), so the tree is
+     * shallower than a binary one and the children of a node are
+     * contiguous in memory: pushes and decreases (the most frequent
+     * operations in Dijkstra and Prim) take fewer steps, for a few more
+     * comparisons in pop.
+     *
+     * Indices with the same key are popped from the lowest on. The arrays
+     * by index grow to the greatest index pushed.
+     */
+
+    template<typename _TpKey, size_t _Arity = 4>
+      class indexed_heap
+      {
+        public:
+          static const size_t npos = static_cast<size_t>(-1);
+
+        public:
+          const bool empty () const { return _items.empty (); }
+          size_t size () const { return _items.size (); }
+
+          /** the index with the lowest key */
+          const size_t& top () const { return _items [0]; }
+          const _TpKey& top_key () const { return _keys [_items [0]]; }
+
+          const bool contains (const size_t& _i) const { return (_i < _pos.size () && _pos [_i] != npos); }
+
+          /** the key of \b _i (the last one it had, if it's not in the heap) */
+          const _TpKey& key (const size_t& _i) const { return _keys [_i]; }
+
+        public:
+          /** inserts \b _i, that can't be in the heap, with key \b _key */
+          void push (const size_t& _i, const _TpKey& _key);
+
+          /** lowers the key of \b _i, that must be in the heap, to \b _key */
+          void decrease (const size_t& _i, const _TpKey& _key) { _keys [_i] = _key; _up (_pos [_i], _i); }
+
+          /** inserts \b _i, or lowers its key if it's greater than \b _key: false if nothing changed */
+          bool push_or_decrease (const size_t& _i, const _TpKey& _key);
+
+          /** removes the index with the lowest key, and returns it */
+          size_t pop ();
+
+          /** removes all indices, keeping the arrays */
+          void clear ();
+
+          /** makes room for indices up to \b _n - 1 */
+          void reserve (const size_t& _n) { _items.reserve (_n); _pos.reserve (_n); _keys.reserve (_n); }
+
+        private:
+          const bool _less (const size_t& _a, const size_t& _b) const
+          {
+            return (_keys [_a] < _keys [_b] || (! (_keys [_b] < _keys [_a]) && _a < _b));
+          }
+
+          /** puts \b _i in the position \b _p, or above it */
+          void _up (size_t _p, const size_t& _i);
+
+          /** puts \b _i in the position \b _p, or below it */
+          void _down (size_t _p, const size_t& _i);
+
+        private:
+          array<size_t> _items; /** < the indices, in heap order */
+          array<size_t> _pos;   /** < index -> its position in _items (npos if it's not in the heap) */
+          array<_TpKey> _keys;  /** < index -> its key */
+      };
+
+    template<typename _TpKey, size_t _Arity>
+      const size_t indexed_heap<_TpKey, _Arity>::npos;
+
+    template<typename _TpKey, size_t _Arity>
+      void indexed_heap<_TpKey, _Arity>::push (const size_t& _i, const _TpKey& _key)
+      {
+        if (_i >= _pos.size ())
+        {
+          _pos.resize (_i + 1, npos);
+          _keys.resize (_i + 1, _key);
+        }
+
+        _keys [_i] = _key;
+        _items.push_back (_i);
+        _up (_items.size () - 1, _i);
+      }
+
+    template<typename _TpKey, size_t _Arity>
+      bool indexed_heap<_TpKey, _Arity>::push_or_decrease (const size_t& _i, const _TpKey& _key)
+      {
+        if (! contains (_i))
+          push (_i, _key);
+        else if (_key < _keys [_i])
+          decrease (_i, _key);
+        else
+          return false;
+
+        return true;
+      }
+
+    template<typename _TpKey, size_t _Arity>
+      size_t indexed_heap<_TpKey, _Arity>::pop ()
+      {
+        size_t _top = _items [0];
+        size_t _last = _items.back ();
+
+        _pos [_top] = npos;
+        _items.pop_back ();
+
+        if (! _items.empty ())
+          _down (0, _last);
+
+        return _top;
+      }
+
+    template<typename _TpKey, size_t _Arity>
+      void indexed_heap<_TpKey, _Arity>::clear ()
+      {
+        for (size_t i = 0; i < _items.size (); i++)
+          _pos [_items [i]] = npos;
+
+        _items.clear ();
+      }
+
+    template<typename _TpKey, size_t _Arity>
+      void indexed_heap<_TpKey, _Arity>::_up (size_t _p, const size_t& _i)
+      {
+        while (_p > 0)
+        {
+          size_t _parent = (_p - 1) / _Arity;
+
+          if (! _less (_i, _items [_parent]))
+            break;
+
+          _items [_p] = _items [_parent];
+          _pos [_items [_p]] = _p;
+          _p = _parent;
+        }
+
+        _items [_p] = _i;
+        _pos [_i] = _p;
+      }
+
+    template<typename _TpKey, size_t _Arity>
+      void indexed_heap<_TpKey, _Arity>::_down (size_t _p, const size_t& _i)
+      {
+        size_t _size = _items.size ();
+
+        while (true)
+        {
+          size_t _c = _Arity * _p + 1;
+
+          if (_c >= _size)
+            break;
+
+          size_t _best = _c;
+          size_t _end = (_c + _Arity < _size ? _c + _Arity : _size);
+
+          for (size_t k = _c + 1; k < _end; k++)
+            if (_less (_items [k], _items [_best]))
+              _best = k;
+
+          if (! _less (_items [_best], _i))
+            break;
+
+          _items [_p] = _items [_best];
+          _pos [_items [_p]] = _p;
+          _p = _best;
+        }
+
+        _items [_p] = _i;
+        _pos [_i] = _p;
+      }
+  }
+}
+
+#endif // __CGTL__CGT_BASE_INDEXED_HEAP_H_
@@ -36,6 +36,8 @@
 #include "cgt/base/list_item.h"
 #include "cgt/base/list_iterator.h"
 #include "cgt/base/alloc/allocator.h"
+#include "cgt/misc/cxx11.h"
+#include <new>
 
 
 namespace cgt
@@ -69,6 +71,10 @@ namespace cgt
      * |________________________________|
      *
      * \endcode
+     *
+     * The list also keeps its allocator (see cgt::base::alloc::_Allocator),
+     * which is copied with the list and exchanged by swap, so the copy of
+     * a list bound to an arena allocates from the same arena.
      */
 
     template<typename _TpItem, typename _Alloc>
@@ -87,7 +93,8 @@ namespace cgt
 
         protected:
           _List () : _head (NULL), _tail (NULL), _size (0) { }
-          _List (const _List& _l) : _head (NULL), _tail (NULL), _size (0) { *this = _l; }
+          explicit _List (const _Alloc& _a) : _alloc (_a), _head (NULL), _tail (NULL), _size (0) { }
+          _List (const _List& _l) : _alloc (_l._alloc), _head (NULL), _tail (NULL), _size (0) { *this = _l; }
           virtual ~_List () { _remove_all (); }
 
         public:
@@ -104,10 +111,15 @@ namespace cgt
         protected:
           _TpItem& _push_front (const _TpItem& _item);
           iterator _push_back (const _TpItem& _item);
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+          template<typename... _Args>
+            iterator _emplace_back (_Args&&... _args);
+#endif
           _TpItem* _pop (_Item* _ptr_item);
           _TpItem& _get (_Item* _ptr_item) const;
           _Item* _find (const _TpItem& _item) const;
           void _remove (_Item* _ptr);
+          iterator _erase (const iterator& _it);
           void _remove_all ();
 
         public:
@@ -148,7 +160,7 @@ namespace cgt
       _ListItem<_TpItem>* _List<_TpItem, _Alloc>::_allocate (const _TpItem& _item)
       {
         _Item* _ptr = _alloc.allocate (1);
-        _alloc.construct (_ptr, _Item (_item));
+        new (static_cast<void*>(_ptr)) _Item (_item); // the item is copied once, not through a temporary _Item
         return _ptr;
       }
 
@@ -165,6 +177,17 @@ namespace cgt
         return _push_back (_allocate (_item));
       }
 
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+    template<typename _TpItem, typename _Alloc>
+      template<typename... _Args>
+      _ListIterator<_TpItem> _List<_TpItem, _Alloc>::_emplace_back (_Args&&... _args)
+      {
+        _Item* _ptr = _alloc.allocate (1);
+        new (static_cast<void*>(_ptr)) _Item (_InPlace (), std::forward<_Args>(_args)...);
+        return _push_back (_ptr);
+      }
+#endif
+
     template<typename _TpItem, typename _Alloc>
       _ListIterator<_TpItem> _List<_TpItem, _Alloc>::_push_back (_Item *_ptr)
       {
@@ -269,6 +292,17 @@ namespace cgt
         }
       }
 
+    template<typename _TpItem, typename _Alloc>
+      _ListIterator<_TpItem> _List<_TpItem, _Alloc>::_erase (const iterator& _it)
+      {
+        _Item* _ptr = static_cast<_Item *>(_it._ptr);
+        iterator _next (static_cast<_Item *>(_ptr->_next));
+
+        _remove (_ptr);
+
+        return _next;
+      }
+
     template<typename _TpItem, typename _Alloc>
       void _List<_TpItem, _Alloc>::_remove_all ()
       {
@@ -366,6 +400,10 @@ namespace cgt
         size_t _s = _list1._size;
         _list1._size = _list2._size;
         _list2._size = _s;
+
+        allocator_type _a = _list1._alloc;
+        _list1._alloc = _list2._alloc;
+        _list2._alloc = _a;
       }
 
     /*!
@@ -385,6 +423,7 @@ namespace cgt
 
       public:
         list () : _Base () { }
+        explicit list (const _Alloc& _a) : _Base (_a) { }
         explicit list (const list& _l) : _Base (_l) { }
         virtual ~list () { }
 
@@ -394,6 +433,13 @@ namespace cgt
         inline _TpItem& push_front (const _TpItem& _item) { return _Base::_push_front (_item); }
         //inline _TpItem& push_back (const _TpItem& _item) { return _Base::_push_back (_item); }
         inline typename _Base::iterator push_back (const _TpItem& _item) { return _Base::_push_back (_item); }
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+        inline typename _Base::iterator push_back (_TpItem&& _item) { return _Base::_emplace_back (std::move (_item)); }
+
+        /** builds the item at the end of the list, from \b _args, with no copy */
+        template<typename... _Args>
+          inline typename _Base::iterator emplace_back (_Args&&... _args) { return _Base::_emplace_back (std::forward<_Args>(_args)...); }
+#endif
         inline _TpItem* pop_front () { return _pop (_Base::_head); }
         inline _TpItem* pop_back () {return _pop (_Base::_tail); }
         //inline _TpItem* front () { return _get (_Base::_head); }
@@ -405,6 +451,9 @@ namespace cgt
         //inline const _TpItem* const back () const { return _get (_Base::_tail); }
         inline _TpItem& back () const { return _get (_Base::_tail); }
         inline void remove (const _TpItem& _item) { _Base::_remove (_Base::_find (_item)); }
+
+        /** removes the item at \b _it, with no search: returns the next one */
+        inline typename _Base::iterator erase (const typename _Base::iterator& _it) { return _Base::_erase (_it); }
         inline void clear () { _Base::_remove_all (); }
         inline const size_t size () const { return _Base::_size; }
         inline const bool empty () const { return (! _Base::_size); }
@@ -35,12 +35,18 @@
 
 #include "cgt/base/list_item_base.h"
 #include "cgt/base/list_iterator.h"
+#include "cgt/misc/cxx11.h"
 
 
 namespace cgt
 {
   namespace base
   {
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+    /** tag of the constructor of _ListItem that builds its data from any arguments */
+    struct _InPlace { };
+#endif
+
     /*!
      * \class _ListItem
      * \brief The item of a list. It contains an element (the data) and two pointers (next and prev).
@@ -56,6 +62,10 @@ namespace cgt
     {
       public:
         _ListItem (const _TpItem& _d) : _data (_d) { }
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+        template<typename... _Args>
+          explicit _ListItem (_InPlace, _Args&&... _args) : _data (std::forward<_Args>(_args)...) { }
+#endif
 
       public:
         _TpItem _data;
@@ -64,6 +64,10 @@ namespace cgt
         typedef typename _TpIterator<_TpItem>::pointer    pointer;
         typedef typename _TpIterator<_TpItem>::reference  reference;
 
+      private:
+        template<typename _TpI, typename _TpAlloc>
+          friend class _List;
+
       private:
         using _Base::_ptr;
 
@@ -0,0 +1,272 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/radix_heap.h
+ * \brief Contains definition of a monotone heap of indices with unsigned integer keys.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_RADIX_HEAP_H_
+#define __CGTL__CGT_BASE_RADIX_HEAP_H_
+
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace base
+  {
+    /** the number of bits needed to write \b _w (0 for 0) */
+    inline size_t _bit_length (unsigned long _w)
+    {
+#ifdef __GNUC__
+      return (_w ? 8 * sizeof (unsigned long) - __builtin_clzl (_w) : 0);
+#else
+      size_t _b = 0;
+
+      for (; _w; _w >>= 1)
+        _b++;
+
+      return _b;
+#endif
+    }
+
+
+    /*!
+     * \class radix_heap
+     * \brief A monotone min-heap of indices with an unsigned integer key each, whose keys can decrease.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * It has the interface of cgt::base::indexed_heap, for keys that never
+     * go below the key of the last index popped, as in Dijkstra Algorithm.
+     * Indices are kept in <b>B + 1</b> buckets, for keys of \b B bits:
+     * bucket 0 has the indices whose key is the last one popped, and bucket
+     * \b b > 0 the ones whose key differs from it first in bit <b>b - 1</b>
+     * (counting from the lowest). When bucket 0 is empty, the lowest key of
+     * the first bucket that isn't becomes the last one, and the indices of
+     * that bucket are moved to lower buckets. An index only moves down, so
+     * push and decrease are \b O(1), with no comparisons between keys, and
+     * pop is amortized \b O(B).
+     *
+     * Buckets are lists linked through arrays by index, as are the keys.
+     * Indices with the same key aren't popped in any particular order, and
+     * top and top_key may move indices between buckets (so they aren't
+     * const).
+     */
+
+    template<typename _TpKey>
+      class radix_heap
+      {
+        public:
+          static const size_t npos = static_cast<size_t>(-1);
+
+        private:
+          enum { _BUCKETS = 8 * sizeof (_TpKey) + 1 };
+
+        public:
+          radix_heap () : _size (0), _last (0) { for (size_t b = 0; b < _BUCKETS; b++) _head [b] = npos; }
+
+        public:
+          const bool empty () const { return (_size == 0); }
+          size_t size () const { return _size; }
+
+          /** the index with the lowest key */
+          const size_t& top () { _refill (); return _head [0]; }
+          const _TpKey& top_key () { return _keys [top ()]; }
+
+          const bool contains (const size_t& _i) const { return (_i < _bucket.size () && _bucket [_i] != npos); }
+
+          /** the key of \b _i (the last one it had, if it's not in the heap) */
+          const _TpKey& key (const size_t& _i) const { return _keys [_i]; }
+
+        public:
+          /** inserts \b _i, that can't be in the heap, with key \b _key (not lower than the last key popped) */
+          void push (const size_t& _i, const _TpKey& _key);
+
+          /** lowers the key of \b _i, that must be in the heap, to \b _key (not lower than the last key popped) */
+          void decrease (const size_t& _i, const _TpKey& _key) { _unlink (_i); _keys [_i] = _key; _link (_i); }
+
+          /** inserts \b _i, or lowers its key if it's greater than \b _key: false if nothing changed */
+          bool push_or_decrease (const size_t& _i, const _TpKey& _key);
+
+          /** removes the index with the lowest key, and returns it */
+          size_t pop ();
+
+          /** removes all indices, keeping the arrays: the next keys can be as low as 0 */
+          void clear ();
+
+          /** makes room for indices up to \b _n - 1 */
+          void reserve (const size_t& _n) { _next.reserve (_n); _prev.reserve (_n); _bucket.reserve (_n); _keys.reserve (_n); }
+
+        private:
+          size_t _bucket_of (const _TpKey& _key) const { return _bit_length (static_cast<unsigned long>(_key ^ _last)); }
+
+          /** puts \b _i in the bucket of its key */
+          void _link (const size_t& _i);
+          void _unlink (const size_t& _i);
+
+          /** if bucket 0 is empty, takes the lowest key as the last one, and moves the indices of its bucket down */
+          void _refill ();
+
+        private:
+          size_t        _head [_BUCKETS]; /** < the first index of each bucket */
+          size_t        _size;
+          _TpKey        _last;            /** < the last key popped: no key is lower */
+
+          array<size_t> _next;    /** < index -> the next index of its bucket */
+          array<size_t> _prev;    /** < index -> the previous index of its bucket */
+          array<size_t> _bucket;  /** < index -> its bucket (npos if it's not in the heap) */
+          array<_TpKey> _keys;    /** < index -> its key */
+      };
+
+    template<typename _TpKey>
+      const size_t radix_heap<_TpKey>::npos;
+
+    template<typename _TpKey>
+      void radix_heap<_TpKey>::push (const size_t& _i, const _TpKey& _key)
+      {
+        if (_i >= _bucket.size ())
+        {
+          _next.resize (_i + 1, npos);
+          _prev.resize (_i + 1, npos);
+          _bucket.resize (_i + 1, npos);
+          _keys.resize (_i + 1, _key);
+        }
+
+        _keys [_i] = _key;
+        _link (_i);
+        _size++;
+      }
+
+    template<typename _TpKey>
+      bool radix_heap<_TpKey>::push_or_decrease (const size_t& _i, const _TpKey& _key)
+      {
+        if (! contains (_i))
+          push (_i, _key);
+        else if (_key < _keys [_i])
+          decrease (_i, _key);
+        else
+          return false;
+
+        return true;
+      }
+
+    template<typename _TpKey>
+      size_t radix_heap<_TpKey>::pop ()
+      {
+        size_t _top = top ();
+
+        _unlink (_top);
+        _size--;
+
+        return _top;
+      }
+
+    template<typename _TpKey>
+      void radix_heap<_TpKey>::clear ()
+      {
+        for (size_t b = 0; b < _BUCKETS; b++)
+        {
+          for (size_t i = _head [b]; i != npos; i = _next [i])
+            _bucket [i] = npos;
+
+          _head [b] = npos;
+        }
+
+        _size = 0;
+        _last = 0;
+      }
+
+    template<typename _TpKey>
+      void radix_heap<_TpKey>::_link (const size_t& _i)
+      {
+        size_t _b = _bucket_of (_keys [_i]);
+
+        _bucket [_i] = _b;
+        _prev [_i] = npos;
+        _next [_i] = _head [_b];
+
+        if (_head [_b] != npos)
+          _prev [_head [_b]] = _i;
+
+        _head [_b] = _i;
+      }
+
+    template<typename _TpKey>
+      void radix_heap<_TpKey>::_unlink (const size_t& _i)
+      {
+        if (_prev [_i] != npos)
+          _next [_prev [_i]] = _next [_i];
+        else
+          _head [_bucket [_i]] = _next [_i];
+
+        if (_next [_i] != npos)
+          _prev [_next [_i]] = _prev [_i];
+
+        _bucket [_i] = npos;
+      }
+
+    template<typename _TpKey>
+      void radix_heap<_TpKey>::_refill ()
+      {
+        if (_head [0] != npos || _size == 0)
+          return;
+
+        size_t _b = 1;
+
+        while (_head [_b] == npos)
+          _b++;
+
+        /*
+         * all keys of bucket _b are lower than the keys of the buckets
+         * above it: the lowest one is the lowest of the heap
+         */
+
+        size_t i = _head [_b];
+        _last = _keys [i];
+
+        for (i = _next [i]; i != npos; i = _next [i])
+          if (_keys [i] < _last)
+            _last = _keys [i];
+
+        /* the keys of bucket _b differ from the new _last below bit _b - 1 */
+
+        i = _head [_b];
+        _head [_b] = npos;
+
+        while (i != npos)
+        {
+          size_t _n = _next [i];
+          _link (i);
+          i = _n;
+        }
+      }
+  }
+}
+
+#endif // __CGTL__CGT_BASE_RADIX_HEAP_H_
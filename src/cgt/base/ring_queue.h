@@ -0,0 +1,129 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/ring_queue.h
+ * \brief Contains definition of a queue container kept in a ring buffer.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_RING_QUEUE_H_
+#define __CGTL__CGT_BASE_RING_QUEUE_H_
+
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace base
+  {
+    /*!
+     * \class ring_queue
+     * \brief A queue container kept in a ring buffer, for the states of searches.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * The items are kept in an array whose size is a power of 2, from the
+     * position of the first item on, wrapping around the end. The array
+     * doubles when it's full (the items are copied in order to the new
+     * one), so enqueue is amortized \b O(1), and dequeue doesn't allocate
+     * or free anything: unlike cgt::base::queue, there's no list item for
+     * each item, and dequeue doesn't return a copy that must be deleted.
+     *
+     * The reference returned by dequeue is valid until the next item is
+     * enqueued; the one returned by first, until the queue grows.
+     */
+
+    template<typename _TpItem>
+      class ring_queue
+      {
+        public:
+          ring_queue () : _head (0), _size (0) { }
+
+        public:
+          void insert (const _TpItem &_item) { enqueue (_item); }
+          void enqueue (const _TpItem &_item);
+          const _TpItem& dequeue ();
+          _TpItem& first () { return _items [_head]; }
+          const _TpItem& first () const { return _items [_head]; }
+
+        public:
+          size_t size () const { return _size; }
+          const bool empty () const { return (! _size); }
+          size_t capacity () const { return _items.size (); }
+
+          /** removes all items, keeping the buffer */
+          void clear () { _head = _size = 0; }
+
+        private:
+          /** doubles the buffer: new positions are filled with copies of \b _item */
+          void _grow (const _TpItem &_item);
+
+        private:
+          array<_TpItem>  _items;
+          size_t          _head;  /** < the position of the first item */
+          size_t          _size;
+      };
+
+    template<typename _TpItem>
+      void ring_queue<_TpItem>::enqueue (const _TpItem &_item)
+      {
+        if (_size == _items.size ())
+          _grow (_item);
+
+        _items [(_head + _size) & (_items.size () - 1)] = _item;
+        _size++;
+      }
+
+    template<typename _TpItem>
+      const _TpItem& ring_queue<_TpItem>::dequeue ()
+      {
+        const _TpItem& _item = _items [_head];
+
+        _head = (_head + 1) & (_items.size () - 1);
+        _size--;
+
+        return _item;
+      }
+
+    template<typename _TpItem>
+      void ring_queue<_TpItem>::_grow (const _TpItem &_item)
+      {
+        size_t _c = (_items.size () ? 2 * _items.size () : 16);
+        array<_TpItem> _new;
+        _new.reserve (_c);
+
+        for (size_t i = 0; i < _size; i++)
+          _new.push_back (_items [(_head + i) & (_items.size () - 1)]);
+
+        _new.resize (_c, _item);
+        _items.swap (_new);
+        _head = 0;
+      }
+  }
+}
+
+#endif // __CGTL__CGT_BASE_RING_QUEUE_H_
@@ -0,0 +1,107 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/shared.h
+ * \brief Contains definition of a reference-counted pointer, for state shared by copies of iterators.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_SHARED_H_
+#define __CGTL__CGT_BASE_SHARED_H_
+
+#include <cstddef>
+
+
+namespace cgt
+{
+  namespace base
+  {
+    /*!
+     * \class _Shared
+     * \brief A pointer to an item that is deleted with the last copy of the pointer.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * The item is allocated by the caller (\b new) and kept with a counter
+     * of the copies of the pointer, so copying or assigning a _Shared is
+     * \b O(1), whatever the size of the item. It's used by the algorithm
+     * iterators (see _SearchIterator, _SCCIterator and _DijkstraIterator),
+     * whose copies share the state of their search. The counter isn't
+     * atomic: copies shouldn't be used by many threads at once.
+     */
+
+    template<typename _TpItem>
+      class _Shared
+      {
+        private:
+          struct _Holder
+          {
+            _Holder (_TpItem* const _p) : _ptr (_p), _refs (1) { }
+            ~_Holder () { delete _ptr; }
+
+            _TpItem*  _ptr;
+            size_t    _refs;
+          };
+
+        public:
+          _Shared () : _ptr_holder (NULL) { }
+          explicit _Shared (_TpItem* const _p) : _ptr_holder (_p ? new _Holder (_p) : NULL) { }
+          _Shared (const _Shared& _s) : _ptr_holder (_s._ptr_holder) { _acquire (); }
+          ~_Shared () { _release (); }
+
+        public:
+          _Shared& operator=(const _Shared& _s)
+          {
+            if (_ptr_holder != _s._ptr_holder)
+            {
+              _release ();
+              _ptr_holder = _s._ptr_holder;
+              _acquire ();
+            }
+
+            return *this;
+          }
+
+        public:
+          _TpItem* get () const { return (_ptr_holder ? _ptr_holder->_ptr : NULL); }
+          _TpItem& operator*() const { return *(_ptr_holder->_ptr); }
+          _TpItem* operator->() const { return _ptr_holder->_ptr; }
+
+          /** the number of copies of the pointer (0 if it's NULL) */
+          size_t use_count () const { return (_ptr_holder ? _ptr_holder->_refs : 0); }
+
+        private:
+          void _acquire () { if (_ptr_holder) _ptr_holder->_refs++; }
+          void _release () { if (_ptr_holder && --(_ptr_holder->_refs) == 0) delete _ptr_holder; _ptr_holder = NULL; }
+
+        private:
+          _Holder*  _ptr_holder;
+      };
+  }
+}
+
+#endif // __CGTL__CGT_BASE_SHARED_H_
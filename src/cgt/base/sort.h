@@ -0,0 +1,95 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/base/sort.h
+ * \brief Contains a stable sort for arrays.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_BASE_SORT_H_
+#define __CGTL__CGT_BASE_SORT_H_
+
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace base
+  {
+    /*!
+     * \fn void sort (array<_TpItem>& _a, const _TpLess& _less)
+     * \brief Sorts the array \b _a by \b _less, keeping the order of equal items.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * A bottom-up merge sort: time complexity \b O(n log n), and a copy
+     * of the array as auxiliary space. \b _less is a functor with a
+     * <b>bool operator()(const _TpItem&, const _TpItem&) const</b>.
+     */
+
+    template<typename _TpItem, typename _TpLess>
+      void sort (array<_TpItem>& _a, const _TpLess& _less)
+      {
+        size_t _n = _a.size ();
+
+        if (_n < 2)
+          return;
+
+        array<_TpItem> _b (_a);
+        array<_TpItem>* _src = &_a;
+        array<_TpItem>* _dst = &_b;
+
+        for (size_t _width = 1; _width < _n; _width *= 2)
+        {
+          for (size_t _lo = 0; _lo < _n; _lo += 2 * _width)
+          {
+            size_t _mid = (_lo + _width < _n ? _lo + _width : _n);
+            size_t _hi = (_lo + 2 * _width < _n ? _lo + 2 * _width : _n);
+            size_t i = _lo, j = _mid, k = _lo;
+
+            while (i < _mid && j < _hi)
+              (*_dst) [k++] = (_less ((*_src) [j], (*_src) [i]) ? (*_src) [j++] : (*_src) [i++]);
+
+            while (i < _mid)
+              (*_dst) [k++] = (*_src) [i++];
+
+            while (j < _hi)
+              (*_dst) [k++] = (*_src) [j++];
+          }
+
+          array<_TpItem>* _p = _src;
+          _src = _dst;
+          _dst = _p;
+        }
+
+        if (_src != &_a)
+          _a.swap (_b);
+      }
+  }
+}
+
+#endif // __CGTL__CGT_BASE_SORT_H_
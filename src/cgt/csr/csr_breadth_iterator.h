@@ -0,0 +1,129 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_breadth_iterator.h
+ * \brief Contains the definition of the breadth-first search iterator on CSR snapshots.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_BREADTH_ITERATOR_H_
+#define __CGTL__CGT_CSR_CSR_BREADTH_ITERATOR_H_
+
+#include "cgt/csr/csr_search_iterator.h"
+
+
+namespace cgt
+{
+  namespace csr
+  {
+    /*!
+     * \class _CSRBreadthIterator
+     * \brief An iterator that implements breadth-first search on a CSR snapshot.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * It visits nodes in the same order of cgt::search::breadth::_BreadthIterator
+     * (when the queue gets empty, the search goes on from the first WHITE node,
+     * in the order of ids), but each step costs O(1) amortized instead of
+     * a search in the list of infos: the whole search is O(V + E).
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRBreadthIterator : public _CSRSearchIterator<_TpVertex, _TpEdge>
+      {
+        private:
+          typedef _CSRSearchIterator<_TpVertex, _TpEdge>  _Base;
+          typedef _CSRBreadthIterator<_TpVertex, _TpEdge> _Self;
+          typedef typename _Base::_CSR                    _CSR;
+          typedef typename _Base::_State                  _State;
+
+        private:
+          using _Base::_csr;
+          using _Base::_id;
+          using _Base::_head;
+          using _Base::_states;
+          using _Base::_color;
+
+        public:
+          _CSRBreadthIterator () { }
+          _CSRBreadthIterator (const _CSR* const _ptr_csr, const size_t& _i) : _Base (_ptr_csr, _i) { }
+
+        public:
+          _Self& operator++();
+          const _Self operator++(int) { _Self _it = *this; operator++(); return _it; }
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRBreadthIterator<_TpVertex, _TpEdge>& _CSRBreadthIterator<_TpVertex, _TpEdge>::operator++()
+      {
+        /*
+         * visit the adjacencies of the queue's front node:
+         *  - if a WHITE node is found, discover it (enqueue) and turn it the current node;
+         *  - if there is no more WHITE nodes, dequeue the front node and finish it.
+         * if the queue is empty, discover the next WHITE node.
+         */
+
+        _id = _CSR::npos;
+
+        while (_head < _states.size ())
+        {
+          size_t _u   = _states [_head]._id;
+          size_t _end = _csr->adj_end (_u);
+          size_t _pos = _states [_head]._pos;
+
+          while (_pos < _end)
+          {
+            size_t _v = _csr->target (_pos++);
+
+            if (_color [_v] == _Base::WHITE)
+            {
+              _id = _v;
+              break;
+            }
+          }
+
+          _states [_head]._pos = _pos;
+
+          if (_id != _CSR::npos)
+          {
+            this->_discover_node (_id, _u);
+            break;
+          }
+
+          this->_finish_node (_u);
+          _head++;
+        }
+
+        if (_id == _CSR::npos)
+          this->_discover_next_root ();
+
+        return *this;
+      }
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_BREADTH_ITERATOR_H_
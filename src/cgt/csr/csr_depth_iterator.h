@@ -0,0 +1,127 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_depth_iterator.h
+ * \brief Contains the definition of the depth-first search iterator on CSR snapshots.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_DEPTH_ITERATOR_H_
+#define __CGTL__CGT_CSR_CSR_DEPTH_ITERATOR_H_
+
+#include "cgt/csr/csr_search_iterator.h"
+
+
+namespace cgt
+{
+  namespace csr
+  {
+    /*!
+     * \class _CSRDepthIterator
+     * \brief An iterator that implements depth-first search on a CSR snapshot.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * It visits nodes in the same order of cgt::search::depth::_DepthIterator
+     * (when the stack gets empty, the search goes on from the first WHITE node,
+     * in the order of ids), with discovery and finish times, in O(V + E).
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRDepthIterator : public _CSRSearchIterator<_TpVertex, _TpEdge>
+      {
+        private:
+          typedef _CSRSearchIterator<_TpVertex, _TpEdge>  _Base;
+          typedef _CSRDepthIterator<_TpVertex, _TpEdge>   _Self;
+          typedef typename _Base::_CSR                    _CSR;
+          typedef typename _Base::_State                  _State;
+
+        private:
+          using _Base::_csr;
+          using _Base::_id;
+          using _Base::_states;
+          using _Base::_color;
+
+        public:
+          _CSRDepthIterator () { }
+          _CSRDepthIterator (const _CSR* const _ptr_csr, const size_t& _i) : _Base (_ptr_csr, _i) { }
+
+        public:
+          _Self& operator++();
+          const _Self operator++(int) { _Self _it = *this; operator++(); return _it; }
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRDepthIterator<_TpVertex, _TpEdge>& _CSRDepthIterator<_TpVertex, _TpEdge>::operator++()
+      {
+        /*
+         * visit the adjacencies of the stack's top node:
+         *  - if a WHITE node is found, discover it (push) and turn it the current node;
+         *  - if there is no more WHITE nodes, pop the top node and finish it.
+         * if the stack is empty, discover the next WHITE node.
+         */
+
+        _id = _CSR::npos;
+
+        while (! _states.empty ())
+        {
+          size_t _u   = _states.back ()._id;
+          size_t _end = _csr->adj_end (_u);
+          size_t _pos = _states.back ()._pos;
+
+          while (_pos < _end)
+          {
+            size_t _v = _csr->target (_pos++);
+
+            if (_color [_v] == _Base::WHITE)
+            {
+              _id = _v;
+              break;
+            }
+          }
+
+          _states.back ()._pos = _pos;
+
+          if (_id != _CSR::npos)
+          {
+            this->_discover_node (_id, _u);
+            break;
+          }
+
+          this->_finish_node (_u);
+          _states.pop_back ();
+        }
+
+        if (_id == _CSR::npos)
+          this->_discover_next_root ();
+
+        return *this;
+      }
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_DEPTH_ITERATOR_H_
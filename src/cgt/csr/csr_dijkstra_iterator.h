@@ -0,0 +1,176 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_dijkstra_iterator.h
+ * \brief Contains the definition of the Dijkstra iterator on CSR snapshots.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_DIJKSTRA_ITERATOR_H_
+#define __CGTL__CGT_CSR_CSR_DIJKSTRA_ITERATOR_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/base/array.h"
+#include "cgt/csr/csr_heap.h"
+#include "cgt/shortpath/single/dijkstra/dijkstra_distance.h"
+
+
+namespace cgt
+{
+  namespace csr
+  {
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRGraph;
+
+    /*!
+     * \class _CSRDijkstraIterator
+     * \brief An iterator that implements Dijkstra algorithm on a CSR snapshot.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * Like cgt::shortpath::single::dijkstra::_DijkstraIterator, it returns
+     * the source and then the nodes reachable from it, in order of distance.
+     * Distances and previous nodes are kept in arrays indexed by node id, and
+     * only reached nodes enter the heap (a node is pushed again when its
+     * distance decreases, and the old entry is discarded when popped), so
+     * the whole iteration is O((V + E) log V).
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRDijkstraIterator
+      {
+        private:
+          typedef _CSRDijkstraIterator<_TpVertex, _TpEdge>  _Self;
+          typedef _CSRGraph<_TpVertex, _TpEdge>             _CSR;
+          typedef _GraphNode<_TpVertex, _TpEdge>            _Node;
+
+        public:
+          typedef cgt::shortpath::single::dijkstra::_DijkstraDistance<_TpEdge> _Distance;
+
+        public:
+          _CSRDijkstraIterator () : _csr (NULL), _id (static_cast<size_t>(-1)) { }
+          _CSRDijkstraIterator (const _CSR* const _ptr_csr, const size_t& _i);
+
+        private:
+          void _settle (const size_t& _u);
+
+        public:
+          size_t id () const { return _id; }
+          const _Node& operator*() const { return _csr->node (_id); }
+          const _Node* operator->() const { return &(_csr->node (_id)); }
+          const bool operator==(const _Self& _other) const { return _id == _other._id; }
+          const bool operator!=(const _Self& _other) const { return !(*this == _other); }
+          _Self& operator++();
+          const _Self operator++(int) { _Self _it = *this; operator++(); return _it; }
+
+        public:
+          const bool& inf_distance (const size_t& _i) const { return _distance [_i].inf_distance (); }
+          const _TpEdge& distance (const size_t& _i) const { return _distance [_i].distance (); }
+          /** the previous node of \b _i in the shortest path, or \b npos */
+          const size_t& previous (const size_t& _i) const { return _previous [_i]; }
+
+        private:
+          const _CSR*                 _csr;
+          size_t                      _id;
+          cgt::base::array<_Distance> _distance;
+          cgt::base::array<size_t>    _previous;
+          cgt::base::array<bool>      _settled;
+          _CSRHeap<_TpEdge>           _heap;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRDijkstraIterator<_TpVertex, _TpEdge>::_CSRDijkstraIterator (const _CSR* const _ptr_csr, const size_t& _i)
+      : _csr (_ptr_csr), _id (static_cast<size_t>(-1))
+      {
+        size_t _n = _csr->num_vertices ();
+
+        if (_i < _n)
+        {
+          _distance.resize (_n, _Distance ());
+          _previous.resize (_n, static_cast<size_t>(-1));
+          _settled.resize (_n, false);
+
+          _id = _i;
+          _distance [_i].set_origin ();
+          _settle (_i);
+        }
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CSRDijkstraIterator<_TpVertex, _TpEdge>::_settle (const size_t& _u)
+      {
+        _settled [_u] = true;
+
+        size_t _end = _csr->adj_end (_u);
+
+        for (size_t _pos = _csr->adj_begin (_u); _pos < _end; _pos++)
+        {
+          size_t _v = _csr->target (_pos);
+
+          if (! _settled [_v])
+          {
+            _TpEdge _d = _distance [_u].distance () + _csr->weight (_pos);
+
+            if (_distance [_v].inf_distance () || _d < _distance [_v].distance ())
+            {
+              _distance [_v]._set_distance (_d);
+              _previous [_v] = _u;
+              _heap.push (_d, _v);
+            }
+          }
+        }
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRDijkstraIterator<_TpVertex, _TpEdge>& _CSRDijkstraIterator<_TpVertex, _TpEdge>::operator++()
+      {
+        /*
+         * pop the closest node not yet settled
+         * and relax its adjacencies.
+         */
+
+        _id = _CSR::npos;
+
+        while (! _heap.empty ())
+        {
+          size_t _v = _heap.top ();
+          _heap.pop ();
+
+          if (! _settled [_v])
+          {
+            _id = _v;
+            _settle (_v);
+            break;
+          }
+        }
+
+        return *this;
+      }
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_DIJKSTRA_ITERATOR_H_
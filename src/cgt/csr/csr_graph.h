@@ -0,0 +1,260 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_graph.h
+ * \brief Contains the definition of an immutable compressed sparse row (CSR) snapshot of a graph.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_GRAPH_H_
+#define __CGTL__CGT_CSR_CSR_GRAPH_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/graph_edge.h"
+#include "cgt/graph_adjlist.h"
+#include "cgt/base/array.h"
+
+#include "cgt/csr/csr_breadth_iterator.h"
+#include "cgt/csr/csr_depth_iterator.h"
+#include "cgt/csr/csr_dijkstra_iterator.h"
+#include "cgt/csr/csr_prim_iterator.h"
+#include "cgt/csr/csr_kruskal_iterator.h"
+#include "cgt/csr/csr_scc_iterator.h"
+#include "cgt/csr/csr_toposort_iterator.h"
+
+
+namespace cgt
+{
+  /*!
+   * \namespace cgt::csr
+   * \brief Where are defined the CSR snapshot of a graph and the iterators that run on it.
+   * \author Leandro Costa
+   * \date 2011
+   */
+
+  namespace csr
+  {
+    /*!
+     * \class _CSRGraphBase
+     * \brief The structure of a CSR snapshot, shared by weighted and unweighted graphs.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * Nodes keep their ids (_GraphNode::id (), the position in the node's list),
+     * and the adjacencies of node \b i are the positions <b>[_offsets [i], _offsets [i + 1])</b>
+     * of the arrays \b _targets (id of the linked node) and \b _edges (the edge, in
+     * the graph's edge list). Adjacencies keep the order of the adjacency lists,
+     * so iterators visit nodes in the same order they do in the graph.
+     *
+     * The snapshot needs <b>16 V + 16 E</b> bytes (plus the weights), and
+     * refers to nodes and edges of the graph: it's valid while the graph exists,
+     * and doesn't see nodes or edges inserted after freeze ().
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRGraphBase
+      {
+        public:
+          typedef _GraphNode<_TpVertex, _TpEdge>  _Node;
+          typedef _GraphEdge<_TpVertex, _TpEdge>  _Edge;
+
+        public:
+          static const size_t npos = static_cast<size_t>(-1); /** < an invalid id or position */
+
+        protected:
+          template<typename _TpNodeIterator>
+            _CSRGraphBase (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed);
+
+        public:
+          size_t num_vertices () const { return _nodes.size (); }
+          size_t num_edges () const { return _targets.size (); }
+          const bool is_directed () const { return _directed; }
+
+          /** the node with id \b _id */
+          const _Node& node (const size_t& _id) const { return *(_nodes [_id]); }
+
+          /** the id of the node \b _n, or \b npos if it doesn't belong to the snapshot */
+          size_t id (const _Node& _n) const { return (_n.id () < _nodes.size () && _nodes [_n.id ()] == &_n ? _n.id () : npos); }
+
+          size_t degree (const size_t& _id) const { return _offsets [_id + 1] - _offsets [_id]; }
+          size_t adj_begin (const size_t& _id) const { return _offsets [_id]; }
+          size_t adj_end (const size_t& _id) const { return _offsets [_id + 1]; }
+          size_t target (const size_t& _pos) const { return _targets [_pos]; }
+          const _Edge& edge (const size_t& _pos) const { return *(_edges [_pos]); }
+
+          const cgt::base::array<size_t>& offsets () const { return _offsets; }
+          const cgt::base::array<size_t>& targets () const { return _targets; }
+
+        protected:
+          cgt::base::array<const _Node*>  _nodes;   /** < id -> node */
+          cgt::base::array<size_t>        _offsets; /** < V + 1 offsets in _targets and _edges */
+          cgt::base::array<size_t>        _targets; /** < E ids of linked nodes */
+          cgt::base::array<const _Edge*>  _edges;   /** < E edges */
+          bool                            _directed;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      const size_t _CSRGraphBase<_TpVertex, _TpEdge>::npos;
+
+    template<typename _TpVertex, typename _TpEdge>
+      template<typename _TpNodeIterator>
+      _CSRGraphBase<_TpVertex, _TpEdge>::_CSRGraphBase (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed)
+      : _directed (_directed)
+      {
+        _TpNodeIterator _it;
+
+        for (_it = _it_begin; _it != _it_end; ++_it)
+        {
+          _nodes.push_back (&(*_it));
+        }
+
+        size_t _num_edges = 0;
+        _offsets.reserve (_nodes.size () + 1);
+
+        for (_it = _it_begin; _it != _it_end; ++_it)
+        {
+          _offsets.push_back (_num_edges);
+          _num_edges += _it->adjlist ().size ();
+        }
+
+        _offsets.push_back (_num_edges);
+        _targets.reserve (_num_edges);
+        _edges.reserve (_num_edges);
+
+        for (_it = _it_begin; _it != _it_end; ++_it)
+        {
+          typename _GraphAdjList<_TpVertex, _TpEdge>::const_iterator _itA    = _it->adjlist ().begin ();
+          typename _GraphAdjList<_TpVertex, _TpEdge>::const_iterator _itAEnd = _it->adjlist ().end ();
+
+          for (; _itA != _itAEnd; ++_itA)
+          {
+            _targets.push_back (_itA->node ().id ());
+            _edges.push_back (&(_itA->edge ()));
+          }
+        }
+      }
+
+
+    /*!
+     * \class _CSRGraph
+     * \brief An immutable compressed sparse row (CSR) snapshot of a graph, created by graph::freeze ().
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * Besides the structure defined by _CSRGraphBase, it keeps a copy of the
+     * edge values (the weights) in the array \b _weights, parallel to \b _targets,
+     * so weighted algorithms scan adjacencies sequentially.
+     *
+     * All search, shortest-path, minimum spanning tree, strongly connected
+     * components and topological sort iterators have a CSR counterpart,
+     * created by the methods below. They refer to nodes by id.
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRGraph : public _CSRGraphBase<_TpVertex, _TpEdge>
+      {
+        private:
+          typedef _CSRGraphBase<_TpVertex, _TpEdge> _Base;
+
+        public:
+          template<typename _TpNodeIterator>
+            _CSRGraph (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed)
+            : _Base (_it_begin, _it_end, _directed)
+            {
+              _weights.reserve (_Base::_edges.size ());
+
+              for (size_t i = 0; i < _Base::_edges.size (); i++)
+                _weights.push_back (_Base::_edges [i]->value ());
+            }
+
+        public:
+          const _TpEdge& weight (const size_t& _pos) const { return _weights [_pos]; }
+          const cgt::base::array<_TpEdge>& weights () const { return _weights; }
+
+        public:
+          typedef _CSRBreadthIterator<_TpVertex, _TpEdge>   biterator;
+          typedef _CSRDepthIterator<_TpVertex, _TpEdge>     diterator;
+          typedef _CSRDijkstraIterator<_TpVertex, _TpEdge>  djiterator;
+          typedef _CSRPrimIterator<_TpVertex, _TpEdge>      piterator;
+          typedef _CSRKruskalIterator<_TpVertex, _TpEdge>   kiterator;
+          typedef _CSRSCCIterator<_TpVertex, _TpEdge>       scciterator;
+          typedef _CSRToposortIterator<_TpVertex, _TpEdge>  tsiterator;
+
+          biterator bbegin (const size_t& _id = 0) const { return biterator (this, _id); }
+          biterator bend () const { return biterator (); }
+          diterator dbegin (const size_t& _id = 0) const { return diterator (this, _id); }
+          diterator dend () const { return diterator (); }
+          djiterator djbegin (const size_t& _id = 0) const { return djiterator (this, _id); }
+          djiterator djend () const { return djiterator (); }
+          piterator pbegin (const size_t& _id = 0) const { return piterator (this, _id); }
+          piterator pend () const { return piterator (); }
+          kiterator kbegin () const { return kiterator (this); }
+          kiterator kend () const { return kiterator (); }
+          scciterator sccbegin () const { return scciterator (this); }
+          scciterator sccend () const { return scciterator (); }
+          tsiterator tsbegin () const { return tsiterator (this); }
+          tsiterator tsend () const { return tsiterator (); }
+
+        private:
+          cgt::base::array<_TpEdge> _weights; /** < E edge values */
+      };
+
+
+    /*
+     * A simple graph, with no type for edges (so, no weights)
+     */
+
+    template<typename _TpVertex>
+      class _CSRGraph<_TpVertex, void> : public _CSRGraphBase<_TpVertex, void>
+      {
+        private:
+          typedef _CSRGraphBase<_TpVertex, void> _Base;
+
+        public:
+          template<typename _TpNodeIterator>
+            _CSRGraph (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed)
+            : _Base (_it_begin, _it_end, _directed) { }
+
+        public:
+          typedef _CSRBreadthIterator<_TpVertex, void>   biterator;
+          typedef _CSRDepthIterator<_TpVertex, void>     diterator;
+          typedef _CSRSCCIterator<_TpVertex, void>       scciterator;
+          typedef _CSRToposortIterator<_TpVertex, void>  tsiterator;
+
+          biterator bbegin (const size_t& _id = 0) const { return biterator (this, _id); }
+          biterator bend () const { return biterator (); }
+          diterator dbegin (const size_t& _id = 0) const { return diterator (this, _id); }
+          diterator dend () const { return diterator (); }
+          scciterator sccbegin () const { return scciterator (this); }
+          scciterator sccend () const { return scciterator (); }
+          tsiterator tsbegin () const { return tsiterator (this); }
+          tsiterator tsend () const { return tsiterator (); }
+      };
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_GRAPH_H_
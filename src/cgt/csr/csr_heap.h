@@ -0,0 +1,130 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_heap.h
+ * \brief Contains the definition of the heap used by iterators of CSR graphs.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_HEAP_H_
+#define __CGTL__CGT_CSR_CSR_HEAP_H_
+
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace csr
+  {
+    /*!
+     * \class _CSRHeap
+     * \brief A binary min-heap of (key, position) pairs stored in a contiguous array.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * The position is a vertex id or an edge position in the CSR arrays.
+     * Items are never modified in place: when a key decreases, a new item
+     * is pushed and the old one is discarded by the user when popped.
+     * Items with the same key are popped in order of position.
+     */
+
+    template<typename _TpKey>
+      class _CSRHeap
+      {
+        private:
+          struct _Item
+          {
+            _Item (const _TpKey& _k, const size_t& _p) : _key (_k), _pos (_p) { }
+
+            const bool operator<(const _Item& _i) const { return (_key < _i._key || (! (_i._key < _key) && _pos < _i._pos)); }
+
+            _TpKey  _key;
+            size_t  _pos;
+          };
+
+        public:
+          const bool empty () const { return _items.empty (); }
+          size_t size () const { return _items.size (); }
+          const _TpKey& top_key () const { return _items [0]._key; }
+          const size_t& top () const { return _items [0]._pos; }
+
+          void push (const _TpKey& _key, const size_t& _pos);
+          void pop ();
+
+        private:
+          cgt::base::array<_Item> _items;
+      };
+
+    template<typename _TpKey>
+      void _CSRHeap<_TpKey>::push (const _TpKey& _key, const size_t& _pos)
+      {
+        _Item _item (_key, _pos);
+        size_t _i = _items.size ();
+        _items.push_back (_item);
+
+        while (_i > 0 && _item < _items [(_i - 1) / 2])
+        {
+          _items [_i] = _items [(_i - 1) / 2];
+          _i = (_i - 1) / 2;
+        }
+
+        _items [_i] = _item;
+      }
+
+    template<typename _TpKey>
+      void _CSRHeap<_TpKey>::pop ()
+      {
+        _Item _item = _items.back ();
+        _items.pop_back ();
+
+        size_t _size = _items.size ();
+
+        if (_size)
+        {
+          size_t _i = 0;
+
+          while (2 * _i + 1 < _size)
+          {
+            size_t _c = 2 * _i + 1;
+
+            if (_c + 1 < _size && _items [_c + 1] < _items [_c])
+              _c++;
+
+            if (! (_items [_c] < _item))
+              break;
+
+            _items [_i] = _items [_c];
+            _i = _c;
+          }
+
+          _items [_i] = _item;
+        }
+      }
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_HEAP_H_
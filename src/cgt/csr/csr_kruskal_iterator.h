@@ -0,0 +1,171 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_kruskal_iterator.h
+ * \brief Contains the definition of the Kruskal iterator on CSR snapshots.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_KRUSKAL_ITERATOR_H_
+#define __CGTL__CGT_CSR_CSR_KRUSKAL_ITERATOR_H_
+
+#include "cgt/graph_edge.h"
+#include "cgt/base/array.h"
+#include "cgt/csr/csr_heap.h"
+
+
+namespace cgt
+{
+  namespace csr
+  {
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRGraph;
+
+    /*!
+     * \class _CSRKruskalIterator
+     * \brief An iterator that executes Kruskal algorithm on a CSR snapshot.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * Like cgt::minspantree::kruskal::_KruskalIterator, it returns the edges
+     * of a minimum spanning forest in increasing order of weight. The sets
+     * are kept in arrays indexed by node id (union by rank, path halving).
+     * Undirected graphs have each edge in two adjacency lists, so only the
+     * adjacency whose source id isn't greater than the target id is used.
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRKruskalIterator
+      {
+        private:
+          typedef _CSRKruskalIterator<_TpVertex, _TpEdge> _Self;
+          typedef _CSRGraph<_TpVertex, _TpEdge>           _CSR;
+          typedef _GraphEdge<_TpVertex, _TpEdge>          _Edge;
+
+        public:
+          _CSRKruskalIterator () : _csr (NULL), _pos (static_cast<size_t>(-1)) { }
+          _CSRKruskalIterator (const _CSR* const _ptr_csr);
+
+        private:
+          size_t _set_find (size_t _i)
+          {
+            while (_set [_i] != _i)
+            {
+              _set [_i] = _set [_set [_i]];
+              _i = _set [_i];
+            }
+
+            return _i;
+          }
+
+          void _set_union (size_t _i, size_t _j)
+          {
+            if (_rank [_i] > _rank [_j])
+              _set [_j] = _i;
+            else
+            {
+              _set [_i] = _j;
+
+              if (_rank [_i] == _rank [_j])
+                _rank [_j]++;
+            }
+          }
+
+          void _incr ();
+
+        public:
+          /** the adjacency position of the current edge */
+          size_t pos () const { return _pos; }
+          const _Edge& operator*() const { return _csr->edge (_pos); }
+          const _Edge* operator->() const { return &(_csr->edge (_pos)); }
+          const bool operator==(const _Self& _other) const { return _pos == _other._pos; }
+          const bool operator!=(const _Self& _other) const { return !(*this == _other); }
+          _Self& operator++() { _incr (); return *this; }
+          const _Self operator++(int) { _Self _it = *this; _incr (); return _it; }
+
+        private:
+          const _CSR*               _csr;
+          size_t                    _pos;
+          cgt::base::array<size_t>  _source; /** < the source id of each adjacency position */
+          cgt::base::array<size_t>  _set;
+          cgt::base::array<size_t>  _rank;
+          _CSRHeap<_TpEdge>         _heap;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRKruskalIterator<_TpVertex, _TpEdge>::_CSRKruskalIterator (const _CSR* const _ptr_csr)
+      : _csr (_ptr_csr), _pos (static_cast<size_t>(-1))
+      {
+        size_t _n = _csr->num_vertices ();
+
+        _source.resize (_csr->num_edges (), 0);
+        _set.reserve (_n);
+        _rank.resize (_n, 0);
+
+        for (size_t _u = 0; _u < _n; _u++)
+        {
+          _set.push_back (_u);
+
+          size_t _end = _csr->adj_end (_u);
+
+          for (size_t _p = _csr->adj_begin (_u); _p < _end; _p++)
+          {
+            _source [_p] = _u;
+
+            if (_csr->is_directed () || _u <= _csr->target (_p))
+              _heap.push (_csr->weight (_p), _p);
+          }
+        }
+
+        _incr ();
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CSRKruskalIterator<_TpVertex, _TpEdge>::_incr ()
+      {
+        _pos = _CSR::npos;
+
+        while (! _heap.empty ())
+        {
+          size_t _p = _heap.top ();
+          _heap.pop ();
+
+          size_t _i = _set_find (_source [_p]);
+          size_t _j = _set_find (_csr->target (_p));
+
+          if (_i != _j)
+          {
+            _set_union (_i, _j);
+            _pos = _p;
+            break;
+          }
+        }
+      }
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_KRUSKAL_ITERATOR_H_
@@ -0,0 +1,140 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_prim_iterator.h
+ * \brief Contains the definition of the Prim iterator on CSR snapshots.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_PRIM_ITERATOR_H_
+#define __CGTL__CGT_CSR_CSR_PRIM_ITERATOR_H_
+
+#include "cgt/graph_edge.h"
+#include "cgt/base/array.h"
+#include "cgt/csr/csr_heap.h"
+
+
+namespace cgt
+{
+  namespace csr
+  {
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRGraph;
+
+    /*!
+     * \class _CSRPrimIterator
+     * \brief An iterator that executes Prim algorithm on a CSR snapshot.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * Like cgt::minspantree::prim::_PrimIterator, it returns the edges of
+     * the minimum spanning tree of the component of the first node, in the
+     * order they're chosen. The heap keeps adjacency positions keyed by
+     * weight, and the nodes already in the tree are flagged in an array.
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRPrimIterator
+      {
+        private:
+          typedef _CSRPrimIterator<_TpVertex, _TpEdge>  _Self;
+          typedef _CSRGraph<_TpVertex, _TpEdge>         _CSR;
+          typedef _GraphEdge<_TpVertex, _TpEdge>        _Edge;
+
+        public:
+          _CSRPrimIterator () : _csr (NULL), _pos (static_cast<size_t>(-1)) { }
+          _CSRPrimIterator (const _CSR* const _ptr_csr, const size_t& _i);
+
+        private:
+          void _insert_node (const size_t& _u);
+          void _incr ();
+
+        public:
+          /** the adjacency position of the current edge */
+          size_t pos () const { return _pos; }
+          const _Edge& operator*() const { return _csr->edge (_pos); }
+          const _Edge* operator->() const { return &(_csr->edge (_pos)); }
+          const bool operator==(const _Self& _other) const { return _pos == _other._pos; }
+          const bool operator!=(const _Self& _other) const { return !(*this == _other); }
+          _Self& operator++() { _incr (); return *this; }
+          const _Self operator++(int) { _Self _it = *this; _incr (); return _it; }
+
+        private:
+          const _CSR*             _csr;
+          size_t                  _pos;
+          cgt::base::array<bool>  _tree;
+          _CSRHeap<_TpEdge>       _heap;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRPrimIterator<_TpVertex, _TpEdge>::_CSRPrimIterator (const _CSR* const _ptr_csr, const size_t& _i)
+      : _csr (_ptr_csr), _pos (static_cast<size_t>(-1))
+      {
+        if (_i < _csr->num_vertices ())
+        {
+          _tree.resize (_csr->num_vertices (), false);
+          _insert_node (_i);
+          _incr ();
+        }
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CSRPrimIterator<_TpVertex, _TpEdge>::_insert_node (const size_t& _u)
+      {
+        _tree [_u] = true;
+
+        size_t _end = _csr->adj_end (_u);
+
+        for (size_t _p = _csr->adj_begin (_u); _p < _end; _p++)
+        {
+          if (! _tree [_csr->target (_p)])
+            _heap.push (_csr->weight (_p), _p);
+        }
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CSRPrimIterator<_TpVertex, _TpEdge>::_incr ()
+      {
+        _pos = _CSR::npos;
+
+        while (! _heap.empty ())
+        {
+          size_t _p = _heap.top ();
+          _heap.pop ();
+
+          if (! _tree [_csr->target (_p)])
+          {
+            _pos = _p;
+            _insert_node (_csr->target (_p));
+            break;
+          }
+        }
+      }
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_PRIM_ITERATOR_H_
@@ -0,0 +1,269 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_scc_iterator.h
+ * \brief Contains the definition of the strongly connected components iterator on CSR snapshots.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_SCC_ITERATOR_H_
+#define __CGTL__CGT_CSR_CSR_SCC_ITERATOR_H_
+
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace csr
+  {
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRGraphBase;
+
+    /*!
+     * \class _CSRComponent
+     * \brief A strongly connected component of a CSR snapshot: the ids of its nodes.
+     * \author Leandro Costa
+     * \date 2011
+     */
+
+    class _CSRComponent
+    {
+      public:
+        typedef cgt::base::array<size_t>::const_iterator const_iterator;
+
+      public:
+        size_t size () const { return _ids.size (); }
+        const size_t& operator[](const size_t& _i) const { return _ids [_i]; }
+        const_iterator begin () const { return _ids.begin (); }
+        const_iterator end () const { return _ids.end (); }
+
+      public:
+        void _clear () { _ids.clear (); }
+        void _insert (const size_t& _i) { _ids.push_back (_i); }
+
+      private:
+        cgt::base::array<size_t> _ids;
+    };
+
+
+    /*!
+     * \class _CSRSCCIterator
+     * \brief An iterator that returns the strongly connected components of a CSR snapshot.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * The same algorithm of cgt::stconncomp::_SCCIterator: a depth-first
+     * search on the inverted graph, then depth-first searches on the graph
+     * from nodes in decreasing order of finish time, each one making a new
+     * component. The nodes aren't modified to invert the graph: the inverted
+     * adjacencies are built in two arrays (like the CSR ones) by the
+     * constructor, and all searches are iterative, in O(V + E).
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRSCCIterator
+      {
+        private:
+          typedef _CSRSCCIterator<_TpVertex, _TpEdge> _Self;
+          typedef _CSRGraphBase<_TpVertex, _TpEdge>   _CSR;
+
+        private:
+          struct _State
+          {
+            _State (const size_t& _i, const size_t& _p) : _id (_i), _pos (_p) { }
+
+            size_t  _id;
+            size_t  _pos;
+          };
+
+        public:
+          _CSRSCCIterator () : _csr (NULL), _index (static_cast<size_t>(-1)), _cursor (0) { }
+          _CSRSCCIterator (const _CSR* const _ptr_csr);
+
+        private:
+          void _run_reverse_dfs ();
+          void _make_new_scc (const size_t& _i);
+
+        public:
+          /** the number of the current component (0 for the first one) */
+          size_t index () const { return _index; }
+          const _CSRComponent& operator*() const { return _component; }
+          const _CSRComponent* operator->() const { return &_component; }
+          const bool operator==(const _Self& _other) const { return _index == _other._index; }
+          const bool operator!=(const _Self& _other) const { return !(*this == _other); }
+          _Self& operator++();
+          const _Self operator++(int) { _Self _it = *this; operator++(); return _it; }
+
+        private:
+          const _CSR*               _csr;
+          size_t                    _index;
+          size_t                    _cursor;  /** < nodes not yet tried as roots: _order [0, _cursor) */
+          cgt::base::array<size_t>  _order;   /** < nodes in increasing order of finish time (inverted graph) */
+          cgt::base::array<bool>    _visited;
+          cgt::base::array<_State>  _stack;
+          _CSRComponent             _component;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRSCCIterator<_TpVertex, _TpEdge>::_CSRSCCIterator (const _CSR* const _ptr_csr)
+      : _csr (_ptr_csr), _index (static_cast<size_t>(-1)), _cursor (0)
+      {
+        _run_reverse_dfs ();
+        operator++();
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CSRSCCIterator<_TpVertex, _TpEdge>::_run_reverse_dfs ()
+      {
+        size_t _n = _csr->num_vertices ();
+        size_t _m = _csr->num_edges ();
+
+        /*
+         * build the inverted adjacencies:
+         * _ioffsets [v] is the first position of the sources of v in _isources.
+         */
+
+        cgt::base::array<size_t> _ioffsets (_n + 1, 0);
+        cgt::base::array<size_t> _isources (_m, 0);
+
+        for (size_t _p = 0; _p < _m; _p++)
+          _ioffsets [_csr->target (_p) + 1]++;
+
+        for (size_t _v = 0; _v < _n; _v++)
+          _ioffsets [_v + 1] += _ioffsets [_v];
+
+        cgt::base::array<size_t> _fill (_ioffsets);
+
+        for (size_t _u = 0; _u < _n; _u++)
+        {
+          size_t _end = _csr->adj_end (_u);
+
+          for (size_t _p = _csr->adj_begin (_u); _p < _end; _p++)
+            _isources [_fill [_csr->target (_p)]++] = _u;
+        }
+
+        /*
+         * depth-first search on the inverted graph,
+         * keeping nodes in order of finish time.
+         */
+
+        _visited.resize (_n, false);
+        _order.reserve (_n);
+        _stack.reserve (_n);
+
+        for (size_t _r = 0; _r < _n; _r++)
+        {
+          if (_visited [_r])
+            continue;
+
+          _visited [_r] = true;
+          _stack.push_back (_State (_r, _ioffsets [_r]));
+
+          while (! _stack.empty ())
+          {
+            _State& _state = _stack.back ();
+
+            if (_state._pos < _ioffsets [_state._id + 1])
+            {
+              size_t _v = _isources [_state._pos++];
+
+              if (! _visited [_v])
+              {
+                _visited [_v] = true;
+                _stack.push_back (_State (_v, _ioffsets [_v]));
+              }
+            }
+            else
+            {
+              _order.push_back (_state._id);
+              _stack.pop_back ();
+            }
+          }
+        }
+
+        for (size_t _v = 0; _v < _n; _v++)
+          _visited [_v] = false;
+
+        _cursor = _n;
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CSRSCCIterator<_TpVertex, _TpEdge>::_make_new_scc (const size_t& _i)
+      {
+        /*
+         * execute DFS until _i is popped from the stack,
+         * adding all visited nodes to the new SCC.
+         */
+
+        _component._clear ();
+        _component._insert (_i);
+        _visited [_i] = true;
+        _stack.push_back (_State (_i, _csr->adj_begin (_i)));
+
+        while (! _stack.empty ())
+        {
+          _State& _state = _stack.back ();
+
+          if (_state._pos < _csr->adj_end (_state._id))
+          {
+            size_t _v = _csr->target (_state._pos++);
+
+            if (! _visited [_v])
+            {
+              _visited [_v] = true;
+              _component._insert (_v);
+              _stack.push_back (_State (_v, _csr->adj_begin (_v)));
+            }
+          }
+          else
+            _stack.pop_back ();
+        }
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRSCCIterator<_TpVertex, _TpEdge>& _CSRSCCIterator<_TpVertex, _TpEdge>::operator++()
+      {
+        while (_cursor > 0 && _visited [_order [_cursor - 1]])
+          _cursor--;
+
+        if (_cursor > 0)
+        {
+          _make_new_scc (_order [--_cursor]);
+          _index++;
+        }
+        else
+        {
+          _component._clear ();
+          _index = _CSR::npos;
+        }
+
+        return *this;
+      }
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_SCC_ITERATOR_H_
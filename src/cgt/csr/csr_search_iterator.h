@@ -0,0 +1,167 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_search_iterator.h
+ * \brief Contains the base of breadth-first and depth-first search iterators on CSR snapshots.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_SEARCH_ITERATOR_H_
+#define __CGTL__CGT_CSR_CSR_SEARCH_ITERATOR_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace csr
+  {
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRGraphBase;
+
+    /*!
+     * \class _CSRSearchIterator
+     * \brief The base for breadth-first and depth-first search iterators on CSR snapshots.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * It's the CSR counterpart of cgt::search::_SearchIterator: the same
+     * colors, parents, discovery and finish times, but kept in arrays indexed
+     * by node id, and a single array of states (node id, next adjacency
+     * position) used as a queue or as a stack by the derived iterators.
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRSearchIterator
+      {
+        private:
+          typedef _CSRSearchIterator<_TpVertex, _TpEdge> _Self;
+
+        protected:
+          typedef _CSRGraphBase<_TpVertex, _TpEdge>  _CSR;
+          typedef _GraphNode<_TpVertex, _TpEdge>     _Node;
+
+        public:
+          typedef enum { WHITE, GRAY, BLACK } _color_t;
+
+        protected:
+          struct _State
+          {
+            _State (const size_t& _i, const size_t& _p) : _id (_i), _pos (_p) { }
+
+            size_t  _id;  /** < the node */
+            size_t  _pos; /** < its next adjacency to visit */
+          };
+
+        protected:
+          _CSRSearchIterator () : _csr (NULL), _id (static_cast<size_t>(-1)), _next (0), _head (0), _global_time (0) { }
+          _CSRSearchIterator (const _CSR* const _ptr_csr, const size_t& _i);
+
+        public:
+          size_t id () const { return _id; }
+          const _Node& operator*() const { return _csr->node (_id); }
+          const _Node* operator->() const { return &(_csr->node (_id)); }
+          const bool operator==(const _Self& _other) const { return _id == _other._id; }
+          const bool operator!=(const _Self& _other) const { return !(*this == _other); }
+
+        public:
+          const _color_t& color (const size_t& _i) const { return _color [_i]; }
+          /** the parent of the node \b _i in the search forest, or \b npos if it's a root */
+          const size_t& parent (const size_t& _i) const { return _parent [_i]; }
+          const unsigned long& discovery (const size_t& _i) const { return _discovery [_i]; }
+          const unsigned long& finish (const size_t& _i) const { return _finish [_i]; }
+
+        protected:
+          void _discover_node (const size_t& _i, const size_t& _p)
+          {
+            _color [_i] = GRAY;
+            _parent [_i] = _p;
+            _discovery [_i] = ++_global_time;
+            _states.push_back (_State (_i, _csr->adj_begin (_i)));
+          }
+
+          void _finish_node (const size_t& _i)
+          {
+            _color [_i] = BLACK;
+            _finish [_i] = ++_global_time;
+          }
+
+          /** discover the next WHITE node in the order of ids, when the queue (or the stack) is empty */
+          void _discover_next_root ();
+
+        protected:
+          const _CSR*                     _csr;
+          size_t                          _id;        /** < the current node */
+          size_t                          _next;      /** < the first id that may be WHITE */
+          size_t                          _head;      /** < the queue's front (breadth-first search only) */
+          cgt::base::array<_State>        _states;
+          cgt::base::array<_color_t>      _color;
+          cgt::base::array<size_t>        _parent;
+          cgt::base::array<unsigned long> _discovery;
+          cgt::base::array<unsigned long> _finish;
+
+          unsigned long                   _global_time;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRSearchIterator<_TpVertex, _TpEdge>::_CSRSearchIterator (const _CSR* const _ptr_csr, const size_t& _i)
+      : _csr (_ptr_csr), _id (static_cast<size_t>(-1)), _next (0), _head (0), _global_time (0)
+      {
+        size_t _n = _csr->num_vertices ();
+
+        if (_i < _n)
+        {
+          _color.resize (_n, WHITE);
+          _parent.resize (_n, static_cast<size_t>(-1));
+          _discovery.resize (_n, 0);
+          _finish.resize (_n, 0);
+          _states.reserve (_n);
+
+          _id = _i;
+          _discover_node (_i, static_cast<size_t>(-1));
+        }
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CSRSearchIterator<_TpVertex, _TpEdge>::_discover_next_root ()
+      {
+        size_t _n = _color.size ();
+
+        while (_next < _n && _color [_next] != WHITE)
+          _next++;
+
+        if (_next < _n)
+        {
+          _id = _next;
+          _discover_node (_next, static_cast<size_t>(-1));
+        }
+      }
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_SEARCH_ITERATOR_H_
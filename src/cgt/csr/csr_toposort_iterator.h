@@ -0,0 +1,146 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/csr/csr_toposort_iterator.h
+ * \brief Contains the definition of the topological sort iterator on CSR snapshots.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_CSR_CSR_TOPOSORT_ITERATOR_H_
+#define __CGTL__CGT_CSR_CSR_TOPOSORT_ITERATOR_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/base/array.h"
+#include "cgt/csr/csr_heap.h"
+
+
+namespace cgt
+{
+  namespace csr
+  {
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRGraphBase;
+
+    /*!
+     * \class _CSRToposortIterator
+     * \brief An iterator that implements topological sort on a CSR snapshot.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * The same algorithm (Kahn) of cgt::toposort::_ToposortIterator, and the
+     * same order: among the nodes with no incoming edges, the first one in
+     * the node's list (the lowest id) is returned. Instead of an auxiliary
+     * graph, it keeps the number of incoming edges of each node in an array
+     * and the nodes with no incoming edges in a heap, in O((V + E) log V).
+     * As in the original iterator, loops are ignored, and the iteration stops
+     * at the first cycle.
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CSRToposortIterator
+      {
+        private:
+          typedef _CSRToposortIterator<_TpVertex, _TpEdge>  _Self;
+          typedef _CSRGraphBase<_TpVertex, _TpEdge>         _CSR;
+          typedef _GraphNode<_TpVertex, _TpEdge>            _Node;
+
+        public:
+          _CSRToposortIterator () : _csr (NULL), _id (static_cast<size_t>(-1)) { }
+          _CSRToposortIterator (const _CSR* const _ptr_csr);
+
+        private:
+          void _incr ();
+
+        public:
+          size_t id () const { return _id; }
+          const _Node& operator*() const { return _csr->node (_id); }
+          const _Node* operator->() const { return &(_csr->node (_id)); }
+          const bool operator==(const _Self& _other) const { return _id == _other._id; }
+          const bool operator!=(const _Self& _other) const { return !(*this == _other); }
+          _Self& operator++() { _incr (); return *this; }
+          const _Self operator++(int) { _Self _it = *this; _incr (); return _it; }
+
+        private:
+          const _CSR*               _csr;
+          size_t                    _id;
+          cgt::base::array<size_t>  _indegree;
+          _CSRHeap<size_t>          _heap;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      _CSRToposortIterator<_TpVertex, _TpEdge>::_CSRToposortIterator (const _CSR* const _ptr_csr)
+      : _csr (_ptr_csr), _id (static_cast<size_t>(-1))
+      {
+        size_t _n = _csr->num_vertices ();
+
+        _indegree.resize (_n, 0);
+
+        for (size_t _u = 0; _u < _n; _u++)
+        {
+          size_t _end = _csr->adj_end (_u);
+
+          for (size_t _p = _csr->adj_begin (_u); _p < _end; _p++)
+          {
+            if (_csr->target (_p) != _u)
+              _indegree [_csr->target (_p)]++;
+          }
+        }
+
+        for (size_t _u = 0; _u < _n; _u++)
+        {
+          if (! _indegree [_u])
+            _heap.push (_u, _u);
+        }
+
+        _incr ();
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CSRToposortIterator<_TpVertex, _TpEdge>::_incr ()
+      {
+        _id = _CSR::npos;
+
+        if (! _heap.empty ())
+        {
+          _id = _heap.top ();
+          _heap.pop ();
+
+          size_t _end = _csr->adj_end (_id);
+
+          for (size_t _p = _csr->adj_begin (_id); _p < _end; _p++)
+          {
+            size_t _v = _csr->target (_p);
+
+            if (_v != _id && ! --_indegree [_v])
+              _heap.push (_v, _v);
+          }
+        }
+      }
+  }
+}
+
+#endif // __CGTL__CGT_CSR_CSR_TOPOSORT_ITERATOR_H_
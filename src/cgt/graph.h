@@ -49,8 +49,17 @@
 
 #include "cgt/search/depth/depth_iterator.h"
 #include "cgt/search/breadth/breadth_iterator.h"
+#include "cgt/search/breadth/breadth_first.h"
+#include "cgt/search/depth/depth_first.h"
+#include "cgt/search/breadth/diropt_search.h"
+#include "cgt/search/breadth/parallel_search.h"
+#include "cgt/search/breadth/bitparallel_search.h"
+#include "cgt/search/breadth/bidir_search.h"
 #include "cgt/shortpath/single/bellford/bellford_iterator.h"
 #include "cgt/shortpath/single/dijkstra/dijkstra_iterator.h"
+#include "cgt/shortpath/single/dijkstra/dijkstra_path.h"
+#include "cgt/shortpath/single/astar/astar_iterator.h"
+#include "cgt/shortpath/single/deltastep/delta_stepping.h"
 #include "cgt/minspantree/prim/prim_iterator.h"
 #include "cgt/minspantree/kruskal/kruskal_iterator.h"
 
@@ -60,6 +69,8 @@
 
 #include "cgt/toposort/toposort_iterator.h"
 
+#include "cgt/csr/csr_graph.h"
+
 
 /*!
  * \namespace cgt
@@ -70,11 +81,11 @@
 
 namespace cgt
 {
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		class _graph_base : protected _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType>
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		class _graph_base : protected _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>
 	{
 		private:
-			typedef _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType> _Base;
+			typedef _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash> _Base;
 
 		public:
 			typedef _GraphNode<_TpVertex, _TpEdge>    node;
@@ -86,12 +97,61 @@ namespace cgt
 
 		public:
 			iterator insert_vertex (const _TpVertex &_vertex) { return _insert_vertex (_vertex); }
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+			/** if the vertex isn't in the graph yet, it's moved into its node, not copied (C++11 only) */
+			iterator insert_vertex (_TpVertex&& _vertex) { return _Base::_insert_vertex (std::move (_vertex)); }
+
+			/**
+			 * Builds a vertex from \b _args and inserts it as insert_vertex (_TpVertex&&): it's
+			 * built once (to be searched in the graph) and moved into its node (C++11 only).
+			 */
+			template<typename... _Args>
+				iterator emplace_vertex (_Args&&... _args) { return _Base::_emplace_vertex (std::forward<_Args>(_args)...); }
+#endif
+
+			/**
+			 * Inserts the vertices in [_first, _last), in order, skipping those
+			 * already in the graph, like a call to insert_vertex () for each one.
+			 */
+			template<typename _TpInputIterator>
+				void insert_vertices (_TpInputIterator _first, const _TpInputIterator& _last) { _Base::_insert_vertices (_first, _last); }
 			const node* get_node (const _TpVertex &_vertex) { return _Base::_get_node (_vertex); }
 			iterator find (const _TpVertex &_vertex) { return _Base::_find (_vertex); }
 
+			/**
+			 * Nodes have dense ids, from 0 to num_vertices () - 1, given in order of insertion
+			 * (see _GraphNode::id ()). Time complexity: O(1).
+			 */
+			node& get_node_by_id (const size_t& _id) { return _Base::_get_node_by_id (_id); }
+			const node& get_node_by_id (const size_t& _id) const { return _Base::_get_node_by_id (_id); }
+			size_t num_vertices () const { return _Base::_num_nodes (); }
+
+			/**
+			 * Whether there's an edge from \b _n1 to \b _n2, and the edge (or NULL).
+			 * Time complexity: O(1) in dense graphs (see _DirectedDense), as
+			 * _GraphNode::get_edge () otherwise (get_edge () is O(1) only if the
+			 * type's \b _matrix is _EDGE_MATRIX).
+			 */
+			const bool has_edge (const node& _n1, const node& _n2) const { return _Base::_has_edge (_n1, _n2); }
+			edge* get_edge (const node& _n1, const node& _n2) const { return _Base::_get_edge (_n1, _n2); }
+
+			/**
+			 * Only for dense graphs: the nodes adjacent to \b _n, as a set of ids (bits from 0 to
+			 * num_vertices () - 1), to be combined with other sets a word at a time. Time complexity: O(V / w).
+			 */
+			void neighbours (const node& _n, cgt::base::bitset& _set) const { _Base::_neighbours (_n, _set); }
+
+			/**
+			 * Only for dense graphs: the nodes reachable from \b _n (including it), as a set of ids.
+			 * It's a breadth-first search on the rows of the bit matrix: O(V * V / w) word operations.
+			 */
+			void reachable (const node& _n, cgt::base::bitset& _set) const { _Base::_reachable (_n, _set); }
+
 			/**
 			 * A method to generate the transpose of graph.
-			 * Time complexity: O(V).
+			 * Time complexity: O(V), plus O(V * V) to transpose the
+			 * matrix of dense graphs. It doesn't compile for
+			 * graphs without inverted lists (see _DirectedNoInverse).
 			 */
 			void invert () { _Base::_invert (); }
 
@@ -135,6 +195,13 @@ namespace cgt
 			const_eiterator eend () const { return const_eiterator (_Base::_edgeList.end ()); }
 
 
+			/** the state of local breadth-first and depth-first searches, reused by the next ones */
+			typedef cgt::search::_SearchWorkspace<_TpVertex, _TpEdge>                                          search_workspace;
+
+			/** the base of visitors of cgt::search::breadth_first and cgt::search::depth_first, and the state they reuse */
+			typedef cgt::search::_SearchVisitor<_TpVertex, _TpEdge>                                            visitor;
+			typedef cgt::search::_VisitWorkspace<_TpVertex, _TpEdge>                                           visit_workspace;
+
 			/** breadth-first search iterator */
 			typedef cgt::search::breadth::_BreadthIterator<_TpVertex, _TpEdge>                                 biterator;
 			typedef cgt::search::breadth::_BreadthIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpConst>  const_biterator;
@@ -149,9 +216,27 @@ namespace cgt
 
 			biterator bbegin () { return biterator (_Base::begin (), _Base::begin (), _Base::end ()); }
 			biterator bbegin (const iterator& _it) { return biterator (_it, _Base::begin (), _Base::end ()); }
+			/** a local breadth-first search: only the nodes reachable from \b _it, in time proportional to them */
+			biterator bbegin (const iterator& _it, search_workspace& _ws) { return biterator (_it, _Base::end (), _ws); }
 			biterator bend () { return biterator (NULL); }
 			const_biterator bbegin () const { return const_biterator (_Base::begin (), _Base::begin (), _Base::end ()); }
 			const_biterator bbegin (const iterator& _it) const { return const_biterator (_it, _Base::begin (), _Base::end ()); }
+			const_biterator bbegin (const iterator& _it, search_workspace& _ws) const { return const_biterator (_it, _Base::end (), _ws); }
+
+			/**
+			 * A local breadth-first search from the nodes of the graph iterators in [_first, _last)
+			 * at once: they are the first nodes visited, and each node is reached from the nearest one.
+			 */
+			template<typename _TpInputIterator>
+				biterator bbegin (_TpInputIterator _first, const _TpInputIterator& _last, search_workspace& _ws)
+				{
+					cgt::base::array<node*> _roots;
+
+					for (; _first != _last; ++_first)
+						_roots.push_back (&(**_first));
+
+					return biterator (_roots, _Base::end (), _ws);
+				}
 			const_biterator bend () const { return const_biterator (NULL); }
 
 			biiterator bibegin (biterator &_it) { return biiterator (_it.info_begin ()); }
@@ -161,6 +246,26 @@ namespace cgt
 			const_biiterator biend (biterator &_it) const { return const_biiterator (_it.info_end ()); }
 			const_biiterator biend (const_biterator &_it) const { return const_biiterator (_it.info_end ()); }
 
+			/** direction-optimizing breadth-first search (top-down and bottom-up levels) */
+			typedef cgt::search::breadth::_DirOptSearch<_TpVertex, _TpEdge>                                    dosearch;
+
+			dosearch dosearch_init () const { return dosearch (_Base::begin (), _Base::end (), _Base::_is_directed (), _TpGraphType::_inverse); }
+
+			/** parallel level-synchronous breadth-first search, with \b _threads threads */
+			typedef cgt::search::breadth::_ParallelSearch<_TpVertex, _TpEdge>                                  psearch;
+
+			psearch psearch_init (const size_t& _threads) const { return psearch (_Base::begin (), _Base::end (), _threads); }
+
+			/** breadth-first searches of up to 64 * \b _words sources at once, one bit per source (MS-BFS) */
+			typedef cgt::search::breadth::_BitParallelSearch<_TpVertex, _TpEdge>                               mssearch;
+
+			mssearch mssearch_init (const size_t& _words = 1) const { return mssearch (_Base::begin (), _Base::end (), _words); }
+
+			/** bidirectional breadth-first search: hops (and a path) from a node to another */
+			typedef cgt::search::breadth::_BidirSearch<_TpVertex, _TpEdge>                                     bdsearch;
+
+			bdsearch bdsearch_init () const { return bdsearch (_Base::begin (), _Base::end (), _Base::_is_directed (), _TpGraphType::_inverse); }
+
 
 			/** depth-first search iterator */
 			typedef cgt::search::depth::_DepthIterator<_TpVertex, _TpEdge>                                 diterator;
@@ -176,9 +281,12 @@ namespace cgt
 
 			diterator dbegin () { return diterator (_Base::begin (), _Base::begin (), _Base::end ()); }
 			diterator dbegin (const iterator& _it) { return diterator (_it, _Base::begin (), _Base::end ()); }
+			/** a local depth-first search: only the nodes reachable from \b _it, in time proportional to them */
+			diterator dbegin (const iterator& _it, search_workspace& _ws) { return diterator (_it, _Base::end (), _ws); }
 			diterator dend () { return diterator (NULL); }
 			const_diterator dbegin () const { return const_diterator (_Base::begin (), _Base::begin (), _Base::end ()); }
 			const_diterator dbegin (const iterator& _it) const { return const_diterator (_it, _Base::begin (), _Base::end ()); }
+			const_diterator dbegin (const iterator& _it, search_workspace& _ws) const { return const_diterator (_it, _Base::end (), _ws); }
 			const_diterator dend () const { return const_diterator (NULL); }
 
 			diiterator dibegin (diterator &_it) { return diiterator (_it.info_begin ()); }
@@ -193,9 +301,9 @@ namespace cgt
 			typedef cgt::stconncomp::_GraphSCCComponent<_TpVertex, _TpEdge>                          scc;
 			typedef cgt::stconncomp::_GraphSCCNode<_TpVertex, _TpEdge>                               sccnode;
 
-			scciterator sccbegin () { return scciterator (_Base::begin (), _Base::end ()); }
+			scciterator sccbegin () { return scciterator (_Base::begin (), _Base::end (), _TpGraphType::_inverse); }
 			scciterator sccend () { return scciterator (); }
-			const_scciterator sccbegin () const { return const_scciterator (_Base::begin (), _Base::end ()); }
+			const_scciterator sccbegin () const { return const_scciterator (_Base::begin (), _Base::end (), _TpGraphType::_inverse); }
 			const_scciterator sccend () const { return const_scciterator (); }
 
 			/** prim iterator */
@@ -232,6 +340,12 @@ namespace cgt
 			const_tsiterator tsbegin () const { return const_tsiterator (_Base::begin (), _Base::end ()); }
 			const_tsiterator tsbegin (const iterator& _it) const { return const_tsiterator (_it); }
 			const_tsiterator tsend () const { return const_tsiterator (); }
+
+
+			/** CSR snapshot */
+			typedef cgt::csr::_CSRGraph<_TpVertex, _TpEdge> csr_graph;
+
+			csr_graph freeze () const { return csr_graph (_Base::begin (), _Base::end (), _Base::_is_directed ()); }
 	};
 
 
@@ -243,7 +357,31 @@ namespace cgt
 	 *
 	 * A graph with vertices of type \b _TpVertex, edges of type \b _TpEdge.
 	 * The type \b _TpGraphType is used to represent directed (\b _Directed)
-	 * and indirected (\b _Undirected) graphs.
+	 * and indirected (\b _Undirected) graphs. Each node keeps, besides its
+	 * adjacency list, the list of edges that point to it, used by invert ()
+	 * and by the scciterator. Graphs that don't need them can be declared with
+	 * \b _DirectedNoInverse or \b _UndirectedNoInverse, which halves the
+	 * memory of the adjacencies and the work of each edge insertion.
+	 *
+	 * If a hasher of vertices is given as \b _TpVertexHash (a functor with a
+	 * <b>size_t operator()(const _TpVertex&) const</b>), the graph keeps an
+	 * index from vertices to nodes, and find, get_node, insert_vertex and
+	 * insert_edge (by vertices) take expected time \b O(1) instead of \b O(V).
+	 * The default (void) keeps no index and searches the node's list.
+	 *
+	 * To load large inputs, insert_vertices () and insert_edges () take a batch
+	 * at once: vertices are found once for the whole batch, and repeated edges
+	 * are removed by sorting the batch by node ids, instead of searching the
+	 * adjacency lists edge by edge.
+	 *
+	 * Dense graphs can be declared with \b _DirectedDense or \b _UndirectedDense,
+	 * which keep a matrix of bits besides the adjacency lists: has_edge () takes
+	 * \b O(1), and neighbours () and reachable () work on sets of bits.
+	 *
+	 * For read-mostly workloads, freeze () returns an immutable snapshot of
+	 * the graph in compressed sparse row (CSR) format (see cgt::csr::_CSRGraph),
+	 * where all iterators run on contiguous arrays. The graph remains mutable,
+	 * and the snapshot doesn't see changes made after freeze ().
 	 *
 	 * \code
 	 *  _______________________________________________________________________________________________________________________________________________________________
@@ -305,19 +443,42 @@ namespace cgt
 	 * \endcode
 	 */
 
-	template<typename _TpVertex, typename _TpEdge = void, typename _TpGraphType = _Directed>
-		class graph : public _graph_base<_TpVertex, _TpEdge, _TpGraphType>
+	template<typename _TpVertex, typename _TpEdge = void, typename _TpGraphType = _Directed, typename _TpVertexHash = void>
+		class graph : public _graph_base<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>
 	{
 		private:
-			typedef _graph_base<_TpVertex, _TpEdge, _TpGraphType> _Base;
+			typedef _graph_base<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash> _Base;
 
 		public:
 			typedef _GraphEdge<_TpVertex, _TpEdge>    edge;
 			typedef _GraphAdjList<_TpVertex, _TpEdge> adjlist;
+			typedef _GraphAdjacency<_TpVertex, _TpEdge> adjacency;
 
 		public:
 			void insert_edge (const _TpEdge &_e, const _TpVertex &_v1, const _TpVertex &_v2) { _insert_edge (_e, _v1, _v2); }
 			void insert_edge (const _TpEdge& _e, typename _Base::iterator& _it_v1, typename _Base::iterator& _it_v2) { _insert_edge (_e, _it_v1, _it_v2); }
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+			void insert_edge (_TpEdge&& _e, const _TpVertex &_v1, const _TpVertex &_v2) { _Base::_emplace_edge (_v1, _v2, std::move (_e)); }
+			void insert_edge (_TpEdge&& _e, typename _Base::iterator& _it_v1, typename _Base::iterator& _it_v2) { _Base::_emplace_edge (_it_v1, _it_v2, std::move (_e)); }
+
+			/**
+			 * Inserts an edge from \b _v1 to \b _v2 (if there's none) whose value is built from \b _args
+			 * in place, in the list of edges: the value is never copied nor moved (C++11 only).
+			 */
+			template<typename... _Args>
+				void emplace_edge (const _TpVertex &_v1, const _TpVertex &_v2, _Args&&... _args) { _Base::_emplace_edge (_v1, _v2, std::forward<_Args>(_args)...); }
+			template<typename... _Args>
+				void emplace_edge (typename _Base::iterator& _it_v1, typename _Base::iterator& _it_v2, _Args&&... _args) { _Base::_emplace_edge (_it_v1, _it_v2, std::forward<_Args>(_args)...); }
+#endif
+
+			typedef _GraphEdgeSpec<_TpVertex, _TpEdge> edge_spec;
+
+			/**
+			 * Inserts the edges in [_first, _last) (items convertible to edge_spec),
+			 * with the same result of a call to insert_edge () for each one.
+			 */
+			template<typename _TpInputIterator>
+				void insert_edges (_TpInputIterator _first, const _TpInputIterator& _last) { _Base::_insert_edges (_first, _last); }
 
 
 		public:
@@ -352,6 +513,31 @@ namespace cgt
 			djiiterator djiend (djiterator &_it) { return djiiterator (_it.info_end ()); }
 			const_djiiterator djibegin (djiterator &_it) const { return const_djiiterator (_it.info_begin ()); }
 			const_djiiterator djiend (djiterator &_it) const { return const_djiiterator (_it.info_end ()); }
+
+
+			/** dijkstra search from a node to another, that stops at the target (and may search from both) */
+			typedef cgt::shortpath::single::dijkstra::_DijkstraPath<_TpVertex, _TpEdge>                                     djpath;
+
+			djpath djpath_init () const { return djpath (_Base::begin (), _Base::end (), _Base::_is_directed (), _TpGraphType::_inverse); }
+
+
+			/** A* iterator, led by the heuristic _TpHeuristic (see _AStarIterator): graph::astar<_TpHeuristic>::iterator */
+			template<typename _TpHeuristic>
+				struct astar
+				{
+					typedef cgt::shortpath::single::astar::_AStarIterator<_TpVertex, _TpEdge, _TpHeuristic>                 iterator;
+				};
+
+			template<typename _TpHeuristic>
+				typename astar<_TpHeuristic>::iterator asbegin (const typename _Base::iterator& _it, const _TpHeuristic& _h) { return typename astar<_TpHeuristic>::iterator (&(*_it), _Base::_num_nodes (), _h); }
+			template<typename _TpHeuristic>
+				typename astar<_TpHeuristic>::iterator asend () const { return typename astar<_TpHeuristic>::iterator (NULL); }
+
+
+			/** parallel delta-stepping shortest paths from a node to all others, with \b _threads threads (one per processor if 0) and buckets \b _delta wide (chosen from the edges if 0) */
+			typedef cgt::shortpath::single::deltastep::_DeltaStepping<_TpVertex, _TpEdge>                               deltastep;
+
+			deltastep deltastep_init (const size_t& _threads = 0, const _TpEdge& _delta = _TpEdge ()) const { return deltastep (_Base::begin (), _Base::end (), _threads, _delta); }
 	};
 
 
@@ -359,20 +545,26 @@ namespace cgt
 	 * A simple graph, with no type for edges
 	 */
 
-	template<typename _TpVertex, typename _TpGraphType>
-		class graph<_TpVertex, void, _TpGraphType> : public _graph_base<_TpVertex, void, _TpGraphType>
+	template<typename _TpVertex, typename _TpGraphType, typename _TpVertexHash>
+		class graph<_TpVertex, void, _TpGraphType, _TpVertexHash> : public _graph_base<_TpVertex, void, _TpGraphType, _TpVertexHash>
 		{
 			private:
-				typedef _GraphAdjMatrix<_TpVertex, void, _TpGraphType> _Base;
+				typedef _GraphAdjMatrix<_TpVertex, void, _TpGraphType, _TpVertexHash> _Base;
 
 			public:
 				typedef _GraphEdge<_TpVertex, void>    edge;
 				typedef _GraphNode<_TpVertex, void>    node;
 				typedef _GraphAdjList<_TpVertex, void> adjlist;
+				typedef _GraphAdjacency<_TpVertex, void> adjacency;
 
 			public:
 				void insert_edge (const _TpVertex &_v1, const _TpVertex &_v2) { _insert_edge (_v1, _v2); }
 				void insert_edge (typename _Base::iterator& _it_v1, typename _Base::iterator& _it_v2) { _insert_edge (_it_v1, _it_v2); }
+
+				typedef _GraphEdgeSpec<_TpVertex, void> edge_spec;
+
+				template<typename _TpInputIterator>
+					void insert_edges (_TpInputIterator _first, const _TpInputIterator& _last) { _Base::_insert_edges (_first, _last); }
 		};
 }
 
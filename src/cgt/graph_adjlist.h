@@ -35,6 +35,7 @@
 
 #include "cgt/graph_adjacency.h"
 #include "cgt/graph_vertex.h"
+#include "cgt/base/hash.h"
 #ifdef CGTL_DO_NOT_USE_STL
 #include "cgt/base/list.h"
 #else
@@ -42,6 +43,15 @@
 #endif
 
 
+/*!
+ * The number of adjacencies from which an adjacency list
+ * keeps an index of its linked nodes (see _GraphAdjList).
+ */
+#ifndef CGTL_ADJLIST_INDEX_THRESHOLD
+#define CGTL_ADJLIST_INDEX_THRESHOLD 32
+#endif
+
+
 namespace cgt
 {
   namespace stconncomp
@@ -82,6 +92,13 @@ namespace cgt
    * |______________________|
    *
    * \endcode
+   *
+   * When the list grows beyond CGTL_ADJLIST_INDEX_THRESHOLD adjacencies, it
+   * creates an index (a hash from the vertex of each linked node to the edge),
+   * so get_edge, and the check for duplicated edges done by insert_edge, run in
+   * expected time \b O(1) instead of \b O(n). Lists below the threshold (most of
+   * them, in sparse graphs) only pay for a NULL pointer. The index is kept by
+   * the graph's operations, so the list must not be changed directly.
    */
 
   template<typename _TpVertex, typename _TpEdge>
@@ -107,18 +124,118 @@ namespace cgt
 	  typedef std::list<_Adjacency>         _Base;
 #endif
       typedef typename _Base::const_iterator      _Iterator;
+      typedef _GraphAdjList<_TpVertex, _TpEdge>   _Self;
+      typedef cgt::base::hash<const _Vertex*, _Edge*> _Index;
+
+    public:
+      _GraphAdjList () : _index (NULL) { }
+#ifdef CGTL_DO_NOT_USE_STL
+      explicit _GraphAdjList (cgt::base::alloc::_Arena* const _arena) : _Base (cgt::base::alloc::_Allocator<cgt::base::_ListItem<_Adjacency> > (_arena)), _index (NULL) { }
+#endif
+      _GraphAdjList (const _Self& _l) : _Base (_l), _index (NULL) { _build_index (); }
+      ~_GraphAdjList () { delete _index; }
+
+    public:
+      _Self& operator=(const _Self& _l);
+
+#ifdef CGTL_DO_NOT_USE_STL
+      static void swap (_Self& _l1, _Self& _l2);
+#else
+      void swap (_Self& _l);
+#endif
 
     private:
       void _insert (_Edge& _e, _Node& _n);
       void _remove_adj_by_node (const _Node& _n);
+      void _build_index ();
+      void _clear ();
 
     public:
       _Edge* get_edge (const _Vertex& _v) const;
+      _Edge* get_edge (const _Node& _n) const;
+
+    private:
+      _Index* _index; /** < from the vertex of each linked node to the edge, NULL below the threshold */
   };
 
+  template<typename _TpVertex, typename _TpEdge>
+    _GraphAdjList<_TpVertex, _TpEdge>& _GraphAdjList<_TpVertex, _TpEdge>::operator=(const _Self& _l)
+    {
+      if (this != &_l)
+      {
+        _Base::operator=(_l);
+
+        delete _index;
+        _index = NULL;
+        _build_index ();
+      }
+
+      return *this;
+    }
+
+#ifdef CGTL_DO_NOT_USE_STL
+  template<typename _TpVertex, typename _TpEdge>
+    void _GraphAdjList<_TpVertex, _TpEdge>::swap (_Self& _l1, _Self& _l2)
+    {
+      _Base::swap (_l1, _l2);
+
+      _Index* _ptr = _l1._index;
+      _l1._index = _l2._index;
+      _l2._index = _ptr;
+    }
+#else
+  template<typename _TpVertex, typename _TpEdge>
+    void _GraphAdjList<_TpVertex, _TpEdge>::swap (_Self& _l)
+    {
+      _Base::swap (_l);
+
+      _Index* _ptr = _index;
+      _index = _l._index;
+      _l._index = _ptr;
+    }
+#endif
+
+  template<typename _TpVertex, typename _TpEdge>
+    void _GraphAdjList<_TpVertex, _TpEdge>::_build_index ()
+    {
+      if (_Base::size () > CGTL_ADJLIST_INDEX_THRESHOLD)
+      {
+        _index = new _Index ();
+
+        _Iterator itEnd = _Base::end ();
+
+        for (_Iterator _it = _Base::begin (); _it != itEnd; ++_it)
+          if (! (*_index) [&(_it->vertex ())])
+            _index->insert (&(_it->vertex ()), &(_it->edge ()));
+      }
+    }
+
+  template<typename _TpVertex, typename _TpEdge>
+    void _GraphAdjList<_TpVertex, _TpEdge>::_clear ()
+    {
+      _Base::clear ();
+
+      delete _index;
+      _index = NULL;
+    }
+
   template<typename _TpVertex, typename _TpEdge>
     _GraphEdge<_TpVertex, _TpEdge>* _GraphAdjList<_TpVertex, _TpEdge>::get_edge (const _Vertex& _v) const
     {
+      if (_index)
+      {
+        /*
+         * vertices are unique in a graph, so a vertex that belongs to
+         * the graph is found by its address. Otherwise (a copy of the
+         * vertex) we fall back to the comparison by value.
+         */
+
+        _Edge** _ptr = (*_index) [&_v];
+
+        if (_ptr)
+          return *_ptr;
+      }
+
       _Edge *_ptr_edge = NULL;
 
       _Iterator itEnd = _Base::end ();
@@ -135,22 +252,53 @@ namespace cgt
       return _ptr_edge;
     }
 
+  template<typename _TpVertex, typename _TpEdge>
+    _GraphEdge<_TpVertex, _TpEdge>* _GraphAdjList<_TpVertex, _TpEdge>::get_edge (const _Node& _n) const
+    {
+      if (_index)
+      {
+        _Edge** _ptr = (*_index) [&(_n.vertex ())];
+        return (_ptr ? *_ptr : NULL);
+      }
+
+      /* the node is in the graph: it's found by its address, with no comparison of vertices */
+
+      _Iterator itEnd = _Base::end ();
+
+      for (_Iterator _it = _Base::begin (); _it != itEnd; ++_it)
+        if (&(_it->node ()) == &_n)
+          return &(_it->edge ());
+
+      return NULL;
+    }
+
   template<typename _TpVertex, typename _TpEdge>
     void _GraphAdjList<_TpVertex, _TpEdge>::_insert (_Edge& _e, _Node& _n)
     {
       _Base::push_back (_Adjacency (_e, _n));
+
+      if (_index)
+      {
+        if (! (*_index) [&(_n.vertex ())])
+          _index->insert (&(_n.vertex ()), &_e);
+      }
+      else
+        _build_index ();
     }
 
   template<typename _TpVertex, typename _TpEdge>
     void _GraphAdjList<_TpVertex, _TpEdge>::_remove_adj_by_node (const _Node& _n)
     {
-      _Iterator itEnd = _Base::end ();
+      typename _Base::iterator itEnd = _Base::end ();
 
-      for (_Iterator _it = _Base::begin (); _it != itEnd; ++_it)
+      for (typename _Base::iterator _it = _Base::begin (); _it != itEnd; ++_it)
       {
-        if (_it->node ().vertex () == _n.vertex ())
+        if (&(_it->node ()) == &_n)
         {
-          _Base::remove (*_it);
+          if (_index)
+            _index->remove (&(_it->vertex ()));
+
+          _Base::erase (_it);
           break;
         }
       }
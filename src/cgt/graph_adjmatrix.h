@@ -32,6 +32,10 @@
 #include "cgt/graph_type.h"
 #include "cgt/graph_node.h"
 #include "cgt/graph_vertex.h"
+#include "cgt/graph_edge.h"
+#include "cgt/graph_vertex_index.h"
+#include "cgt/graph_bit_matrix.h"
+#include "cgt/base/array.h"
 
 #ifdef CGTL_DO_NOT_USE_STL
 #include "cgt/base/list.h"
@@ -44,10 +48,54 @@
 
 namespace cgt
 {
+#ifdef CGTL_DO_NOT_USE_STL
+	/*!
+	 * \class _GraphArena
+	 * \brief The arena from which all lists of a graph allocate their items.
+	 * \author Leandro Costa
+	 * \date 2011
+	 *
+	 * The list of nodes, the list of edges and the adjacency lists of every
+	 * node take their items (nodes, edges and adjacencies) from a single
+	 * arena (see cgt::base::alloc::_Arena) owned by the graph, instead of the
+	 * static storages shared by all lists of the process. Items of a graph
+	 * stay close in memory, and when the graph is destroyed its chunks are
+	 * given back to the system at once.
+	 *
+	 * It's the first base class of _GraphAdjMatrixBase, so the arena is
+	 * created before the lists and destroyed after them. A graph owns its
+	 * arena, so it can't be copied.
+	 *
+	 * With CGTL_DO_NOT_USE_ARENA defined there's no arena, and items come
+	 * from the static storages as before. With the STL, lists use
+	 * std::allocator and there's no arena either.
+	 */
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
+	class _GraphArena
+	{
+		protected:
+			_GraphArena () { }
+
+		private:
+			_GraphArena (const _GraphArena&);
+			_GraphArena& operator=(const _GraphArena&);
+
+		protected:
+#ifndef CGTL_DO_NOT_USE_ARENA
+			cgt::base::alloc::_Arena* _get_arena () { return &_arena; }
+
+		private:
+			cgt::base::alloc::_Arena _arena;
+#else
+			cgt::base::alloc::_Arena* _get_arena () { return NULL; }
+#endif
+	};
+#endif
+
+
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
 #ifdef CGTL_DO_NOT_USE_STL
-		class _GraphAdjMatrixBase : protected cgt::base::list<_GraphNode<_TpVertex, _TpEdge> >
+		class _GraphAdjMatrixBase : private _GraphArena, protected cgt::base::list<_GraphNode<_TpVertex, _TpEdge> >
 #else
 		class _GraphAdjMatrixBase : protected std::list<_GraphNode<_TpVertex, _TpEdge> >
 #endif
@@ -75,6 +123,13 @@ namespace cgt
 		protected:
 			typedef typename _Base::iterator iterator;
 
+#ifdef CGTL_DO_NOT_USE_STL
+			_GraphAdjMatrixBase ()
+			: _Base (cgt::base::alloc::_Allocator<cgt::base::_ListItem<_Node> > (_GraphArena::_get_arena ())),
+			  _index (_GraphArena::_get_arena ()),
+			  _edgeList (cgt::base::alloc::_Allocator<cgt::base::_ListItem<_Edge> > (_GraphArena::_get_arena ())) { }
+#endif
+
 			/**
 			 * A method to get a node pointer by its vertex.
 			 * @param _vertex a reference to the vertex.
@@ -84,12 +139,16 @@ namespace cgt
 
 			iterator _find (const _TpVertex &_vertex);
 
+			/**
+			 * A method to get a node by its id.
+			 * @param _id the id of the node (less than _num_nodes ()).
+			 * @return A reference to the node. Time complexity: O(1).
+			 */
+			_Node& _get_node_by_id (const size_t& _id) const { return *(_nodeTable [_id]); }
+			size_t _num_nodes () const { return _nodeTable.size (); }
+
 		protected:
-#ifdef CGTL_DO_NOT_USE_STL
-			iterator _insert_node (const _TpVertex &_vertex) { return _Base::push_back (_Node (_vertex)); }
-#else
-			iterator _insert_node (const _TpVertex &_vertex) { return _Base::insert (_Base::end (), _Node (_vertex)); }
-#endif
+			iterator _insert_node (const _TpVertex &_vertex);
 
 			iterator _insert_vertex (const _TpVertex &_vertex)
 			{
@@ -101,8 +160,80 @@ namespace cgt
 				return it;
 			}
 
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+			iterator _insert_node (_TpVertex&& _vertex);
+
+			/** like _insert_vertex (), but the vertex is moved into its node (if it's not in the graph yet) */
+			iterator _insert_vertex (_TpVertex&& _vertex)
+			{
+				iterator it = _find (_vertex);
+
+				if (it == _Base::end ())
+					it = _insert_node (std::move (_vertex));
+
+				return it;
+			}
+
+			/**
+			 * Builds the vertex from \b _args and inserts it like _insert_vertex (_TpVertex&&).
+			 * The vertex is needed to search the graph, so it's built once and then moved.
+			 */
+			template<typename... _Args>
+				iterator _emplace_vertex (_Args&&... _args) { return _insert_vertex (_TpVertex (std::forward<_Args>(_args)...)); }
+#endif
+
 			void _insert_edge (_Node& _n1, _Node& _n2, _Vertex& _v1, _Vertex& _v2, _Edge& _e);
 
+			/**
+			 * Inserts a batch of vertices, skipping those already in the graph
+			 * and repeated ones. Expected time complexity: O(B) with a vertex
+			 * index, O((V + B) log (V + B)) without.
+			 */
+			template<typename _TpInputIterator>
+				void _insert_vertices (_TpInputIterator _first, const _TpInputIterator& _last);
+
+			/**
+			 * Selects the edges of a batch to be inserted: those whose vertices are in the
+			 * graph, not in the graph yet and not repeated in the batch (the first one wins).
+			 * @param _specs the batch, items with v1 () and v2 () (see _GraphEdgeSpec).
+			 * @param _ends receives the nodes of each edge: _ends [2i] and _ends [2i + 1].
+			 * @param _sel receives the positions of the selected edges, in the order of the batch.
+			 */
+			template<typename _TpSpec>
+				void _select_edges (const cgt::base::array<_TpSpec>& _specs, cgt::base::array<_Node*>& _ends, cgt::base::array<size_t>& _sel);
+
+			/**
+			 * Links an edge selected by _select_edges: like _insert_edge, but
+			 * with no search, since the nodes aren't linked yet.
+			 */
+			void _link_edge (_Node& _n1, _Node& _n2, _Edge& _e);
+
+			/**
+			 * Whether there's an edge from \b _n1 to \b _n2: O(1) if the graph
+			 * keeps a matrix (see _GraphBitMatrix), a search in the adjacency
+			 * list of \b _n1 otherwise.
+			 */
+			const bool _has_edge (const _Node& _n1, const _Node& _n2) const { return _bitMatrix._has_edge (_n1, _n2); }
+			_Edge* _get_edge (const _Node& _n1, const _Node& _n2) const { return _bitMatrix._get_edge (_n1, _n2); }
+
+			/** only for graphs that keep a matrix: the ids of the nodes adjacent to \b _n */
+			void _neighbours (const _Node& _n, cgt::base::bitset& _set) const
+			{
+				_set = cgt::base::bitset (_num_nodes ());
+				_set.or_words (_bitMatrix._row (_n.id ()));
+			}
+
+			/** only for graphs that keep a matrix: the ids of the nodes reachable from \b _n */
+			void _reachable (const _Node& _n, cgt::base::bitset& _set) const { _bitMatrix._reachable (_n.id (), _set); }
+
+		private:
+			/** adds a node just pushed into the list to the index, the table of ids and the matrix */
+			iterator _register_node (const iterator& _it);
+
+			/** stable counting sort of the positions \b _pos by _key [_pos [i]] (node ids): O(B + V) */
+			void _sort_by_id (cgt::base::array<size_t>& _pos, const cgt::base::array<size_t>& _key) const;
+
+		protected:
 			void _invert ();
 
 			const bool _is_directed () const;
@@ -111,6 +242,24 @@ namespace cgt
 		private:
 			_TpGraphType  _type; /** < the graph type: directed or undirected */
 
+			/*!
+			 * Index from vertices to nodes. Without a hasher (\b _TpVertexHash
+			 * is void) it's empty and nodes are found by a linear search.
+			 */
+			_GraphVertexIndex<_TpVertex, iterator, _TpVertexHash> _index;
+
+			/*!
+			 * Table from node ids to nodes: the node with id \b i is
+			 * _nodeTable [i]. It's updated when a node is inserted.
+			 */
+			cgt::base::array<_Node*> _nodeTable;
+
+			/*!
+			 * Adjacency matrix indexed by node ids, kept besides the adjacency
+			 * lists. It's empty unless the graph type asks for it (\b _matrix).
+			 */
+			_GraphBitMatrix<_TpVertex, _TpEdge, _TpGraphType::_matrix> _bitMatrix;
+
 		protected:
 			/*
 			 * We need a list of edges for two reasons:
@@ -124,54 +273,250 @@ namespace cgt
 			_EdgeList _edgeList;
 	};
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		_GraphNode<_TpVertex, _TpEdge>* _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType>::_get_node (const _TpVertex &_vertex)
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		_GraphNode<_TpVertex, _TpEdge>* _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_get_node (const _TpVertex &_vertex)
 		{
-			_Node *_ptr_node = NULL;
+			iterator it = _find (_vertex);
 
-			iterator it;
-			iterator itEnd = _Base::end ();
+			return (it != _Base::end () ? &(*it) : NULL);
+		}
 
-			for (it = _Base::begin (); it != itEnd; ++it)
-			{
-				if (it->vertex () == _vertex)
-				{
-					_ptr_node = &(*it);
-					break;
-				}
-			}
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+#ifdef CGTL_DO_NOT_USE_STL
+		typename cgt::base::list<_GraphNode<_TpVertex, _TpEdge> >::iterator _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_find (const _TpVertex &_vertex)
+#else
+		typename std::list<_GraphNode<_TpVertex, _TpEdge> >::iterator _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_find (const _TpVertex &_vertex)
+#endif
+		{
+			return _index._find (_vertex, _Base::begin (), _Base::end ());
+		}
 
-			return _ptr_node;
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+#ifdef CGTL_DO_NOT_USE_STL
+		typename cgt::base::list<_GraphNode<_TpVertex, _TpEdge> >::iterator _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_insert_node (const _TpVertex &_vertex)
+#else
+		typename std::list<_GraphNode<_TpVertex, _TpEdge> >::iterator _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_insert_node (const _TpVertex &_vertex)
+#endif
+		{
+#ifdef CGTL_DO_NOT_USE_STL
+			return _register_node (_Base::push_back (_Node (_vertex, _nodeTable.size (), _GraphArena::_get_arena ())));
+#else
+			return _register_node (_Base::insert (_Base::end (), _Node (_vertex, _nodeTable.size ())));
+#endif
 		}
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		typename _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::iterator _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_insert_node (_TpVertex&& _vertex)
+		{
+			/*
+			 * the node is built in the item of the list: the vertex is
+			 * moved into it, and no temporary node is copied
+			 */
+
 #ifdef CGTL_DO_NOT_USE_STL
-		typename cgt::base::list<_GraphNode<_TpVertex, _TpEdge> >::iterator _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType>::_find (const _TpVertex &_vertex)
+			return _register_node (_Base::emplace_back (std::move (_vertex), _nodeTable.size (), _GraphArena::_get_arena ()));
 #else
-		typename std::list<_GraphNode<_TpVertex, _TpEdge> >::iterator _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType>::_find (const _TpVertex &_vertex)
+			return _register_node (_Base::emplace (_Base::end (), std::move (_vertex), _nodeTable.size ()));
+#endif
+		}
 #endif
+
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		typename _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::iterator _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_register_node (const iterator& _it)
 		{
-			iterator it    = _Base::begin ();
-			iterator itEnd = _Base::end ();
+			_index._insert (_it);
+			_nodeTable.push_back (&(*_it));
+			_bitMatrix._insert_node ();
+
+			return _it;
+		}
 
-			while (it != itEnd && it->vertex () != _vertex)
-				++it;
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_insert_edge (_Node& _n1, _Node& _n2, _Vertex& _v1, _Vertex& _v2, _Edge& _e)
+		{
+			_n1._insert (_e, _n2, _type._inverse);
+			_bitMatrix._insert (_n1.id (), _n2.id (), &_e);
 
-			return it;
+			if (! _type._directed && ! _bitMatrix._has_edge (_n2, _n1))
+			{
+				_n2._insert (_e, _n1, _type._inverse);
+				_bitMatrix._insert (_n2.id (), _n1.id (), &_e);
+			}
 		}
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		void _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType>::_insert_edge (_Node& _n1, _Node& _n2, _Vertex& _v1, _Vertex& _v2, _Edge& _e)
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		template<typename _TpInputIterator>
+		void _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_insert_vertices (_TpInputIterator _first, const _TpInputIterator& _last)
 		{
-			_n1._insert (_e, _n2);
+			cgt::base::array<_TpVertex> _batch;
+
+			for (; _first != _last; ++_first)
+				_batch.push_back (*_first);
 
-			if (! _type._directed && ! _n2.get_edge (_v1))
-				_n2._insert (_e, _n1);
+			cgt::base::array<const _TpVertex*> _values;
+			_values.reserve (_batch.size ());
+
+			for (size_t i = 0; i < _batch.size (); i++)
+				_values.push_back (&(_batch [i]));
+
+			cgt::base::array<iterator> _its;
+			cgt::base::array<size_t> _pos;
+			_index._find_batch (_values, _its, _Base::begin (), _Base::end ());
+			_index._first_in_batch (_values, _pos);
+
+			_nodeTable.reserve (_nodeTable.size () + _batch.size ());
+
+			iterator _itEnd = _Base::end ();
+
+			for (size_t i = 0; i < _batch.size (); i++)
+			{
+				if (_pos [i] == i && _its [i] == _itEnd)
+					_insert_node (_batch [i]);
+			}
 		}
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		void _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType>::_invert ()
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		template<typename _TpSpec>
+		void _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_select_edges (const cgt::base::array<_TpSpec>& _specs, cgt::base::array<_Node*>& _ends, cgt::base::array<size_t>& _sel)
 		{
+			size_t _n = _specs.size ();
+
+			/*
+			 * first, the vertices of all edges are found at once
+			 */
+
+			cgt::base::array<const _TpVertex*> _values;
+			_values.reserve (2 * _n);
+
+			for (size_t i = 0; i < _n; i++)
+			{
+				_values.push_back (&(_specs [i].v1 ()));
+				_values.push_back (&(_specs [i].v2 ()));
+			}
+
+			cgt::base::array<iterator> _its;
+			_index._find_batch (_values, _its, _Base::begin (), _Base::end ());
+
+			/*
+			 * then the edges with both vertices in the graph are sorted by
+			 * the id of their first node (the smallest, if the graph is
+			 * undirected), so edges leaving the same node become neighbours.
+			 */
+
+			iterator _itEnd = _Base::end ();
+			cgt::base::array<size_t> _pos;
+			cgt::base::array<size_t> _id1 (_n, 0);
+			cgt::base::array<size_t> _id2 (_n, 0);
+
+			_ends.resize (2 * _n, NULL);
+			_pos.reserve (_n);
+
+			for (size_t i = 0; i < _n; i++)
+			{
+				if (_its [2 * i] != _itEnd && _its [2 * i + 1] != _itEnd)
+				{
+					_ends [2 * i] = &(*(_its [2 * i]));
+					_ends [2 * i + 1] = &(*(_its [2 * i + 1]));
+
+					_id1 [i] = _ends [2 * i]->id ();
+					_id2 [i] = _ends [2 * i + 1]->id ();
+
+					if (! _type._directed && _id2 [i] < _id1 [i])
+					{
+						size_t _id = _id1 [i];
+						_id1 [i] = _id2 [i];
+						_id2 [i] = _id;
+					}
+
+					_pos.push_back (i);
+				}
+			}
+
+			_sort_by_id (_pos, _id1);
+
+			/*
+			 * for each first node, its adjacencies (those already in the
+			 * graph and those selected) are marked with its id, so an edge
+			 * is selected if its second node isn't marked. Since the sort
+			 * is stable, the first edge of the batch is the one selected,
+			 * as it would be with insert_edge ().
+			 */
+
+			cgt::base::array<size_t> _mark (_nodeTable.size (), static_cast<size_t>(-1));
+			cgt::base::array<char> _selected (_n, 0);
+
+			for (size_t k = 0; k < _pos.size (); k++)
+			{
+				size_t i = _pos [k];
+				size_t _id = _id1 [i];
+
+				if (k == 0 || _id1 [_pos [k - 1]] != _id)
+				{
+					typename _GraphAdjList<_TpVertex, _TpEdge>::iterator _itA = _nodeTable [_id]->adjlist ().begin ();
+					typename _GraphAdjList<_TpVertex, _TpEdge>::iterator _itAEnd = _nodeTable [_id]->adjlist ().end ();
+
+					for (; _itA != _itAEnd; ++_itA)
+						_mark [_itA->node ().id ()] = _id;
+				}
+
+				if (_mark [_id2 [i]] != _id)
+				{
+					_mark [_id2 [i]] = _id;
+					_selected [i] = 1;
+				}
+			}
+
+			for (size_t i = 0; i < _n; i++)
+			{
+				if (_selected [i])
+					_sel.push_back (i);
+			}
+		}
+
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_link_edge (_Node& _n1, _Node& _n2, _Edge& _e)
+		{
+			_n1._insert (_e, _n2, _type._inverse);
+			_bitMatrix._insert (_n1.id (), _n2.id (), &_e);
+
+			if (! _type._directed && &_n1 != &_n2)
+			{
+				_n2._insert (_e, _n1, _type._inverse);
+				_bitMatrix._insert (_n2.id (), _n1.id (), &_e);
+			}
+		}
+
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_sort_by_id (cgt::base::array<size_t>& _pos, const cgt::base::array<size_t>& _key) const
+		{
+			cgt::base::array<size_t> _count (_nodeTable.size () + 1, 0);
+
+			for (size_t k = 0; k < _pos.size (); k++)
+				_count [_key [_pos [k]] + 1]++;
+
+			for (size_t i = 1; i < _count.size (); i++)
+				_count [i] += _count [i - 1];
+
+			cgt::base::array<size_t> _sorted (_pos.size (), 0);
+
+			for (size_t k = 0; k < _pos.size (); k++)
+				_sorted [_count [_key [_pos [k]]]++] = _pos [k];
+
+			_pos.swap (_sorted);
+		}
+
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_invert ()
+		{
+			/*
+			 * a graph without inverted lists can't be inverted
+			 * (the size of this array is negative if _inverse is false)
+			 */
+
+			typedef char _graph_type_has_no_inverted_lists [_TpGraphType::_inverse ? 1 : -1];
+			(void) sizeof (_graph_type_has_no_inverted_lists);
+
 			/*
 			 * for each node, call _invert_edges ()
 			 */
@@ -180,16 +525,20 @@ namespace cgt
 
 			for (iterator _it = _Base::begin (); _it != _itEnd; ++_it)
 				_it->_invert_edges ();
+
+			/* the matrix follows the lists: its rows become its columns */
+
+			_bitMatrix._transpose ();
 		}
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		const bool _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType>::_is_directed () const
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		const bool _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_is_directed () const
 		{
 			return _type._directed;
 		}
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		const bool _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType>::_is_undirected () const
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		const bool _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_is_undirected () const
 		{
 			return (! _is_directed ());
 		}
@@ -235,13 +584,19 @@ namespace cgt
 	 *
 	 * And the total size of an undirected graph is:
 	 * <b>24 + v * (32 + sizeof (_TpVertex)) + e * (64 + sizeof (_TpEdge))</b>.
+	 *
+	 * Each node also keeps its id, and the table from ids to nodes has a
+	 * pointer per node, so we need 2 * sizeof (size_t) more bytes per vertex.
+	 *
+	 * Dense graph types (see _DirectedDense) keep also a matrix of bits, of
+	 * about <b>v * v / 8</b> bytes (see _GraphBitMatrix).
 	 */
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		class _GraphAdjMatrix : public _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType>
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		class _GraphAdjMatrix : public _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>
 	{
 		private:
-			typedef _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType> _Base;
+			typedef _GraphAdjMatrixBase<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash> _Base;
 
 		private:
 			typedef typename _Base::_Node	_Node;
@@ -257,10 +612,54 @@ namespace cgt
 		protected:
 			void _insert_edge (const _TpEdge &_e, const _TpVertex &_v1, const _TpVertex &_v2);
 			void _insert_edge (const _TpEdge &_e, iterator& _it_v1, iterator& _it_v2);
+
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+		private:
+			template<typename... _Args>
+				void _emplace_edge_if_not_exists (_Node* _n1, _Node* _n2, _Args&&... _args);
+
+		protected:
+			/**
+			 * Like _insert_edge (), but the value of the edge is built from \b _args
+			 * in the item of the edge's list. If there's an edge from \b _v1 to
+			 * \b _v2 already (or a vertex isn't found), nothing is built.
+			 */
+			template<typename... _Args>
+				void _emplace_edge (const _TpVertex &_v1, const _TpVertex &_v2, _Args&&... _args);
+			template<typename... _Args>
+				void _emplace_edge (iterator& _it_v1, iterator& _it_v2, _Args&&... _args);
+#endif
+
+			template<typename _TpInputIterator>
+				void _insert_edges (_TpInputIterator _first, const _TpInputIterator& _last);
 	};
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType>::_insert_edge (const _TpEdge &_e, const _TpVertex &_v1, const _TpVertex &_v2)
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		template<typename _TpInputIterator>
+		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_insert_edges (_TpInputIterator _first, const _TpInputIterator& _last)
+		{
+			cgt::base::array<_GraphEdgeSpec<_TpVertex, _TpEdge> > _specs;
+
+			for (; _first != _last; ++_first)
+				_specs.push_back (*_first);
+
+			cgt::base::array<_Node*> _ends;
+			cgt::base::array<size_t> _sel;
+			_Base::_select_edges (_specs, _ends, _sel);
+
+			for (size_t k = 0; k < _sel.size (); k++)
+			{
+				size_t i = _sel [k];
+				_Node& _n1 = *(_ends [2 * i]);
+				_Node& _n2 = *(_ends [2 * i + 1]);
+
+				_Base::_edgeList.push_back (_Edge (_specs [i].value (), _n1.vertex (), _n2.vertex ()));
+				_Base::_link_edge (_n1, _n2, _Base::_edgeList.back ());
+			}
+		}
+
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_insert_edge (const _TpEdge &_e, const _TpVertex &_v1, const _TpVertex &_v2)
 		{
 			_Node *_ptr_n1 = _Base::_get_node (_v1);
 
@@ -273,19 +672,18 @@ namespace cgt
 			}
 		}
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType>::_insert_edge (const _TpEdge &_e, iterator& _it_v1, iterator& _it_v2)
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_insert_edge (const _TpEdge &_e, iterator& _it_v1, iterator& _it_v2)
 		{
 			_insert_edge_if_not_exists (&(*_it_v1), &(*_it_v2), _e);
 		}
 
-	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
-		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType>::_insert_edge_if_not_exists (_Node* _ptr_n1, _Node* _ptr_n2, const _TpEdge& _e)
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_insert_edge_if_not_exists (_Node* _ptr_n1, _Node* _ptr_n2, const _TpEdge& _e)
 		{
-			_Vertex& _vertex2 = _ptr_n2->vertex ();
-
-			if (! _ptr_n1->get_edge (_vertex2))
+			if (! _Base::_has_edge (*_ptr_n1, *_ptr_n2))
 			{
+				_Vertex& _vertex2 = _ptr_n2->vertex ();
 				_Vertex& _vertex1 = _ptr_n1->vertex ();
 				//_Edge &_edge = *(_Base::_edgeList.push_back (_Edge (_e, _vertex1, _vertex2)));
 				_Base::_edgeList.push_back (_Edge (_e, _vertex1, _vertex2));
@@ -295,16 +693,55 @@ namespace cgt
 		}
 
 
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		template<typename... _Args>
+		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_emplace_edge (const _TpVertex &_v1, const _TpVertex &_v2, _Args&&... _args)
+		{
+			_Node *_ptr_n1 = _Base::_get_node (_v1);
+
+			if (_ptr_n1)
+			{
+				_Node *_ptr_n2 = _Base::_get_node (_v2);
+
+				if (_ptr_n2)
+					_emplace_edge_if_not_exists (_ptr_n1, _ptr_n2, std::forward<_Args>(_args)...);
+			}
+		}
+
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		template<typename... _Args>
+		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_emplace_edge (iterator& _it_v1, iterator& _it_v2, _Args&&... _args)
+		{
+			_emplace_edge_if_not_exists (&(*_it_v1), &(*_it_v2), std::forward<_Args>(_args)...);
+		}
+
+	template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
+		template<typename... _Args>
+		void _GraphAdjMatrix<_TpVertex, _TpEdge, _TpGraphType, _TpVertexHash>::_emplace_edge_if_not_exists (_Node* _ptr_n1, _Node* _ptr_n2, _Args&&... _args)
+		{
+			if (! _Base::_has_edge (*_ptr_n1, *_ptr_n2))
+			{
+				_Vertex& _vertex2 = _ptr_n2->vertex ();
+				_Vertex& _vertex1 = _ptr_n1->vertex ();
+				_Base::_edgeList.emplace_back (_vertex1, _vertex2, std::forward<_Args>(_args)...);
+				_Edge &_edge = _Base::_edgeList.back ();
+				_Base::_insert_edge (*_ptr_n1, *_ptr_n2, _vertex1, _vertex2, _edge);
+			}
+		}
+#endif
+
+
 	/*
 	 * A simple graph, with no type for edges
 	 */
 
 
-	template<typename _TpVertex, typename _TpGraphType>
-		class _GraphAdjMatrix<_TpVertex, void, _TpGraphType> : public _GraphAdjMatrixBase<_TpVertex, void, _TpGraphType>
+	template<typename _TpVertex, typename _TpGraphType, typename _TpVertexHash>
+		class _GraphAdjMatrix<_TpVertex, void, _TpGraphType, _TpVertexHash> : public _GraphAdjMatrixBase<_TpVertex, void, _TpGraphType, _TpVertexHash>
 		{
 			private:
-				typedef _GraphAdjMatrixBase<_TpVertex, void, _TpGraphType> _Base;
+				typedef _GraphAdjMatrixBase<_TpVertex, void, _TpGraphType, _TpVertexHash> _Base;
 
 			private:
 				typedef typename _Base::_Node	_Node;
@@ -320,10 +757,37 @@ namespace cgt
 			protected:
 				void _insert_edge (const _TpVertex &_v1, const _TpVertex &_v2);
 				void _insert_edge (iterator& _it_v1, iterator& _it_v2);
+
+				template<typename _TpInputIterator>
+					void _insert_edges (_TpInputIterator _first, const _TpInputIterator& _last);
 		};
 
-	template<typename _TpVertex, typename _TpGraphType>
-		void _GraphAdjMatrix<_TpVertex, void, _TpGraphType>::_insert_edge (const _TpVertex &_v1, const _TpVertex &_v2)
+	template<typename _TpVertex, typename _TpGraphType, typename _TpVertexHash>
+		template<typename _TpInputIterator>
+		void _GraphAdjMatrix<_TpVertex, void, _TpGraphType, _TpVertexHash>::_insert_edges (_TpInputIterator _first, const _TpInputIterator& _last)
+		{
+			cgt::base::array<_GraphEdgeSpec<_TpVertex, void> > _specs;
+
+			for (; _first != _last; ++_first)
+				_specs.push_back (*_first);
+
+			cgt::base::array<_Node*> _ends;
+			cgt::base::array<size_t> _sel;
+			_Base::_select_edges (_specs, _ends, _sel);
+
+			for (size_t k = 0; k < _sel.size (); k++)
+			{
+				size_t i = _sel [k];
+				_Node& _n1 = *(_ends [2 * i]);
+				_Node& _n2 = *(_ends [2 * i + 1]);
+
+				_Base::_edgeList.push_back (_Edge (_n1.vertex (), _n2.vertex ()));
+				_Base::_link_edge (_n1, _n2, _Base::_edgeList.back ());
+			}
+		}
+
+	template<typename _TpVertex, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrix<_TpVertex, void, _TpGraphType, _TpVertexHash>::_insert_edge (const _TpVertex &_v1, const _TpVertex &_v2)
 		{
 			_Node *_ptr_n1 = _Base::_get_node (_v1);
 
@@ -336,19 +800,18 @@ namespace cgt
 			}
 		}
 
-	template<typename _TpVertex, typename _TpGraphType>
-		void _GraphAdjMatrix<_TpVertex, void, _TpGraphType>::_insert_edge (iterator& _it_v1, iterator& _it_v2)
+	template<typename _TpVertex, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrix<_TpVertex, void, _TpGraphType, _TpVertexHash>::_insert_edge (iterator& _it_v1, iterator& _it_v2)
 		{
 			_insert_edge_if_not_exists (&(*_it_v1), &(*_it_v2));
 		}
 
-	template<typename _TpVertex, typename _TpGraphType>
-		void _GraphAdjMatrix<_TpVertex, void, _TpGraphType>::_insert_edge_if_not_exists (_Node* _ptr_n1, _Node* _ptr_n2)
+	template<typename _TpVertex, typename _TpGraphType, typename _TpVertexHash>
+		void _GraphAdjMatrix<_TpVertex, void, _TpGraphType, _TpVertexHash>::_insert_edge_if_not_exists (_Node* _ptr_n1, _Node* _ptr_n2)
 		{
-			_Vertex& _vertex2 = _ptr_n2->vertex ();
-
-			if (! _ptr_n1->get_edge (_vertex2))
+			if (! _Base::_has_edge (*_ptr_n1, *_ptr_n2))
 			{
+				_Vertex& _vertex2 = _ptr_n2->vertex ();
 				_Vertex& _vertex1 = _ptr_n1->vertex ();
 				//_Edge &_edge = *(_Base::_edgeList.push_back (_Edge (_vertex1, _vertex2)));
 				_Base::_edgeList.push_back (_Edge (_vertex1, _vertex2));
@@ -0,0 +1,272 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/graph_bit_matrix.h
+ * \brief Contains the adjacency matrix (of bits, and optionally of edges) kept by dense graphs.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_GRAPH_BIT_MATRIX_H_
+#define __CGTL__CGT_GRAPH_BIT_MATRIX_H_
+
+#include "cgt/graph_type.h"
+#include "cgt/graph_node.h"
+#include "cgt/graph_edge.h"
+#include "cgt/base/array.h"
+#include "cgt/base/bitset.h"
+
+
+namespace cgt
+{
+  /*!
+   * \class _GraphBitMatrix
+   * \brief The adjacency matrix of a graph, indexed by node ids, kept besides its adjacency lists.
+   * \author Leandro Costa
+   * \date 2011
+   *
+   * Its contents depend on the \b _matrix of the graph type (see _GraphMatrix).
+   * By default (_NO_MATRIX) it's empty, and edges are found in the adjacency
+   * lists of the nodes.
+   *
+   * With _BIT_MATRIX, row \b i has a bit for each node, set if there's an edge
+   * from the node with id \b i to it. Rows are packed in words, one after
+   * another, so _has_edge is \b O(1), and the neighbours of a node can be
+   * combined with a cgt::base::bitset a word at a time. With _EDGE_MATRIX
+   * there's also a pointer to the edge of each cell, so _get_edge is \b O(1)
+   * too.
+   *
+   * Rows have room for a number of bits that doubles when it's exceeded
+   * (the matrix is copied to the new layout), so the bit matrix takes
+   * between <b>V * V / 8</b> and <b>V * V / 4</b> bytes, and the matrix
+   * of edges <b>V * V * sizeof (void*)</b> bytes.
+   */
+
+  template<typename _TpVertex, typename _TpEdge, int _TpMatrix>
+    class _GraphBitMatrix
+    {
+      private:
+        typedef _GraphNode<_TpVertex, _TpEdge>  _Node;
+        typedef _GraphEdge<_TpVertex, _TpEdge>  _Edge;
+
+      public:
+        void _insert_node () { }
+        void _insert (const size_t& _i, const size_t& _j, _Edge* const _e) { }
+        void _transpose () { }
+
+      public:
+        const bool _has_edge (const _Node& _n1, const _Node& _n2) const { return (_n1.get_edge (_n2) != NULL); }
+        _Edge* _get_edge (const _Node& _n1, const _Node& _n2) const { return _n1.get_edge (_n2); }
+    };
+
+
+  template<typename _TpVertex, typename _TpEdge>
+    class _GraphBitMatrix<_TpVertex, _TpEdge, _BIT_MATRIX>
+    {
+      private:
+        typedef _GraphNode<_TpVertex, _TpEdge>  _Node;
+        typedef _GraphEdge<_TpVertex, _TpEdge>  _Edge;
+
+      public:
+        _GraphBitMatrix () : _n (0), _stride (0) { }
+
+      public:
+        /** adds an empty row (and column) for a new node: amortized O(V / w) */
+        void _insert_node ();
+        void _insert (const size_t& _i, const size_t& _j, _Edge* const _e) { _bits [_i * _stride + _j / cgt::base::_BITS_PER_WORD] |= _bit (_j); }
+
+        /** swaps rows and columns, for an inverted graph: O(V * V) */
+        void _transpose ();
+
+      public:
+        const bool _test (const size_t& _i, const size_t& _j) const { return (_bits [_i * _stride + _j / cgt::base::_BITS_PER_WORD] & _bit (_j)) != 0; }
+        const bool _has_edge (const _Node& _n1, const _Node& _n2) const { return _test (_n1.id (), _n2.id ()); }
+        _Edge* _get_edge (const _Node& _n1, const _Node& _n2) const { return (_has_edge (_n1, _n2) ? _n1.get_edge (_n2) : NULL); }
+
+        /** the words of row \b _i: at least cgt::base::_num_words (V) of them */
+        const cgt::base::_BitWord* _row (const size_t& _i) const { return &(_bits [_i * _stride]); }
+
+        /*!
+         * Puts in \b _set the nodes reachable from the node with id \b _i (including it).
+         * It's a breadth-first search that expands the whole frontier at once, as the union
+         * of the rows of its nodes: O(V * V / w) word operations.
+         */
+        void _reachable (const size_t& _i, cgt::base::bitset& _set) const;
+
+      private:
+        static cgt::base::_BitWord _bit (const size_t& _j) { return static_cast<cgt::base::_BitWord>(1) << (_j % cgt::base::_BITS_PER_WORD); }
+
+      protected:
+        size_t  _n;       /** < the number of rows */
+        size_t  _stride;  /** < the number of words of each row */
+
+      private:
+        cgt::base::array<cgt::base::_BitWord> _bits;
+    };
+
+  template<typename _TpVertex, typename _TpEdge>
+    void _GraphBitMatrix<_TpVertex, _TpEdge, _BIT_MATRIX>::_insert_node ()
+    {
+      if (_n == _stride * cgt::base::_BITS_PER_WORD)
+      {
+        /*
+         * the rows are full: the number of words of each row
+         * doubles, and the rows are copied to the new layout
+         */
+
+        size_t _s = (_stride ? 2 * _stride : 1);
+        cgt::base::array<cgt::base::_BitWord> _new;
+        _new.reserve ((_n + 1) * _s);
+        _new.resize (_n * _s, 0);
+
+        for (size_t i = 0; i < _n; i++)
+          for (size_t k = 0; k < _stride; k++)
+            _new [i * _s + k] = _bits [i * _stride + k];
+
+        _bits.swap (_new);
+        _stride = _s;
+      }
+
+      _bits.resize ((_n + 1) * _stride, 0);
+      _n++;
+    }
+
+  template<typename _TpVertex, typename _TpEdge>
+    void _GraphBitMatrix<_TpVertex, _TpEdge, _BIT_MATRIX>::_transpose ()
+    {
+      cgt::base::array<cgt::base::_BitWord> _new (_bits.size (), 0);
+
+      for (size_t i = 0; i < _n; i++)
+        for (size_t j = 0; j < _n; j++)
+          if (_test (i, j))
+            _new [j * _stride + i / cgt::base::_BITS_PER_WORD] |= _bit (i);
+
+      _bits.swap (_new);
+    }
+
+  template<typename _TpVertex, typename _TpEdge>
+    void _GraphBitMatrix<_TpVertex, _TpEdge, _BIT_MATRIX>::_reachable (const size_t& _i, cgt::base::bitset& _set) const
+    {
+      cgt::base::bitset _frontier (_n);
+      cgt::base::bitset _next (_n);
+
+      _set = cgt::base::bitset (_n);
+      _set.set (_i);
+      _frontier.set (_i);
+
+      while (_frontier.any ())
+      {
+        _next.clear ();
+
+        for (size_t j = _frontier.find_first (); j < _n; j = _frontier.find_next (j + 1))
+          _next.or_words (_row (j));
+
+        _next.and_not (_set);
+        _set |= _next;
+        _frontier.swap (_next);
+      }
+    }
+
+
+  /*!
+   * \class _GraphBitMatrix<_TpVertex, _TpEdge, _EDGE_MATRIX>
+   * \brief The bit matrix plus a matrix of pointers to the edges (see _GraphBitMatrix).
+   * \author Leandro Costa
+   * \date 2011
+   */
+
+  template<typename _TpVertex, typename _TpEdge>
+    class _GraphBitMatrix<_TpVertex, _TpEdge, _EDGE_MATRIX> : public _GraphBitMatrix<_TpVertex, _TpEdge, _BIT_MATRIX>
+    {
+      private:
+        typedef _GraphBitMatrix<_TpVertex, _TpEdge, _BIT_MATRIX> _Base;
+        typedef _GraphNode<_TpVertex, _TpEdge>  _Node;
+        typedef _GraphEdge<_TpVertex, _TpEdge>  _Edge;
+
+      public:
+        _GraphBitMatrix () : _capacity (0) { }
+
+      public:
+        void _insert_node ();
+        void _insert (const size_t& _i, const size_t& _j, _Edge* const _e)
+        {
+          _Base::_insert (_i, _j, _e);
+          _edges [_i * _capacity + _j] = _e;
+        }
+
+        void _transpose ();
+
+      public:
+        _Edge* _get_edge (const _Node& _n1, const _Node& _n2) const { return _edges [_n1.id () * _capacity + _n2.id ()]; }
+
+      private:
+        size_t                  _capacity; /** < the number of cells of each row of _edges */
+        cgt::base::array<_Edge*> _edges;
+    };
+
+  template<typename _TpVertex, typename _TpEdge>
+    void _GraphBitMatrix<_TpVertex, _TpEdge, _EDGE_MATRIX>::_insert_node ()
+    {
+      size_t _n = _Base::_n;
+
+      _Base::_insert_node ();
+
+      if (_n == _capacity)
+      {
+        size_t _c = (_capacity ? 2 * _capacity : 1);
+        cgt::base::array<_Edge*> _new;
+        _new.reserve ((_n + 1) * _c);
+        _new.resize (_n * _c, NULL);
+
+        for (size_t i = 0; i < _n; i++)
+          for (size_t j = 0; j < _n; j++)
+            _new [i * _c + j] = _edges [i * _capacity + j];
+
+        _edges.swap (_new);
+        _capacity = _c;
+      }
+
+      _edges.resize ((_n + 1) * _capacity, NULL);
+    }
+
+  template<typename _TpVertex, typename _TpEdge>
+    void _GraphBitMatrix<_TpVertex, _TpEdge, _EDGE_MATRIX>::_transpose ()
+    {
+      _Base::_transpose ();
+
+      for (size_t i = 0; i < _Base::_n; i++)
+      {
+        for (size_t j = i + 1; j < _Base::_n; j++)
+        {
+          _Edge* _e = _edges [i * _capacity + j];
+          _edges [i * _capacity + j] = _edges [j * _capacity + i];
+          _edges [j * _capacity + i] = _e;
+        }
+      }
+    }
+}
+
+#endif // __CGTL__CGT_GRAPH_BIT_MATRIX_H_
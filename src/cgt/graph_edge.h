@@ -33,6 +33,8 @@
 #ifndef __CGTL__CGT_GRAPH_EDGE_H_
 #define __CGTL__CGT_GRAPH_EDGE_H_
 
+#include "cgt/misc/cxx11.h"
+
 
 namespace cgt
 {
@@ -108,6 +110,11 @@ namespace cgt
 
 		public:
 			_GraphEdge (const _TpEdge& _e, _Vertex& _v1, _Vertex& _v2) : _Base (_v1, _v2), _value (_e) { }
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+			/** an edge whose value is built in place from \b _args (see graph::emplace_edge ()) */
+			template<typename... _Args>
+				_GraphEdge (_Vertex& _v1, _Vertex& _v2, _Args&&... _args) : _Base (_v1, _v2), _value (std::forward<_Args>(_args)...) { }
+#endif
 
 		public:
 			inline _GraphEdge& operator=(const _GraphEdge& _other)
@@ -144,6 +151,49 @@ namespace cgt
 			public:
 				_GraphEdge (_Vertex& _v1, _Vertex& _v2) : _Base (_v1, _v2) { }
 		};
+
+
+	/*!
+	 * \class _GraphEdgeSpec
+	 * \brief An edge to be inserted by graph::insert_edges (): its value and the values of its vertices.
+	 * \author Leandro Costa
+	 * \date 2011
+	 *
+	 * Unlike _GraphEdge, it refers to no node: it just keeps copies of the
+	 * edge and of its vertices, like the arguments of graph::insert_edge ().
+	 */
+
+	template<typename _TpVertex, typename _TpEdge = void>
+		class _GraphEdgeSpec
+		{
+			public:
+				_GraphEdgeSpec (const _TpEdge& _e, const _TpVertex& _v1, const _TpVertex& _v2) : _value (_e), _vertex1 (_v1), _vertex2 (_v2) { }
+
+			public:
+				inline const _TpEdge& value () const { return _value; }
+				inline const _TpVertex& v1 () const { return _vertex1; }
+				inline const _TpVertex& v2 () const { return _vertex2; }
+
+			private:
+				_TpEdge   _value;
+				_TpVertex _vertex1;
+				_TpVertex _vertex2;
+		};
+
+	template<typename _TpVertex>
+		class _GraphEdgeSpec<_TpVertex, void>
+		{
+			public:
+				_GraphEdgeSpec (const _TpVertex& _v1, const _TpVertex& _v2) : _vertex1 (_v1), _vertex2 (_v2) { }
+
+			public:
+				inline const _TpVertex& v1 () const { return _vertex1; }
+				inline const _TpVertex& v2 () const { return _vertex2; }
+
+			private:
+				_TpVertex _vertex1;
+				_TpVertex _vertex2;
+		};
 }
 
 #endif // __CGTL__CGT_GRAPH_EDGE_H_
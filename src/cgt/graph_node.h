@@ -42,11 +42,11 @@ namespace cgt
 {
   namespace stconncomp
   {
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      class _SCCIterator;
+    template<typename _TpVertex, typename _TpEdge>
+      class _SCCEngine;
   }
 
-  template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
+  template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
     class _GraphAdjMatrixBase;
 
   /*!
@@ -64,18 +64,19 @@ namespace cgt
    * A _GraphNode has a vertex and two adjacency lists. The overhead of a vertex
    * is 0, and the size of an adjacency list is <b>12 + 16n bytes</b>, where n is
    * the number of edges of the vertex. So, the _GraphNode's size is
-   * <b>24 + 32n + sizeof (_TpVertex) bytes</b>.
+   * <b>24 + 32n + sizeof (_TpVertex) bytes</b>. In graphs whose type has no
+   * inverted lists (see _DirectedNoInverse) the second list stays empty, and
+   * the size drops to <b>24 + 16n + sizeof (_TpVertex) bytes</b>.
    */
 
   template<typename _TpVertex, typename _TpEdge>
     class _GraphNode
     {
       private:
-        friend class _GraphAdjMatrixBase<_TpVertex, _TpEdge, cgt::_Directed>;
-        friend class _GraphAdjMatrixBase<_TpVertex, _TpEdge, cgt::_Undirected>;
+        template<typename _TpV, typename _TpE, typename _TpGraphType, typename _TpVertexHash>
+          friend class cgt::_GraphAdjMatrixBase;
 
-        friend  class cgt::stconncomp::_SCCIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpCommon>;
-        friend  class cgt::stconncomp::_SCCIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpConst>;
+        friend  class cgt::stconncomp::_SCCEngine<_TpVertex, _TpEdge>;
 
       private:
         typedef _GraphNode<_TpVertex, _TpEdge>    _Self;
@@ -83,16 +84,31 @@ namespace cgt
         typedef _GraphAdjList<_TpVertex, _TpEdge> _AdjList;
 
       public:
-        explicit _GraphNode (const _TpVertex &_v) : _vertex (_v) { };
+        explicit _GraphNode (const _TpVertex &_v, const size_t& _i = 0) : _vertex (_v), _id (_i) { };
+#ifdef CGTL_DO_NOT_USE_STL
+        /** a node whose adjacency lists allocate from the arena \b _arena (see _GraphArena) */
+        _GraphNode (const _TpVertex &_v, const size_t& _i, cgt::base::alloc::_Arena* const _arena) : _vertex (_v), _adjList (_arena), _invAdjList (_arena), _id (_i) { };
+#endif
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+        /** nodes whose vertex is moved in, not copied (see graph::emplace_vertex ()) */
+        explicit _GraphNode (_TpVertex&& _v, const size_t& _i = 0) : _vertex (std::move (_v)), _id (_i) { };
+#ifdef CGTL_DO_NOT_USE_STL
+        _GraphNode (_TpVertex&& _v, const size_t& _i, cgt::base::alloc::_Arena* const _arena) : _vertex (std::move (_v)), _adjList (_arena), _invAdjList (_arena), _id (_i) { };
+#endif
+#endif
 
       private:
-        inline void _insert (_GraphEdge<_TpVertex, _TpEdge>& _e, _Self& _n)
+        /** inserts the edge into _adjList and, if \b _inverse is true, into the _invAdjList of \b _n */
+        inline void _insert (_GraphEdge<_TpVertex, _TpEdge>& _e, _Self& _n, const bool& _inverse = true)
         {
           _adjList._insert (_e, _n);
-          _n._insert_inverse (_e, *this);
+
+          if (_inverse)
+            _n._insert_inverse (_e, *this);
         }
 
         inline void _insert_inverse (_GraphEdge<_TpVertex, _TpEdge>& _e, _Self& _n) { _invAdjList._insert (_e, _n); }
+        inline void _clear_inverse () { _invAdjList._clear (); }
 
 #ifdef CGTL_DO_NOT_USE_STL
         inline void _invert_edges () { _AdjList::swap (_adjList, _invAdjList); } /*!< time complexity: O(1) */
@@ -107,10 +123,12 @@ namespace cgt
         inline const _AdjList&  adjlist () const { return _adjList; }
         inline _AdjList&  iadjlist () { return _invAdjList; }
         inline const _AdjList&  iadjlist () const { return _invAdjList; }
-        inline _TpVertex& value () { return _vertex.value (); }
+        inline const _TpVertex& value () { return _vertex.value (); }
         inline const _TpVertex& value () const { return _vertex.value (); }
+        inline const size_t& id () const { return _id; }
 
         inline _GraphEdge<_TpVertex, _TpEdge>* get_edge (const _Vertex& _v) const { return _adjList.get_edge (_v); }
+        inline _GraphEdge<_TpVertex, _TpEdge>* get_edge (const _Self& _n) const { return _adjList.get_edge (_n); }
 
       private:
         _Vertex   _vertex;
@@ -121,9 +139,19 @@ namespace cgt
          * inverted edge pointing to n2, it means n2 has an edge
          * pointing to n1. This way we can invert a graph in O(V),
          * just swapping the two lists: _adjList and _invAdjList.
+         * It's empty if the graph's type has no inverted lists.
          */
 
         _AdjList  _invAdjList;
+
+        /*!
+         * The position of the node in the graph's node list, given when
+         * it's inserted. Nodes are never removed, so ids are dense (from 0
+         * to V - 1) and stable, and algorithms can keep the state of each
+         * node in an array indexed by id instead of searching a list.
+         */
+
+        size_t    _id;
     };
 }
 
@@ -32,6 +32,19 @@
 
 namespace cgt
 {
+  /*!
+   * \enum _GraphMatrix
+   * \brief The adjacency matrix a graph keeps besides its adjacency lists (the \b _matrix of its type).
+   * \author Leandro Costa
+   * \date 2011
+   *
+   * _NO_MATRIX keeps none, _BIT_MATRIX keeps a matrix of bits (an edge test
+   * in O(1)), and _EDGE_MATRIX keeps also a matrix of pointers to the edges
+   * (get_edge in O(1)). See _GraphBitMatrix.
+   */
+
+  enum _GraphMatrix { _NO_MATRIX = 0, _BIT_MATRIX = 1, _EDGE_MATRIX = 2 };
+
   /*!
    * \struct _GraphTypeDirected
    * \typedef _Directed
@@ -42,7 +55,7 @@ namespace cgt
 
   typedef struct _GraphTypeDirected
   {
-    enum { _directed = true };
+    enum { _directed = true, _inverse = true, _matrix = _NO_MATRIX };
   } _Directed;
 
   /*!
@@ -55,8 +68,81 @@ namespace cgt
 
   typedef struct _GraphTypeUndirected
   {
-    enum { _directed = false };
+    enum { _directed = false, _inverse = true, _matrix = _NO_MATRIX };
   } _Undirected;
+
+  /*!
+   * \struct _GraphTypeDirectedNoInverse
+   * \typedef _DirectedNoInverse
+   * \brief Used to define a directed graph without inverted adjacency lists.
+   * \author Leandro Costa
+   * \date 2011
+   *
+   * Nodes of a graph whose type has \b _inverse set to false don't keep the
+   * list of edges that point to them (_GraphNode::iadjlist () is empty), so
+   * edges take half of the adjacency memory and are inserted faster. The
+   * graph can't be inverted: a call to invert () doesn't compile. Strongly
+   * connected components are still available, but each scciterator builds
+   * the inverted lists while it runs the DFS on the transposed graph, and
+   * releases them afterwards.
+   */
+
+  typedef struct _GraphTypeDirectedNoInverse
+  {
+    enum { _directed = true, _inverse = false, _matrix = _NO_MATRIX };
+  } _DirectedNoInverse;
+
+  /*!
+   * \struct _GraphTypeUndirectedNoInverse
+   * \typedef _UndirectedNoInverse
+   * \brief Used to define an undirected graph without inverted adjacency lists.
+   * \author Leandro Costa
+   * \date 2011
+   *
+   * In an undirected graph the inverted lists hold the same adjacencies as
+   * the lists themselves, so most undirected graphs don't need them either
+   * (see _DirectedNoInverse).
+   */
+
+  typedef struct _GraphTypeUndirectedNoInverse
+  {
+    enum { _directed = false, _inverse = false, _matrix = _NO_MATRIX };
+  } _UndirectedNoInverse;
+
+  /*!
+   * \struct _GraphTypeDirectedDense
+   * \typedef _DirectedDense
+   * \brief Used to define a directed graph that keeps a bit matrix of its edges.
+   * \author Leandro Costa
+   * \date 2011
+   *
+   * For dense graphs: besides the adjacency lists (so all iterators work as
+   * usual), the graph keeps a matrix of bits indexed by node ids, that takes
+   * about <b>V * V / 8</b> bytes. Edge tests (has_edge (), and the check for
+   * repeated edges done by insert_edge ()) take \b O(1), and the neighbours of
+   * nodes can be combined as cgt::base::bitset (see neighbours () and
+   * reachable ()). To find edges (get_edge ()) in \b O(1) too, a type can set
+   * \b _matrix to _EDGE_MATRIX, which also keeps a matrix of pointers to the
+   * edges (<b>V * V * sizeof (void*)</b> bytes).
+   */
+
+  typedef struct _GraphTypeDirectedDense
+  {
+    enum { _directed = true, _inverse = true, _matrix = _BIT_MATRIX };
+  } _DirectedDense;
+
+  /*!
+   * \struct _GraphTypeUndirectedDense
+   * \typedef _UndirectedDense
+   * \brief Used to define an undirected graph that keeps a bit matrix of its edges (see _DirectedDense).
+   * \author Leandro Costa
+   * \date 2011
+   */
+
+  typedef struct _GraphTypeUndirectedDense
+  {
+    enum { _directed = false, _inverse = true, _matrix = _BIT_MATRIX };
+  } _UndirectedDense;
 }
 
 #endif
@@ -33,6 +33,8 @@
 #ifndef __CGTL__CGT__GRAPH_VERTEX_H_
 #define __CGTL__CGT__GRAPH_VERTEX_H_
 
+#include "cgt/misc/cxx11.h"
+
 
 namespace cgt
 {
@@ -61,7 +63,10 @@ namespace cgt
     class _GraphVertex
     {
       public:
-        explicit _GraphVertex (const _TpVertex& _v) { _value = _v; }
+        explicit _GraphVertex (const _TpVertex& _v) : _value (_v) { }
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+        explicit _GraphVertex (_TpVertex&& _v) : _value (std::move (_v)) { }
+#endif
 
       public:
         inline const bool operator==(const _GraphVertex<_TpVertex>& _v) const { return (_value == _v.value ()); }
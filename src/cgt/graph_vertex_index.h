@@ -0,0 +1,280 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/graph_vertex_index.h
+ * \brief Contains the definition of the index used to find a node by its vertex.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_GRAPH_VERTEX_INDEX_H_
+#define __CGTL__CGT_GRAPH_VERTEX_INDEX_H_
+
+#include "cgt/base/hash.h"
+#include "cgt/base/array.h"
+#include "cgt/base/sort.h"
+
+
+namespace cgt
+{
+  /*!
+   * \class _GraphVertexKey
+   * \brief The key of a vertex index: a pointer to the vertex stored in its node.
+   * \author Leandro Costa
+   * \date 2011
+   *
+   * The index doesn't copy vertices, it keeps a pointer to the value stored
+   * in the node. Keys are compared by the value they point to, so a lookup
+   * only needs a key pointing to the searched value.
+   */
+
+  template<typename _TpVertex>
+    class _GraphVertexKey
+    {
+      public:
+        _GraphVertexKey (const _TpVertex* _p) : _ptr (_p) { }
+
+      public:
+        const bool operator==(const _GraphVertexKey& _k) const { return (*_ptr == *(_k._ptr)); }
+        const bool operator!=(const _GraphVertexKey& _k) const { return (! (*this == _k)); }
+
+      public:
+        const _TpVertex* _ptr;
+    };
+
+
+  /*!
+   * \struct _GraphVertexKeyHash
+   * \brief Adapts a hasher of vertices (\b _TpVertexHash) to the keys of the index.
+   * \author Leandro Costa
+   * \date 2011
+   */
+
+  template<typename _TpVertex, typename _TpVertexHash>
+    struct _GraphVertexKeyHash
+    {
+      const size_t operator()(const _GraphVertexKey<_TpVertex>& _k) const { return _hash (*(_k._ptr)); }
+
+      _TpVertexHash _hash;
+    };
+
+
+  /*!
+   * \class _GraphVertexIndex
+   * \brief An index from vertices to the nodes that contain them.
+   * \author Leandro Costa
+   * \date 2011
+   *
+   * Maps each vertex to the position of its node in the node's list, so
+   * _find and _get_node run in expected time \b O(1) instead of \b O(V).
+   * The hash function is \b _TpVertexHash, a functor with a
+   * <b>size_t operator()(const _TpVertex&) const</b> (cgt::base::_HashFunc
+   * works for plain types, std::hash can be used with C++11).
+   *
+   * The index costs one hash item (3 pointers) per vertex. Since the graph
+   * never removes nodes, it only has to be updated when a node is inserted.
+   * Items are allocated from the graph's arena, if it has one.
+   */
+
+  template<typename _TpVertex, typename _TpIterator, typename _TpVertexHash>
+    class _GraphVertexIndex
+    {
+      private:
+        typedef _GraphVertexKey<_TpVertex>                      _Key;
+        typedef _GraphVertexKeyHash<_TpVertex, _TpVertexHash>   _KeyHash;
+        typedef cgt::base::alloc::_Allocator<cgt::base::_HashItem<cgt::base::pair<const _Key, _TpIterator> > > _Alloc;
+        typedef cgt::base::hash<_Key, _TpIterator, _Alloc, _KeyHash> _Hash;
+
+      public:
+        /** an index whose items are allocated from \b _arena (or from the static storage, if it's NULL) */
+        explicit _GraphVertexIndex (cgt::base::alloc::_Arena* const _arena = NULL) : _hash (_Alloc (_arena)) { }
+
+      public:
+        _TpIterator _find (const _TpVertex& _vertex, const _TpIterator& _itBegin, const _TpIterator& _itEnd)
+        {
+          _TpIterator* _ptr = _hash [_Key (&_vertex)];
+          return (_ptr ? *_ptr : _itEnd);
+        }
+
+        void _insert (const _TpIterator& _it) { _hash.insert (_Key (&(_it->vertex ().value ())), _it); }
+
+      public:
+        /** _its [i] receives the node of *(_values [i]), or _itEnd: expected time O(B) */
+        void _find_batch (const cgt::base::array<const _TpVertex*>& _values, cgt::base::array<_TpIterator>& _its, const _TpIterator& _itBegin, const _TpIterator& _itEnd)
+        {
+          _its.reserve (_values.size ());
+
+          for (size_t i = 0; i < _values.size (); i++)
+            _its.push_back (_find (*(_values [i]), _itBegin, _itEnd));
+        }
+
+        /** _first [i] receives the first position j of the batch such that *(_values [j]) == *(_values [i]) */
+        void _first_in_batch (const cgt::base::array<const _TpVertex*>& _values, cgt::base::array<size_t>& _first)
+        {
+          cgt::base::hash<_Key, size_t, cgt::base::alloc::_Allocator<cgt::base::_HashItem<cgt::base::pair<const _Key, size_t> > >, _KeyHash> _positions;
+
+          _first.reserve (_values.size ());
+
+          for (size_t i = 0; i < _values.size (); i++)
+          {
+            size_t* _ptr = _positions [_Key (_values [i])];
+
+            if (_ptr)
+              _first.push_back (*_ptr);
+            else
+            {
+              _positions.insert (_Key (_values [i]), i);
+              _first.push_back (i);
+            }
+          }
+        }
+
+      private:
+        _Hash _hash;
+    };
+
+
+  /*!
+   * \class _GraphVertexIndex
+   * \brief The default (no index): nodes are found by a linear search.
+   * \author Leandro Costa
+   * \date 2011
+   *
+   * Without a hasher there's no index, and _find iterates by the node's
+   * list, in time complexity \b O(V). Nothing is stored.
+   *
+   * Batches (graph::insert_vertices () and graph::insert_edges ()) are
+   * resolved by sorting, in time complexity <b>O((V + B) log V)</b>, so
+   * they need a <b>bool operator<(const _TpVertex&) const</b>.
+   */
+
+  template<typename _TpVertex, typename _TpIterator>
+    class _GraphVertexIndex<_TpVertex, _TpIterator, void>
+    {
+      private:
+        struct _NodeLess
+        {
+          const bool operator()(const _TpIterator& _it1, const _TpIterator& _it2) const { return (_it1->vertex ().value () < _it2->vertex ().value ()); }
+        };
+
+        struct _PositionLess
+        {
+          _PositionLess (const cgt::base::array<const _TpVertex*>& _v) : _values (_v) { }
+          const bool operator()(const size_t& _i, const size_t& _j) const { return (*(_values [_i]) < *(_values [_j])); }
+
+          const cgt::base::array<const _TpVertex*>& _values;
+        };
+
+      public:
+        explicit _GraphVertexIndex (cgt::base::alloc::_Arena* const _arena = NULL) { }
+
+      public:
+        _TpIterator _find (const _TpVertex& _vertex, const _TpIterator& _itBegin, const _TpIterator& _itEnd)
+        {
+          _TpIterator it = _itBegin;
+
+          while (it != _itEnd && it->vertex () != _vertex)
+            ++it;
+
+          return it;
+        }
+
+        void _insert (const _TpIterator& _it) { }
+
+      public:
+        void _find_batch (const cgt::base::array<const _TpVertex*>& _values, cgt::base::array<_TpIterator>& _its, const _TpIterator& _itBegin, const _TpIterator& _itEnd);
+        void _first_in_batch (const cgt::base::array<const _TpVertex*>& _values, cgt::base::array<size_t>& _first);
+    };
+
+  template<typename _TpVertex, typename _TpIterator>
+    void _GraphVertexIndex<_TpVertex, _TpIterator, void>::_find_batch (const cgt::base::array<const _TpVertex*>& _values, cgt::base::array<_TpIterator>& _its, const _TpIterator& _itBegin, const _TpIterator& _itEnd)
+    {
+      /*
+       * the nodes are sorted by vertex once, and each
+       * vertex of the batch is found by a binary search.
+       */
+
+      cgt::base::array<_TpIterator> _nodes;
+
+      for (_TpIterator it = _itBegin; it != _itEnd; ++it)
+        _nodes.push_back (it);
+
+      cgt::base::sort (_nodes, _NodeLess ());
+
+      _its.reserve (_values.size ());
+
+      for (size_t i = 0; i < _values.size (); i++)
+      {
+        const _TpVertex& _v = *(_values [i]);
+        size_t _lo = 0, _hi = _nodes.size ();
+
+        while (_lo < _hi)
+        {
+          size_t _mid = _lo + (_hi - _lo) / 2;
+
+          if (_nodes [_mid]->vertex ().value () < _v)
+            _lo = _mid + 1;
+          else
+            _hi = _mid;
+        }
+
+        if (_lo < _nodes.size () && ! (_v < _nodes [_lo]->vertex ().value ()))
+          _its.push_back (_nodes [_lo]);
+        else
+          _its.push_back (_itEnd);
+      }
+    }
+
+  template<typename _TpVertex, typename _TpIterator>
+    void _GraphVertexIndex<_TpVertex, _TpIterator, void>::_first_in_batch (const cgt::base::array<const _TpVertex*>& _values, cgt::base::array<size_t>& _first)
+    {
+      /*
+       * a stable sort of the positions puts equal vertices together,
+       * the first of each group being the first in the batch.
+       */
+
+      size_t _n = _values.size ();
+      cgt::base::array<size_t> _order;
+      _order.reserve (_n);
+
+      for (size_t i = 0; i < _n; i++)
+        _order.push_back (i);
+
+      cgt::base::sort (_order, _PositionLess (_values));
+
+      _first.resize (_n, 0);
+
+      for (size_t k = 0; k < _n; k++)
+      {
+        if (k > 0 && ! (*(_values [_order [k - 1]]) < *(_values [_order [k]])))
+          _first [_order [k]] = _first [_order [k - 1]];
+        else
+          _first [_order [k]] = _order [k];
+      }
+    }
+}
+
+#endif // __CGTL__CGT_GRAPH_VERTEX_INDEX_H_
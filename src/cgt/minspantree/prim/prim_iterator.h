@@ -35,7 +35,8 @@
 
 #include "cgt/minspantree/prim/prim_adjacency_heap.h"
 #include "cgt/base/iterator/iterator_ptr.h"
-#include "cgt/base/hash.h"
+#include "cgt/base/indexed_heap.h"
+#include "cgt/base/array.h"
 
 
 namespace cgt
@@ -78,6 +79,13 @@ namespace cgt
        *
        * The prim iterator returns edges in sequence according to the
        * Prim Algorithm.
+       *
+       * Each node not in the tree yet, but adjacent to it, is kept in a
+       * cgt::base::indexed_heap by the value of the lightest edge that
+       * links it to the tree, whose adjacency is kept in an array by node
+       * id: when a node joins the tree, the keys of its neighbours decrease
+       * in place, so the heap has at most one item per node, and the
+       * iterator runs in <b>O((V + E) log V)</b>.
        */
 
       template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
@@ -110,8 +118,7 @@ namespace cgt
             typedef cgt::base::iterator::_IteratorPtr<_Adjacency, _TpIterator>    _Base;
 
           private:
-            typedef cgt::base::heap<_Adjacency*, _PrimAdjacencyHeapInvariant>  _AdjacencyHeap;
-            typedef cgt::base::hash<_Vertex*, bool> _VertexHash;
+            typedef cgt::base::indexed_heap<_TpEdge>  _NodeHeap;
 
           private:
             using _Base::_ptr;
@@ -131,6 +138,9 @@ namespace cgt
             void _init (_Node& _n);
             void _incr ();
 
+            /** puts \b _n in the tree, and offers its adjacencies to the nodes out of it */
+            void _join (_Node& _n);
+
           public:
             _Edge& operator*() const { return _ptr->edge (); }
             _Edge* operator->() const { return &(_ptr->edge ()); }
@@ -138,30 +148,42 @@ namespace cgt
             const _Self operator++(int);
 
           private:
-            _AdjacencyHeap  _adjHeap;
-            _VertexHash     _vertexHash;
+            _NodeHeap                       _nodeHeap;
+            cgt::base::array<_Adjacency*>   _lightest;  /** < node id -> the lightest adjacency that links it to the tree */
+            cgt::base::array<char>          _inTree;    /** < node id -> 1 if the node is in the tree */
         };
 
 
       template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
         void _PrimIterator<_TpVertex, _TpEdge, _TpIterator>::_init (_Node& _n)
         {
+          _join (_n);
+          _incr ();
+        }
+
+      template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
+        void _PrimIterator<_TpVertex, _TpEdge, _TpIterator>::_join (_Node& _n)
+        {
+          if (_n.id () >= _inTree.size ())
+            _inTree.resize (_n.id () + 1, 0);
+
+          _inTree [_n.id ()] = 1;
+
           _AdjacencyIterator _itEnd = _n.adjlist ().end ();
           for (_AdjacencyIterator _it = _n.adjlist ().begin (); _it != _itEnd; ++_it)
-            _adjHeap.push (&(*_it));
+          {
+            size_t _id = _it->node ().id ();
 
-          _Adjacency** _p = _adjHeap.pop ();
-          _ptr = *_p;
-          delete _p;
+            if (_id >= _inTree.size ())
+              _inTree.resize (_id + 1, 0);
 
-          _vertexHash.insert (&(_ptr->edge ().v1 ()), true);
-          _vertexHash.insert (&(_ptr->edge ().v2 ()), true);
+            if (! _inTree [_id] && _nodeHeap.push_or_decrease (_id, _it->edge ().value ()))
+            {
+              if (_id >= _lightest.size ())
+                _lightest.resize (_id + 1, NULL);
 
-          _itEnd = _ptr->node ().adjlist ().end ();
-          for (_AdjacencyIterator _it = _ptr->node ().adjlist ().begin (); _it != _itEnd; ++_it)
-          {
-            if (! _vertexHash [&(_it->node ().vertex ())])
-              _adjHeap.push (&(*_it));
+              _lightest [_id] = &(*_it);
+            }
           }
         }
 
@@ -170,31 +192,10 @@ namespace cgt
         {
           _ptr = NULL;
 
-          while (! _adjHeap.empty ())
+          if (! _nodeHeap.empty ())
           {
-            _Adjacency** _p = _adjHeap.pop ();
-            _ptr = *_p;
-            delete _p;
-
-            if (! _vertexHash [&(_ptr->edge ().v1 ())] || ! _vertexHash [&(_ptr->edge ().v2 ())])
-              break;
-            else
-              _ptr = NULL;
-          }
-
-          if (_ptr)
-          {
-            _AdjacencyIterator _itEnd = _ptr->node ().adjlist ().end ();
-            for (_AdjacencyIterator _it = _ptr->node ().adjlist ().begin (); _it != _itEnd; ++_it)
-            {
-              if (! _vertexHash [&(_it->node ().vertex ())])
-                _adjHeap.push (&(*_it));
-            }
-
-            if (! _vertexHash [&(_ptr->edge ().v1 ())])
-              _vertexHash.insert (&(_ptr->edge ().v1 ()), true);
-            if (! _vertexHash [&(_ptr->edge ().v2 ())])
-              _vertexHash.insert (&(_ptr->edge ().v2 ()), true);
+            _ptr = _lightest [_nodeHeap.pop ()];
+            _join (_ptr->node ());
           }
         }
 
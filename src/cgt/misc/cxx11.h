@@ -0,0 +1,46 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/misc/cxx11.h
+ * \brief Detects the features of C++11 used by CGTL, when they're available.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * With a C++11 compiler, CGTL_HAS_RVALUE_REFERENCES is defined and
+ * lists and graphs have methods that take rvalues and build their items
+ * in place (emplace_back, emplace_vertex, emplace_edge). Define
+ * CGTL_DO_NOT_USE_CXX11 to keep the C++98 interface only.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_MISC_CXX11_H_
+#define __CGTL__CGT_MISC_CXX11_H_
+
+#if (__cplusplus >= 201103L) && ! defined (CGTL_DO_NOT_USE_CXX11)
+#  define CGTL_HAS_RVALUE_REFERENCES
+#  include <utility>
+#endif
+
+#endif // __CGTL__CGT_MISC_CXX11_H_
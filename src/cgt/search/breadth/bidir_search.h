@@ -0,0 +1,292 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/search/breadth/bidir_search.h
+ * \brief Contains the bidirectional breadth-first search for point-to-point hop distances.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SEARCH_BREADTH_BIDIR_SEARCH_H_
+#define __CGTL__CGT_SEARCH_BREADTH_BIDIR_SEARCH_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/graph_adjlist.h"
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace search
+  {
+    namespace breadth
+    {
+      /*!
+       * \class _BidirSearch
+       * \brief Finds the number of hops (and a path) from one node to another with two breadth-first searches that meet.
+       * \author Leandro Costa
+       * \date 2011
+       *
+       * One search grows from the source, over the adjacency lists, and the
+       * other from the target, over the inverted adjacency lists (the
+       * adjacency lists in undirected graphs). Each step expands a whole
+       * level of the side whose frontier is smaller, and the search stops
+       * at the end of the first level that reaches a node of the other
+       * side: the shortest path is the shortest one through the edges that
+       * met in that level. When the frontiers of both sides hold \b b^(d/2)
+       * nodes each, about \b 2 * b^(d/2) nodes are explored, instead of the
+       * \b b^d of a search from the source alone.
+       *
+       * The state of the nodes (side, distance and the next node towards
+       * their source or target) is kept in arrays by id, stamped with the
+       * \b epoch of the search that wrote them (as in _SearchWorkspace), so
+       * a search takes time proportional to the nodes it explores. Directed
+       * graphs without inverted lists (see _DirectedNoInverse) are searched
+       * from the source only.
+       */
+
+      template<typename _TpVertex, typename _TpEdge>
+        class _BidirSearch
+        {
+          private:
+            typedef _GraphNode<_TpVertex, _TpEdge>        _Node;
+            typedef _GraphAdjList<_TpVertex, _TpEdge>     _AdjList;
+            typedef typename _AdjList::const_iterator     _AdjCIterator;
+
+          private:
+            enum { _FORWARD = 1, _BACKWARD = 2 };
+
+          public:
+            /** the distance between nodes not connected */
+            static const size_t npos = static_cast<size_t>(-1);
+
+          public:
+            template<typename _TpNodeIterator>
+              _BidirSearch (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed, const bool& _inverse);
+
+          public:
+            /** the number of hops from \b _source to \b _target, or npos: the path is kept for path () */
+            size_t run (const _Node& _source, const _Node& _target);
+
+            size_t distance () const { return _distance; }
+
+            /** the nodes of a shortest path, from the source to the target (empty if there's none) */
+            const cgt::base::array<const _Node*>& path () const { return _path; }
+
+            /** the number of nodes explored by the last search, by both sides */
+            size_t explored () const { return _explored; }
+
+          private:
+            bool _is_seen (const size_t& _id) const { return (_stamp [_id] == _epoch); }
+            void _reach (const _Node& _node, const char& _s, const size_t& _d, const _Node* const _ptr_next);
+
+            /**
+             * expands a level of \b _side: returns the best meeting found (the
+             * node of this side and the node of the other side of its edge)
+             */
+            void _expand (const char& _s, cgt::base::array<const _Node*>& _frontier, const _Node*& _ptr_mine, const _Node*& _ptr_other);
+
+            void _make_path (const _Node* _ptr_forward, const _Node* _ptr_backward);
+
+          private:
+            bool    _directed;
+            bool    _bidirectional;
+
+            cgt::base::array<unsigned int>  _stamp;   /** < the epoch when the state of each node was written */
+            cgt::base::array<char>          _side;
+            cgt::base::array<size_t>        _dist;    /** < the distance from the source (or to the target) */
+            cgt::base::array<const _Node*>  _next;    /** < the next node towards the source (or the target) */
+            unsigned int                    _epoch;
+
+            cgt::base::array<const _Node*>  _forward;
+            cgt::base::array<const _Node*>  _backward;
+            cgt::base::array<const _Node*>  _level;
+            cgt::base::array<const _Node*>  _path;
+
+            size_t  _distance;
+            size_t  _explored;
+        };
+
+      template<typename _TpVertex, typename _TpEdge>
+        const size_t _BidirSearch<_TpVertex, _TpEdge>::npos;
+
+      template<typename _TpVertex, typename _TpEdge>
+        template<typename _TpNodeIterator>
+          _BidirSearch<_TpVertex, _TpEdge>::_BidirSearch (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed, const bool& _inverse)
+          : _directed (_directed), _bidirectional (_inverse || ! _directed), _epoch (0), _distance (npos), _explored (0)
+          {
+            size_t _n = 0;
+
+            for (_TpNodeIterator _it = _it_begin; _it != _it_end; ++_it)
+              if (_it->id () >= _n)
+                _n = _it->id () + 1;
+
+            _stamp.resize (_n, 0);
+            _side.resize (_n, 0);
+            _dist.resize (_n, 0);
+            _next.resize (_n, NULL);
+          }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _BidirSearch<_TpVertex, _TpEdge>::_reach (const _Node& _node, const char& _s, const size_t& _d, const _Node* const _ptr_next)
+        {
+          const size_t& _id = _node.id ();
+
+          _stamp [_id] = _epoch;
+          _side [_id] = _s;
+          _dist [_id] = _d;
+          _next [_id] = _ptr_next;
+          _level.push_back (&_node);
+          _explored++;
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        size_t _BidirSearch<_TpVertex, _TpEdge>::run (const _Node& _source, const _Node& _target)
+        {
+          if (++_epoch == 0)
+          {
+            for (size_t i = 0; i < _stamp.size (); i++)
+              _stamp [i] = 0;
+
+            _epoch = 1;
+          }
+
+          _forward.clear ();
+          _backward.clear ();
+          _path.clear ();
+          _distance = npos;
+          _explored = 0;
+
+          if (&_source == &_target)
+          {
+            _explored = 1;
+            _distance = 0;
+            _path.push_back (&_source);
+            return _distance;
+          }
+
+          _level.clear ();
+          _reach (_source, _FORWARD, 0, NULL);
+          _forward.swap (_level);
+
+          _level.clear ();
+          _reach (_target, _BACKWARD, 0, NULL);
+
+          if (_bidirectional)
+            _backward.swap (_level);
+
+          while (! _forward.empty () && (! _bidirectional || ! _backward.empty ()))
+          {
+            const _Node* _ptr_mine = NULL;
+            const _Node* _ptr_other = NULL;
+
+            if (! _bidirectional || _forward.size () <= _backward.size ())
+            {
+              _expand (_FORWARD, _forward, _ptr_mine, _ptr_other);
+
+              if (_ptr_mine)
+              {
+                _make_path (_ptr_mine, _ptr_other);
+                break;
+              }
+            }
+            else
+            {
+              _expand (_BACKWARD, _backward, _ptr_mine, _ptr_other);
+
+              if (_ptr_mine)
+              {
+                _make_path (_ptr_other, _ptr_mine);
+                break;
+              }
+            }
+          }
+
+          return _distance;
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _BidirSearch<_TpVertex, _TpEdge>::_expand (const char& _s, cgt::base::array<const _Node*>& _frontier, const _Node*& _ptr_mine, const _Node*& _ptr_other)
+        {
+          /*
+           * the whole level is expanded, and the meeting with the smallest
+           * distance to the other side is kept: nodes of the other side are
+           * at its last level or at the one before it
+           */
+
+          size_t _best = npos;
+
+          _level.clear ();
+
+          for (size_t i = 0; i < _frontier.size (); i++)
+          {
+            const _Node* _ptr = _frontier [i];
+            const _AdjList& _adj = (_s == _BACKWARD && _directed ? _ptr->iadjlist () : _ptr->adjlist ());
+            _AdjCIterator _itEnd = _adj.end ();
+
+            for (_AdjCIterator _it = _adj.begin (); _it != _itEnd; ++_it)
+            {
+              const size_t& _id = _it->node ().id ();
+
+              if (! _is_seen (_id))
+                _reach (_it->node (), _s, _dist [_ptr->id ()] + 1, _ptr);
+              else if (_side [_id] != _s && _dist [_id] < _best)
+              {
+                _best = _dist [_id];
+                _ptr_mine = _ptr;
+                _ptr_other = &(_it->node ());
+              }
+            }
+          }
+
+          _frontier.swap (_level);
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _BidirSearch<_TpVertex, _TpEdge>::_make_path (const _Node* _ptr_forward, const _Node* _ptr_backward)
+        {
+          /* from the source to _ptr_forward, reversed, then from _ptr_backward to the target */
+
+          for (const _Node* _ptr = _ptr_forward; _ptr; _ptr = _next [_ptr->id ()])
+            _path.push_back (_ptr);
+
+          for (size_t i = 0, j = _path.size () - 1; i < j; i++, j--)
+          {
+            const _Node* _tmp = _path [i];
+            _path [i] = _path [j];
+            _path [j] = _tmp;
+          }
+
+          for (const _Node* _ptr = _ptr_backward; _ptr; _ptr = _next [_ptr->id ()])
+            _path.push_back (_ptr);
+
+          _distance = _path.size () - 1;
+        }
+    }
+  }
+}
+
+#endif // __CGTL__CGT_SEARCH_BREADTH_BIDIR_SEARCH_H_
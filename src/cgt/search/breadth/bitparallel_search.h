@@ -0,0 +1,315 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/search/breadth/bitparallel_search.h
+ * \brief Contains the bit-parallel breadth-first search of many sources at once (MS-BFS).
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SEARCH_BREADTH_BITPARALLEL_SEARCH_H_
+#define __CGTL__CGT_SEARCH_BREADTH_BITPARALLEL_SEARCH_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/graph_adjlist.h"
+#include "cgt/base/array.h"
+#include "cgt/base/bitset.h"
+
+
+namespace cgt
+{
+  namespace search
+  {
+    namespace breadth
+    {
+      /*!
+       * \class _BitParallelSearch
+       * \brief Breadth-first searches of a batch of sources at once, one bit per source (MS-BFS).
+       * \author Leandro Costa
+       * \date 2011
+       *
+       * Each node keeps \b w words of bits (so a batch has up to
+       * <b>64 * w</b> sources, with 64-bit words): the sources that have
+       * reached it (\b seen), the ones that reached it in the last level
+       * (\b visit), and the ones that reach it in the next level (\b next).
+       * A level visits the adjacency list of each node whose \b visit isn't
+       * empty once, for all the sources in it, with an \b or of its words
+       * into the \b next of each neighbour; then the \b next of each
+       * neighbour, <b>and not</b> its \b seen, is what it's reached by. So
+       * the searches of a batch share each visit of an adjacency list,
+       * instead of repeating it, and the word operations are loops the
+       * compiler can vectorize (as in cgt::base::bitset).
+       *
+       * The levels are the ones of a _BreadthIterator from each source. For
+       * each source the search keeps the number of nodes reached, the sum of
+       * their distances and the last level (the eccentricity of the source),
+       * and, with keep_distances (), the distance from it to each node (that
+       * takes 4 bytes per source and node).
+       *
+       * Like the CSR snapshot (see graph::freeze), the search takes the
+       * nodes of the graph when it's built, and doesn't see nodes inserted
+       * later.
+       */
+
+      template<typename _TpVertex, typename _TpEdge>
+        class _BitParallelSearch
+        {
+          private:
+            typedef _GraphNode<_TpVertex, _TpEdge>        _Node;
+            typedef _GraphAdjList<_TpVertex, _TpEdge>     _AdjList;
+            typedef typename _AdjList::const_iterator     _AdjCIterator;
+            typedef cgt::base::_BitWord                   _Word;
+
+          public:
+            /** the distance to nodes not reached */
+            static const size_t npos = static_cast<size_t>(-1);
+
+          public:
+            template<typename _TpNodeIterator>
+              _BitParallelSearch (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const size_t& _words);
+
+          public:
+            /** the maximum number of sources of a batch */
+            size_t capacity () const { return _words * cgt::base::_BITS_PER_WORD; }
+
+            /** keeps the distance from each source to each node, for distance () */
+            void keep_distances (const bool& _k) { _keep = _k; }
+
+            /**
+             * Searches from the nodes of the graph iterators in [_first, _last), up to
+             * capacity () of them (the others are ignored): O(w * (V + E) * levels) word
+             * operations in the worst case, but only nodes reached in a level are visited.
+             */
+            template<typename _TpInputIterator>
+              void run (_TpInputIterator _first, const _TpInputIterator& _last);
+
+          public:
+            size_t num_sources () const { return _sources.size (); }
+            const _Node& source (const size_t& _i) const { return *(_sources [_i]); }
+
+            const size_t& reached (const size_t& _i) const { return _reached [_i]; }
+            const unsigned long& distance_sum (const size_t& _i) const { return _distanceSum [_i]; }
+            const size_t& eccentricity (const size_t& _i) const { return _eccentricity [_i]; }
+
+            /** whether the source \b _i reached \b _node */
+            bool is_reached (const size_t& _i, const _Node& _node) const
+            {
+              return (_seen [_node.id () * _words + _i / cgt::base::_BITS_PER_WORD] >> (_i % cgt::base::_BITS_PER_WORD)) & 1;
+            }
+
+            /** the distance from the source \b _i to \b _node, or npos (only with keep_distances ()) */
+            size_t distance (const size_t& _i, const _Node& _node) const
+            {
+              unsigned int _d = _distance [_i * _nodes.size () + _node.id ()];
+              return (_d == static_cast<unsigned int>(-1) ? npos : _d);
+            }
+
+          private:
+            /** the bits of the node \b _id in \b _bits */
+            _Word* _row (cgt::base::array<_Word>& _bits, const size_t& _id) { return &(_bits [_id * _words]); }
+
+            /** records the sources of the bits of \b _w (the word \b _k of a node) reaching the node \b _id at level \b _level */
+            void _record (_Word _w, const size_t& _k, const size_t& _id, const size_t& _level);
+
+          private:
+            cgt::base::array<const _Node*>  _nodes;     /** < the nodes, by id */
+            size_t                          _words;
+            bool                            _keep;
+
+            cgt::base::array<_Word>         _seen;
+            cgt::base::array<_Word>         _visit;
+            cgt::base::array<_Word>         _next;
+            cgt::base::array<size_t>        _active;    /** < the nodes whose visit isn't empty */
+            cgt::base::array<size_t>        _touched;   /** < the nodes whose next isn't empty */
+            cgt::base::array<char>          _marked;    /** < whether each node is in _touched */
+
+            cgt::base::array<const _Node*>  _sources;
+            cgt::base::array<size_t>        _reached;
+            cgt::base::array<unsigned long> _distanceSum;
+            cgt::base::array<size_t>        _eccentricity;
+            cgt::base::array<unsigned int>  _distance;  /** < by source, then by node */
+        };
+
+      template<typename _TpVertex, typename _TpEdge>
+        const size_t _BitParallelSearch<_TpVertex, _TpEdge>::npos;
+
+      template<typename _TpVertex, typename _TpEdge>
+        template<typename _TpNodeIterator>
+          _BitParallelSearch<_TpVertex, _TpEdge>::_BitParallelSearch (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const size_t& _words)
+          : _words (_words ? _words : 1), _keep (false)
+          {
+            for (_TpNodeIterator _it = _it_begin; _it != _it_end; ++_it)
+            {
+              if (_it->id () >= _nodes.size ())
+                _nodes.resize (_it->id () + 1, NULL);
+
+              _nodes [_it->id ()] = &(*_it);
+            }
+
+            _seen.resize (_nodes.size () * this->_words, 0);
+            _visit.resize (_nodes.size () * this->_words, 0);
+            _next.resize (_nodes.size () * this->_words, 0);
+            _marked.resize (_nodes.size (), 0);
+          }
+
+      template<typename _TpVertex, typename _TpEdge>
+        template<typename _TpInputIterator>
+          void _BitParallelSearch<_TpVertex, _TpEdge>::run (_TpInputIterator _first, const _TpInputIterator& _last)
+          {
+            size_t _n = _nodes.size ();
+
+            _sources.clear ();
+
+            for (; _first != _last && _sources.size () < capacity (); ++_first)
+              _sources.push_back (&(**_first));
+
+            size_t _s = _sources.size ();
+
+            for (size_t i = 0; i < _seen.size (); i++)
+            {
+              _seen [i] = 0;
+              _visit [i] = 0;
+            }
+
+            _reached.clear ();
+            _reached.resize (_s, 0);
+            _distanceSum.clear ();
+            _distanceSum.resize (_s, 0);
+            _eccentricity.clear ();
+            _eccentricity.resize (_s, 0);
+            _distance.clear ();
+
+            if (_keep)
+              _distance.resize (_s * _n, static_cast<unsigned int>(-1));
+
+            /* level 0: each source reaches itself */
+
+            _active.clear ();
+
+            for (size_t i = 0; i < _s; i++)
+            {
+              size_t _id = _sources [i]->id ();
+              size_t _k = i / cgt::base::_BITS_PER_WORD;
+              _Word _bit = static_cast<_Word>(1) << (i % cgt::base::_BITS_PER_WORD);
+
+              if (! _marked [_id])
+              {
+                _marked [_id] = 1;
+                _active.push_back (_id);
+              }
+
+              _row (_seen, _id) [_k] |= _bit;
+              _row (_visit, _id) [_k] |= _bit;
+              _record (_bit, _k, _id, 0);
+            }
+
+            for (size_t i = 0; i < _active.size (); i++)
+              _marked [_active [i]] = 0;
+
+            for (size_t _level = 1; ! _active.empty (); _level++)
+            {
+              /* the sources of each active node go to its neighbours */
+
+              _touched.clear ();
+
+              for (size_t i = 0; i < _active.size (); i++)
+              {
+                const _Node* _ptr = _nodes [_active [i]];
+                _Word* _v = _row (_visit, _active [i]);
+                _AdjCIterator _itEnd = _ptr->adjlist ().end ();
+
+                for (_AdjCIterator _it = _ptr->adjlist ().begin (); _it != _itEnd; ++_it)
+                {
+                  size_t _id = _it->node ().id ();
+                  _Word* _nx = _row (_next, _id);
+
+                  if (! _marked [_id])
+                  {
+                    _marked [_id] = 1;
+                    _touched.push_back (_id);
+                  }
+
+                  for (size_t k = 0; k < _words; k++)
+                    _nx [k] |= _v [k];
+                }
+
+                for (size_t k = 0; k < _words; k++)
+                  _v [k] = 0;
+              }
+
+              /* each neighbour is reached by the sources that hadn't reached it yet */
+
+              _active.clear ();
+
+              for (size_t i = 0; i < _touched.size (); i++)
+              {
+                size_t _id = _touched [i];
+                _Word* _nx = _row (_next, _id);
+                _Word* _sn = _row (_seen, _id);
+                _Word* _v = _row (_visit, _id);
+                _Word _any = 0;
+
+                _marked [_id] = 0;
+
+                for (size_t k = 0; k < _words; k++)
+                {
+                  _Word _w = _nx [k] & ~_sn [k];
+                  _nx [k] = 0;
+                  _sn [k] |= _w;
+                  _v [k] = _w;
+                  _any |= _w;
+
+                  if (_w)
+                    _record (_w, k, _id, _level);
+                }
+
+                if (_any)
+                  _active.push_back (_id);
+              }
+            }
+          }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _BitParallelSearch<_TpVertex, _TpEdge>::_record (_Word _w, const size_t& _k, const size_t& _id, const size_t& _level)
+        {
+          while (_w)
+          {
+            size_t _i = _k * cgt::base::_BITS_PER_WORD + cgt::base::_lowest_bit (_w);
+            _w &= _w - 1;
+
+            _reached [_i]++;
+            _distanceSum [_i] += _level;
+            _eccentricity [_i] = _level;
+
+            if (_keep)
+              _distance [_i * _nodes.size () + _id] = static_cast<unsigned int>(_level);
+          }
+        }
+    }
+  }
+}
+
+#endif // __CGTL__CGT_SEARCH_BREADTH_BITPARALLEL_SEARCH_H_
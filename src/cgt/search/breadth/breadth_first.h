@@ -0,0 +1,114 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/search/breadth/breadth_first.h
+ * \brief Contains the breadth-first search that calls a visitor.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SEARCH_BREADTH_BREADTH_FIRST_H_
+#define __CGTL__CGT_SEARCH_BREADTH_BREADTH_FIRST_H_
+
+#include "cgt/search/search_visitor.h"
+
+
+namespace cgt
+{
+  namespace search
+  {
+    /*!
+     * Searches the nodes reachable from \b _source in breadth-first order,
+     * calling the hooks of \b _vis (see _SearchVisitor), and returns the
+     * number of nodes discovered. It's the loop of the biterator without
+     * the iterator: no info list, no copies, no virtual calls, so a visitor
+     * that only counts or filters nodes runs as fast as a hand-written loop.
+     */
+
+    template<typename _TpVertex, typename _TpEdge, typename _TpVisitor>
+      size_t breadth_first (const _GraphNode<_TpVertex, _TpEdge>& _source, const size_t& _num_nodes, _TpVisitor& _vis, _VisitWorkspace<_TpVertex, _TpEdge>& _ws)
+      {
+        typedef _GraphNode<_TpVertex, _TpEdge>                              _Node;
+        typedef typename _GraphAdjList<_TpVertex, _TpEdge>::const_iterator  _AdjCIterator;
+
+        size_t _count = 1;
+
+        _ws._begin (_num_nodes);
+        _ws._visit (_source.id ());
+        _vis.discover (_source, NULL);
+
+        if (_vis.done ())
+          return _count;
+
+        _ws._queue.enqueue (&_source);
+
+        while (! _ws._queue.empty ())
+        {
+          const _Node* _ptr = _ws._queue.dequeue ();
+          _AdjCIterator _itEnd = _ptr->adjlist ().end ();
+
+          for (_AdjCIterator _it = _ptr->adjlist ().begin (); _it != _itEnd; ++_it)
+          {
+            _vis.examine_edge (*_ptr, *_it);
+
+            const _Node& _node = _it->node ();
+
+            if (_ws._visit (_node.id ()))
+            {
+              _count++;
+              _vis.discover (_node, _ptr);
+
+              if (_vis.done ())
+                return _count;
+
+              _ws._queue.enqueue (&_node);
+            }
+          }
+
+          _vis.finish (*_ptr);
+        }
+
+        return _count;
+      }
+
+    /** breadth_first from a node of \b _g, with the state kept in \b _ws */
+    template<typename _TpGraph, typename _TpVisitor>
+      size_t breadth_first (const _TpGraph& _g, const typename _TpGraph::node& _source, _TpVisitor& _vis, typename _TpGraph::visit_workspace& _ws)
+      {
+        return breadth_first (_source, _g.num_vertices (), _vis, _ws);
+      }
+
+    /** breadth_first from a node of \b _g */
+    template<typename _TpGraph, typename _TpVisitor>
+      size_t breadth_first (const _TpGraph& _g, const typename _TpGraph::node& _source, _TpVisitor& _vis)
+      {
+        typename _TpGraph::visit_workspace _ws;
+        return breadth_first (_source, _g.num_vertices (), _vis, _ws);
+      }
+  }
+}
+
+#endif // __CGTL__CGT_SEARCH_BREADTH_BREADTH_FIRST_H_
@@ -34,7 +34,7 @@
 #define __CGTL__CGT_SEARCH_BREADTH_BREADTH_ITERATOR_H_
 
 #include "cgt/search/search_iterator.h"
-#include "cgt/base/queue.h"
+#include "cgt/base/ring_queue.h"
 
 
 namespace cgt
@@ -79,16 +79,23 @@ namespace cgt
        *      - paint it with GRAY, put it on the queue and turn it the current node.
        *    - if no more WHITE nodes are found:
        *      - point the current node to NULL.
+      *
+       * started with a _SearchWorkspace (a local search), the nodes are
+       * not painted at the beginning (nodes without info are WHITE), and
+       * the search ends when the queue is empty. A local search may start
+       * from many nodes at once (see graph::bbegin (first, last, workspace)):
+       * all of them are put on the queue at the beginning, and are the
+       * first current nodes, so each node is reached from the nearest one.
        */
 
       template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
-        class _BreadthIterator : public _SearchIterator<_TpVertex, _TpEdge, cgt::base::queue, _TpIterator>
+        class _BreadthIterator : public _SearchIterator<_TpVertex, _TpEdge, cgt::base::ring_queue, _TpIterator>
       {
         public:
           typedef _SearchInfo<_TpVertex, _TpEdge> _BreadthInfo;
 
         private:
-          typedef _SearchIterator<_TpVertex, _TpEdge, cgt::base::queue, _TpIterator>    _Base;
+          typedef _SearchIterator<_TpVertex, _TpEdge, cgt::base::ring_queue, _TpIterator>    _Base;
           typedef _BreadthIterator<_TpVertex, _TpEdge, _TpIterator>                     _Self;
           typedef _BreadthIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpCommon>  _SelfCommon;
           typedef _GraphNode<_TpVertex, _TpEdge>                                        _Node;
@@ -98,35 +105,35 @@ namespace cgt
           typedef typename std::list<_Node>::iterator                             _NodeIterator;
 #endif
           typedef _SearchState<_TpVertex, _TpEdge>                                      _BreadthState;
+          typedef _SearchWorkspace<_TpVertex, _TpEdge>                                  _Workspace;
+          typedef typename _Base::_Engine                                               _Engine;
 
         private:
           using _Base::_ptr_node;
-          using _Base::_it_node;
-          using _Base::_it_node_end;
-          using _Base::_infoList;
-          using _Base::_stContainer;
-          using _Base::_global_time;
 
         public:
           _BreadthIterator () { }
           _BreadthIterator (_Node* const _ptr_n) : _Base (_ptr_n) { }
           _BreadthIterator (_Node* const _ptr_n, const _NodeIterator& _it_begin, const _NodeIterator& _it_end) : _Base (_ptr_n, _it_begin, _it_end) { }
           _BreadthIterator (const _NodeIterator& _it, const _NodeIterator& _it_begin, const _NodeIterator& _it_end) : _Base (&(*_it), _it_begin, _it_end) { }
+          _BreadthIterator (const _NodeIterator& _it, const _NodeIterator& _it_end, _Workspace& _ws) : _Base (&(*_it), _it_end, _ws) { }
+          _BreadthIterator (const cgt::base::array<_Node*>& _r, const _NodeIterator& _it_end, _Workspace& _ws) : _Base (_r, _it_end, _ws) { }
           _BreadthIterator (const _SelfCommon& _it) : _Base (_it) { }
 
         public:
           _Self& operator++();
+          _Self operator++(int) { _Self _it = *this; operator++(); return _it; }
 
         public:
           const _BreadthInfo* const info (const _Node* const _ptr_node) { return _get_depth_info_by_node (*_ptr_node); }
           const _BreadthInfo* const info (const _Node& _node) { return _get_depth_info_by_node (_node); }
 
 #ifdef CGTL_DO_NOT_USE_STL
-          typename cgt::base::list<_BreadthInfo>::iterator info_begin () { return _infoList.begin (); }
-          typename cgt::base::list<_BreadthInfo>::iterator info_end () { return _infoList.end (); }
+          typename cgt::base::list<_BreadthInfo>::iterator info_begin () { return _Base::_info_list ().begin (); }
+          typename cgt::base::list<_BreadthInfo>::iterator info_end () { return _Base::_info_list ().end (); }
 #else
-          typename std::list<_BreadthInfo>::iterator info_begin () { return _infoList.begin (); }
-          typename std::list<_BreadthInfo>::iterator info_end () { return _infoList.end (); }
+          typename std::list<_BreadthInfo>::iterator info_begin () { return _Base::_info_list ().begin (); }
+          typename std::list<_BreadthInfo>::iterator info_end () { return _Base::_info_list ().end (); }
 #endif
       };
 
@@ -148,20 +155,32 @@ namespace cgt
            *    - point the current node to NULL.
            */
 
+          _Engine& _e = *(_Base::_engine);
+
+          if (_e._root < _e._roots.size ())
+          {
+            /* the first nodes of a search from many nodes are all at level 0 */
+
+            _ptr_node = _e._roots [_e._root++];
+            return *this;
+          }
+
           _ptr_node = NULL;
 
-          while (! _stContainer.empty ())
+          while (! _e._stContainer.empty ())
           {
-            _BreadthState& _state  = _stContainer.first ();
+            _BreadthState& _state  = _e._stContainer.first ();
 
             while (! _state.adj_finished ())
             {
               if (_has_color (_state._adj_node (), _BreadthInfo::WHITE))
               {
+                /* _state is in the queue, and may move when it grows: it's used before the node is enqueued */
+
                 _ptr_node = &(_state._adj_node ());
                 _state.adj_incr ();
-                _stContainer.enqueue (_BreadthState (*_ptr_node));
-                _discover_node (*_ptr_node, &(_state.node ()), ++_global_time);
+                _discover_node (*_ptr_node, &(_state.node ()), ++_e._global_time);
+                _e._stContainer.enqueue (_BreadthState (*_ptr_node));
                 break;
               }
               else
@@ -170,9 +189,7 @@ namespace cgt
 
             if (! _ptr_node)
             {
-              _BreadthState *_ptr = _stContainer.dequeue ();
-              _finish_node (_ptr->node (), ++_global_time);
-              delete _ptr;
+              _finish_node (_e._stContainer.dequeue ().node (), ++_e._global_time);
             }
             else
               break;
@@ -180,14 +197,14 @@ namespace cgt
 
           if (! _ptr_node)
           {
-            while (_it_node != _it_node_end && ! _has_color (*_it_node, _BreadthInfo::WHITE))
-              ++_it_node;
+            while (_e._it_node != _e._it_node_end && ! _has_color (*_e._it_node, _BreadthInfo::WHITE))
+              ++_e._it_node;
 
-            if (_it_node != _it_node_end)
+            if (_e._it_node != _e._it_node_end)
             {
-              _ptr_node = &(*_it_node);
-              _stContainer.enqueue (_BreadthState (*_it_node));
-              _discover_node (*_it_node, NULL, ++_global_time);
+              _ptr_node = &(*_e._it_node);
+              _e._stContainer.enqueue (_BreadthState (*_e._it_node));
+              _discover_node (*_e._it_node, NULL, ++_e._global_time);
             }
           }
 
@@ -0,0 +1,284 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/search/breadth/diropt_search.h
+ * \brief Contains the direction-optimizing breadth-first search.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SEARCH_BREADTH_DIROPT_SEARCH_H_
+#define __CGTL__CGT_SEARCH_BREADTH_DIROPT_SEARCH_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/graph_adjlist.h"
+#include "cgt/base/array.h"
+#include "cgt/base/bitset.h"
+
+
+namespace cgt
+{
+  namespace search
+  {
+    namespace breadth
+    {
+      /*!
+       * \class _DirOptSearch
+       * \brief A breadth-first search that expands each level top-down or bottom-up, whichever is cheaper.
+       * \author Leandro Costa
+       * \date 2011
+       *
+       * The search goes a level at a time. A top-down step visits the
+       * adjacency lists of the nodes of the frontier (the last level), as
+       * _BreadthIterator does. A bottom-up step visits the nodes not reached
+       * yet, and looks for a parent in the frontier among the nodes that
+       * point to each one (its inverted adjacency list, or its adjacency
+       * list in undirected graphs), stopping at the first one found. When
+       * the frontier is a large part of the graph, as in the middle levels
+       * of graphs with small diameter, most nodes find a parent after a few
+       * edges, and the bottom-up step examines far fewer edges.
+       *
+       * The direction follows Beamer's heuristic: a search switches to
+       * bottom-up when the edges of the frontier (\b m_f) are more than the
+       * edges of the nodes not reached (\b m_u) divided by \b alpha, and
+       * back to top-down when the frontier shrinks below <b>V / beta</b>
+       * nodes. Directed graphs without inverted lists (see
+       * _DirectedNoInverse) are always searched top-down.
+       *
+       * The levels are the same as _BreadthIterator's. The parents too, while
+       * the search is top-down; in a bottom-up step, the parent of a node
+       * is its first incoming neighbour in the frontier, so the tree may
+       * differ, but each parent is still a node of the previous level with
+       * an edge to its child.
+       *
+       * Like the CSR snapshot (see graph::freeze), the search takes the
+       * nodes of the graph when it's built, and doesn't see nodes inserted
+       * later.
+       */
+
+      template<typename _TpVertex, typename _TpEdge>
+        class _DirOptSearch
+        {
+          private:
+            typedef _GraphNode<_TpVertex, _TpEdge>        _Node;
+            typedef _GraphAdjList<_TpVertex, _TpEdge>     _AdjList;
+            typedef typename _AdjList::const_iterator     _AdjCIterator;
+
+          public:
+            /** the level of nodes not reached */
+            static const size_t npos = static_cast<size_t>(-1);
+
+          public:
+            template<typename _TpNodeIterator>
+              _DirOptSearch (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed, const bool& _inverse);
+
+          public:
+            /** the thresholds of the heuristic: Beamer's defaults are 14 and 24 (alpha 0 keeps the search top-down, beta 0 keeps it bottom-up once it switches) */
+            void set_alpha (const size_t& _a) { _alpha = _a; }
+            void set_beta (const size_t& _b) { _beta = _b; }
+
+            /** searches the nodes reachable from \b _source: O(V + E) */
+            void run (const _Node& _source);
+
+          public:
+            const size_t& level (const _Node& _node) const { return _level [_node.id ()]; }
+            /** the parent of \b _node in the search tree, or NULL if it's the source or wasn't reached */
+            const _Node* parent (const _Node& _node) const { return _parent [_node.id ()]; }
+
+            /** the number of nodes reached by the last search */
+            size_t size () const { return _reached; }
+
+            size_t top_down_steps () const { return _top_down; }
+            size_t bottom_up_steps () const { return _bottom_up; }
+
+          private:
+            void _step_top_down (const size_t& _depth);
+            void _step_bottom_up (const size_t& _depth);
+            void _reach (const _Node& _node, const _Node* const _ptr_parent, const size_t& _depth);
+
+          private:
+            cgt::base::array<const _Node*>  _nodes;     /** < the nodes, by id */
+            cgt::base::array<size_t>        _level;
+            cgt::base::array<const _Node*>  _parent;
+            cgt::base::array<const _Node*>  _frontier;
+            cgt::base::array<const _Node*>  _next;
+            cgt::base::bitset               _inFrontier;
+
+            bool    _directed;
+            bool    _bottomUpAllowed;
+            size_t  _edges;     /** < the sum of the sizes of the adjacency lists */
+            size_t  _alpha;
+            size_t  _beta;
+
+            size_t  _reached;
+            size_t  _nextEdges; /** < the edges of the nodes reached in the last step */
+            size_t  _top_down;
+            size_t  _bottom_up;
+        };
+
+      template<typename _TpVertex, typename _TpEdge>
+        const size_t _DirOptSearch<_TpVertex, _TpEdge>::npos;
+
+      template<typename _TpVertex, typename _TpEdge>
+        template<typename _TpNodeIterator>
+          _DirOptSearch<_TpVertex, _TpEdge>::_DirOptSearch (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed, const bool& _inverse)
+          : _directed (_directed), _bottomUpAllowed (_inverse || ! _directed), _edges (0), _alpha (14), _beta (24),
+            _reached (0), _nextEdges (0), _top_down (0), _bottom_up (0)
+          {
+            for (_TpNodeIterator _it = _it_begin; _it != _it_end; ++_it)
+            {
+              if (_it->id () >= _nodes.size ())
+                _nodes.resize (_it->id () + 1, NULL);
+
+              _nodes [_it->id ()] = &(*_it);
+              _edges += _it->adjlist ().size ();
+            }
+
+            _level.resize (_nodes.size (), npos);
+            _parent.resize (_nodes.size (), NULL);
+            _inFrontier.resize (_nodes.size ());
+          }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _DirOptSearch<_TpVertex, _TpEdge>::run (const _Node& _source)
+        {
+          size_t _n = _nodes.size ();
+
+          for (size_t i = 0; i < _n; i++)
+          {
+            _level [i] = npos;
+            _parent [i] = NULL;
+          }
+
+          _frontier.clear ();
+          _next.clear ();
+          _nextEdges = 0;
+          _reached = 0;
+          _top_down = 0;
+          _bottom_up = 0;
+
+          _reach (_source, NULL, 0);
+          _frontier.swap (_next);
+
+          size_t _unexplored = _edges - _nextEdges;
+          size_t _frontierEdges = _nextEdges;
+          bool _bottomUp = false;
+
+          for (size_t _depth = 1; ! _frontier.empty (); _depth++)
+          {
+            if (! _bottomUp)
+              _bottomUp = (_bottomUpAllowed && _alpha && _frontierEdges > _unexplored / _alpha);
+            else
+              _bottomUp = (! _beta || _frontier.size () >= _n / _beta);
+
+            if (_bottomUp)
+            {
+              _step_bottom_up (_depth);
+              _bottom_up++;
+            }
+            else
+            {
+              _step_top_down (_depth);
+              _top_down++;
+            }
+
+            _unexplored -= _nextEdges;
+            _frontierEdges = _nextEdges;
+            _frontier.swap (_next);
+          }
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _DirOptSearch<_TpVertex, _TpEdge>::_reach (const _Node& _node, const _Node* const _ptr_parent, const size_t& _depth)
+        {
+          _level [_node.id ()] = _depth;
+          _parent [_node.id ()] = _ptr_parent;
+          _next.push_back (&_node);
+          _nextEdges += _node.adjlist ().size ();
+          _reached++;
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _DirOptSearch<_TpVertex, _TpEdge>::_step_top_down (const size_t& _depth)
+        {
+          /*
+           * the adjacency lists of the frontier, in the order of the frontier,
+           * so the parents are the ones _BreadthIterator finds
+           */
+
+          _next.clear ();
+          _nextEdges = 0;
+
+          for (size_t i = 0; i < _frontier.size (); i++)
+          {
+            const _Node* _ptr = _frontier [i];
+            _AdjCIterator _itEnd = _ptr->adjlist ().end ();
+
+            for (_AdjCIterator _it = _ptr->adjlist ().begin (); _it != _itEnd; ++_it)
+              if (_level [_it->node ().id ()] == npos)
+                _reach (_it->node (), _ptr, _depth);
+          }
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _DirOptSearch<_TpVertex, _TpEdge>::_step_bottom_up (const size_t& _depth)
+        {
+          /*
+           * each node not reached yet looks for a parent in the frontier among
+           * the nodes that point to it, and stops at the first one found
+           */
+
+          _inFrontier.clear ();
+
+          for (size_t i = 0; i < _frontier.size (); i++)
+            _inFrontier.set (_frontier [i]->id ());
+
+          _next.clear ();
+          _nextEdges = 0;
+
+          for (size_t i = 0; i < _nodes.size (); i++)
+          {
+            if (_level [i] != npos || ! _nodes [i])
+              continue;
+
+            const _AdjList& _in = (_directed ? _nodes [i]->iadjlist () : _nodes [i]->adjlist ());
+            _AdjCIterator _itEnd = _in.end ();
+
+            for (_AdjCIterator _it = _in.begin (); _it != _itEnd; ++_it)
+            {
+              if (_inFrontier.test (_it->node ().id ()))
+              {
+                _reach (*(_nodes [i]), &(_it->node ()), _depth);
+                break;
+              }
+            }
+          }
+        }
+    }
+  }
+}
+
+#endif // __CGTL__CGT_SEARCH_BREADTH_DIROPT_SEARCH_H_
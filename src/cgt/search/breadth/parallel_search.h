@@ -0,0 +1,392 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/search/breadth/parallel_search.h
+ * \brief Contains the parallel level-synchronous breadth-first search.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SEARCH_BREADTH_PARALLEL_SEARCH_H_
+#define __CGTL__CGT_SEARCH_BREADTH_PARALLEL_SEARCH_H_
+
+#include <pthread.h>
+
+#include "cgt/graph_node.h"
+#include "cgt/graph_adjlist.h"
+#include "cgt/base/array.h"
+#include "cgt/base/bitset.h"
+
+
+namespace cgt
+{
+  namespace search
+  {
+    namespace breadth
+    {
+      /*!
+       * \class _ParallelSearch
+       * \brief A breadth-first search that expands each level with a group of threads.
+       * \author Leandro Costa
+       * \date 2011
+       *
+       * The search goes a level at a time, as _DirOptSearch does top-down.
+       * The threads take chunks of the frontier (the last level) from a
+       * shared cursor, and visit the adjacency lists of their nodes. A node
+       * is reached by the thread that sets its bit in the bitmap of visited
+       * nodes (an atomic \b or), and that thread writes its level and parent
+       * and keeps it in its own buffer. At the end of the level the buffers
+       * are copied, each to its place, into the next frontier. The threads
+       * meet at a barrier after each of these steps, so a search with \b t
+       * threads takes <b>O((V + E) / t)</b> time plus 3 barriers per level.
+       *
+       * There's no pool of threads: the threads are created by each run ()
+       * (the caller is one of them) and joined when the search ends, so the
+       * search can be copied between runs. They wait at a gate until all of
+       * them were created, and the barrier counts only those that started,
+       * so a thread that can't be created leaves its share to the others.
+       * The graph is only read, so it must not change during the search.
+       *
+       * The levels are the same as _BreadthIterator's. The parent of a node
+       * is a node of the previous level with an edge to it, the first one
+       * found by any thread, so the tree may change from one run to the next.
+       *
+       * Like the CSR snapshot (see graph::freeze), the search takes the
+       * nodes of the graph when it's built, and doesn't see nodes inserted
+       * later.
+       */
+
+      template<typename _TpVertex, typename _TpEdge>
+        class _ParallelSearch
+        {
+          private:
+            typedef _ParallelSearch<_TpVertex, _TpEdge>   _Self;
+            typedef _GraphNode<_TpVertex, _TpEdge>        _Node;
+            typedef _GraphAdjList<_TpVertex, _TpEdge>     _AdjList;
+            typedef typename _AdjList::const_iterator     _AdjCIterator;
+
+          private:
+            /** the number of nodes of the frontier a thread takes at a time */
+            static const size_t _CHUNK = 64;
+
+            struct _Task
+            {
+              _Self*  _search;
+              size_t  _index;
+            };
+
+          public:
+            /** the level of nodes not reached */
+            static const size_t npos = static_cast<size_t>(-1);
+
+          public:
+            template<typename _TpNodeIterator>
+              _ParallelSearch (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const size_t& _threads);
+
+          public:
+            /** searches the nodes reachable from \b _source */
+            void run (const _Node& _source);
+
+          public:
+            const size_t& level (const _Node& _node) const { return _level [_node.id ()]; }
+            /** the parent of \b _node in the search tree, or NULL if it's the source or wasn't reached */
+            const _Node* parent (const _Node& _node) const { return _parent [_node.id ()]; }
+
+            /** the levels and the parents of all nodes, by id */
+            const cgt::base::array<size_t>& levels () const { return _level; }
+            const cgt::base::array<const _Node*>& parents () const { return _parent; }
+
+            /** the number of nodes reached by the last search */
+            size_t size () const { return _reached; }
+            size_t num_threads () const { return _buffers.size (); }
+
+          private:
+            static void* _run_thread (void* _ptr);
+            void _work (const size_t& _index);
+
+            /** opens the gate to the threads created, once the barrier counts them */
+            void _open_gate ();
+            void _wait_gate ();
+
+            /** sets the bit of the node \b _id, and tells whether it was this call that set it */
+            bool _visit (const size_t& _id);
+
+            /** reads the bit of the node \b _id (a relaxed atomic load, where the compiler has one) */
+            bool _is_visited (const size_t& _id) const
+            {
+#ifdef __ATOMIC_RELAXED
+              return (__atomic_load_n (&(_visited [_id / cgt::base::_BITS_PER_WORD]), __ATOMIC_RELAXED) >> (_id % cgt::base::_BITS_PER_WORD)) & 1;
+#else
+              return (_visited [_id / cgt::base::_BITS_PER_WORD] >> (_id % cgt::base::_BITS_PER_WORD)) & 1;
+#endif
+            }
+
+          private:
+            cgt::base::array<const _Node*>                    _nodes;     /** < the nodes, by id */
+            cgt::base::array<size_t>                          _level;
+            cgt::base::array<const _Node*>                    _parent;
+            cgt::base::array<cgt::base::_BitWord>             _visited;
+            cgt::base::array<const _Node*>                    _frontier;
+            cgt::base::array<cgt::base::array<const _Node*> > _buffers;   /** < the nodes reached by each thread in the current level */
+            cgt::base::array<size_t>                          _offsets;   /** < where each buffer goes in the next frontier */
+
+            pthread_barrier_t _barrier;
+#ifndef __GNUC__
+            pthread_mutex_t   _mutex;
+#endif
+            pthread_mutex_t   _gate;
+            pthread_cond_t    _open;
+            bool              _opened;    /** < if the threads created can start */
+            size_t            _cursor;    /** < the next chunk of the frontier */
+            size_t            _depth;
+            size_t            _reached;
+        };
+
+      template<typename _TpVertex, typename _TpEdge>
+        const size_t _ParallelSearch<_TpVertex, _TpEdge>::npos;
+
+      template<typename _TpVertex, typename _TpEdge>
+        const size_t _ParallelSearch<_TpVertex, _TpEdge>::_CHUNK;
+
+      template<typename _TpVertex, typename _TpEdge>
+        template<typename _TpNodeIterator>
+          _ParallelSearch<_TpVertex, _TpEdge>::_ParallelSearch (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const size_t& _threads)
+          : _cursor (0), _depth (0), _reached (0)
+          {
+            for (_TpNodeIterator _it = _it_begin; _it != _it_end; ++_it)
+            {
+              if (_it->id () >= _nodes.size ())
+                _nodes.resize (_it->id () + 1, NULL);
+
+              _nodes [_it->id ()] = &(*_it);
+            }
+
+            _level.resize (_nodes.size (), npos);
+            _parent.resize (_nodes.size (), NULL);
+            _visited.resize (cgt::base::_num_words (_nodes.size ()), 0);
+            _buffers.resize (_threads ? _threads : 1);
+            _offsets.resize (_buffers.size (), 0);
+          }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _ParallelSearch<_TpVertex, _TpEdge>::run (const _Node& _source)
+        {
+          size_t _n = _nodes.size ();
+          size_t _t = _buffers.size ();
+
+          for (size_t i = 0; i < _n; i++)
+          {
+            _level [i] = npos;
+            _parent [i] = NULL;
+          }
+
+          for (size_t i = 0; i < _visited.size (); i++)
+            _visited [i] = 0;
+
+          _visit (_source.id ());
+          _level [_source.id ()] = 0;
+          _frontier.clear ();
+          _frontier.push_back (&_source);
+          _reached = 1;
+          _cursor = 0;
+          _depth = 1;
+
+#ifndef __GNUC__
+          pthread_mutex_init (&_mutex, NULL);
+#endif
+          pthread_mutex_init (&_gate, NULL);
+          pthread_cond_init (&_open, NULL);
+          _opened = false;
+
+          cgt::base::array<_Task> _tasks (_t);
+          cgt::base::array<pthread_t> _ids (_t);
+          size_t _started = 1;
+
+          for (; _started < _t; _started++)
+          {
+            _tasks [_started]._search = this;
+            _tasks [_started]._index = _started;
+
+            if (pthread_create (&(_ids [_started]), NULL, _run_thread, &(_tasks [_started])) != 0)
+              break;
+          }
+
+          /* the threads that couldn't be created have nothing in their buffers */
+
+          for (size_t i = _started; i < _t; i++)
+            _buffers [i].clear ();
+
+          pthread_barrier_init (&_barrier, NULL, _started);
+          _open_gate ();
+
+          _work (0);
+
+          for (size_t i = 1; i < _started; i++)
+            pthread_join (_ids [i], NULL);
+
+          pthread_cond_destroy (&_open);
+          pthread_mutex_destroy (&_gate);
+#ifndef __GNUC__
+          pthread_mutex_destroy (&_mutex);
+#endif
+          pthread_barrier_destroy (&_barrier);
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void* _ParallelSearch<_TpVertex, _TpEdge>::_run_thread (void* _ptr)
+        {
+          _Task* _task = static_cast<_Task*>(_ptr);
+          _task->_search->_wait_gate ();
+          _task->_search->_work (_task->_index);
+
+          return NULL;
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _ParallelSearch<_TpVertex, _TpEdge>::_open_gate ()
+        {
+          pthread_mutex_lock (&_gate);
+          _opened = true;
+          pthread_cond_broadcast (&_open);
+          pthread_mutex_unlock (&_gate);
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _ParallelSearch<_TpVertex, _TpEdge>::_wait_gate ()
+        {
+          pthread_mutex_lock (&_gate);
+
+          while (! _opened)
+            pthread_cond_wait (&_open, &_gate);
+
+          pthread_mutex_unlock (&_gate);
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        bool _ParallelSearch<_TpVertex, _TpEdge>::_visit (const size_t& _id)
+        {
+          cgt::base::_BitWord _bit = static_cast<cgt::base::_BitWord>(1) << (_id % cgt::base::_BITS_PER_WORD);
+          cgt::base::_BitWord& _word = _visited [_id / cgt::base::_BITS_PER_WORD];
+
+#ifdef __GNUC__
+          return ! (__sync_fetch_and_or (&_word, _bit) & _bit);
+#else
+          pthread_mutex_lock (&_mutex);
+          cgt::base::_BitWord _old = _word;
+          _word |= _bit;
+          pthread_mutex_unlock (&_mutex);
+
+          return ! (_old & _bit);
+#endif
+        }
+
+      template<typename _TpVertex, typename _TpEdge>
+        void _ParallelSearch<_TpVertex, _TpEdge>::_work (const size_t& _index)
+        {
+          cgt::base::array<const _Node*>& _buffer = _buffers [_index];
+
+          while (! _frontier.empty ())
+          {
+            /*
+             * expand the chunks of the frontier taken by this thread: the
+             * bitmap is read first, so only nodes that seem not visited
+             * pay for the atomic operation
+             */
+
+            _buffer.clear ();
+
+            size_t _begin;
+            size_t _size = _frontier.size ();
+
+#ifdef __GNUC__
+            while ((_begin = __sync_fetch_and_add (&_cursor, _CHUNK)) < _size)
+#else
+            for (;;)
+#endif
+            {
+#ifndef __GNUC__
+              pthread_mutex_lock (&_mutex);
+              _begin = _cursor;
+              _cursor += _CHUNK;
+              pthread_mutex_unlock (&_mutex);
+
+              if (_begin >= _size)
+                break;
+#endif
+              size_t _end = (_begin + _CHUNK < _size ? _begin + _CHUNK : _size);
+
+              for (size_t i = _begin; i < _end; i++)
+              {
+                const _Node* _ptr = _frontier [i];
+                _AdjCIterator _itEnd = _ptr->adjlist ().end ();
+
+                for (_AdjCIterator _it = _ptr->adjlist ().begin (); _it != _itEnd; ++_it)
+                {
+                  const size_t& _id = _it->node ().id ();
+
+                  if (! _is_visited (_id) && _visit (_id))
+                  {
+                    _level [_id] = _depth;
+                    _parent [_id] = _ptr;
+                    _buffer.push_back (&(_it->node ()));
+                  }
+                }
+              }
+            }
+
+            pthread_barrier_wait (&_barrier);
+
+            /* the first thread finds the place of each buffer in the next frontier */
+
+            if (_index == 0)
+            {
+              size_t _total = 0;
+
+              for (size_t t = 0; t < _buffers.size (); t++)
+              {
+                _offsets [t] = _total;
+                _total += _buffers [t].size ();
+              }
+
+              _frontier.resize (_total, NULL);
+              _reached += _total;
+              _cursor = 0;
+              _depth++;
+            }
+
+            pthread_barrier_wait (&_barrier);
+
+            for (size_t i = 0; i < _buffer.size (); i++)
+              _frontier [_offsets [_index] + i] = _buffer [i];
+
+            pthread_barrier_wait (&_barrier);
+          }
+        }
+    }
+  }
+}
+
+#endif // __CGTL__CGT_SEARCH_BREADTH_PARALLEL_SEARCH_H_
@@ -0,0 +1,271 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/search/depth/depth_first.h
+ * \brief Contains the depth-first search that calls a visitor.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SEARCH_DEPTH_DEPTH_FIRST_H_
+#define __CGTL__CGT_SEARCH_DEPTH_DEPTH_FIRST_H_
+
+#include "cgt/search/search_visitor.h"
+
+
+namespace cgt
+{
+  namespace search
+  {
+    /*!
+     * The search of depth_first from \b _source, already marked in \b _ws
+     * as the \b _count th node discovered: \b _count is incremented for
+     * each node discovered. It returns false if the visitor stopped it.
+     */
+
+    template<typename _TpVertex, typename _TpEdge, typename _TpVisitor>
+      bool _depth_first_tree (const _GraphNode<_TpVertex, _TpEdge>& _source, _TpVisitor& _vis, _VisitWorkspace<_TpVertex, _TpEdge>& _ws, size_t& _count)
+      {
+        typedef _GraphNode<_TpVertex, _TpEdge>                    _Node;
+        typedef _GraphAdjacency<_TpVertex, _TpEdge>               _Adjacency;
+        typedef typename _VisitWorkspace<_TpVertex, _TpEdge>::_Frame _Frame;
+
+        _count++;
+        _vis.discover (_source, NULL);
+
+        if (_vis.done ())
+          return false;
+
+        _ws._stack.push (_Frame (_source));
+
+        while (! _ws._stack.empty ())
+        {
+          _Frame& _top = _ws._stack.top ();
+
+          if (_top._it != _top._it_end)
+          {
+            /* _top may move when the stack grows: its node is kept before the push */
+
+            const _Node* _ptr = _top._ptr_node;
+            const _Adjacency& _adj = *_top._it;
+            const _Node& _node = _adj.node ();
+
+            _vis.examine_edge (*_ptr, _adj);
+            ++_top._it;
+
+            if (_ws._visit (_node.id (), _count))
+            {
+              _count++;
+              _vis.tree_edge (*_ptr, _adj);
+              _vis.discover (_node, _ptr);
+
+              if (_vis.done ())
+                return false;
+
+              _ws._stack.push (_Frame (_node));
+            }
+            else if (! _ws._is_finished (_node.id ()))
+            {
+              _vis.back_edge (*_ptr, _adj);
+
+              if (_vis.done ())
+                return false;
+            }
+            else if (_ws._order_of (_node.id ()) > _ws._order_of (_ptr->id ()))
+              _vis.forward_edge (*_ptr, _adj);
+            else
+              _vis.cross_edge (*_ptr, _adj);
+          }
+          else
+          {
+            const _Node* _ptr = _ws._stack.pop ()._ptr_node;
+
+            _ws._finish (_ptr->id ());
+            _vis.finish (*_ptr);
+          }
+        }
+
+        return true;
+      }
+
+    /*!
+     * Searches the nodes reachable from \b _source in depth-first order,
+     * calling the hooks of \b _vis (see _SearchVisitor), and returns the
+     * number of nodes discovered. Nodes are discovered and finished in the
+     * order of the diterator; the path from the source is kept in the stack
+     * of the workspace, with the next adjacency of each node, so there's no
+     * recursion, whatever the depth of the graph. Each adjacency examined
+     * is also classified (tree, back, forward or cross edge) in \b O(1).
+     */
+
+    template<typename _TpVertex, typename _TpEdge, typename _TpVisitor>
+      size_t depth_first (const _GraphNode<_TpVertex, _TpEdge>& _source, const size_t& _num_nodes, _TpVisitor& _vis, _VisitWorkspace<_TpVertex, _TpEdge>& _ws)
+      {
+        size_t _count = 0;
+
+        _ws._begin (_num_nodes, true);
+        _ws._visit (_source.id (), _count);
+        _depth_first_tree (_source, _vis, _ws, _count);
+
+        return _count;
+      }
+
+    /** depth_first from a node of \b _g, with the state kept in \b _ws */
+    template<typename _TpGraph, typename _TpVisitor>
+      size_t depth_first (const _TpGraph& _g, const typename _TpGraph::node& _source, _TpVisitor& _vis, typename _TpGraph::visit_workspace& _ws)
+      {
+        return depth_first (_source, _g.num_vertices (), _vis, _ws);
+      }
+
+    /** depth_first from a node of \b _g */
+    template<typename _TpGraph, typename _TpVisitor>
+      size_t depth_first (const _TpGraph& _g, const typename _TpGraph::node& _source, _TpVisitor& _vis)
+      {
+        typename _TpGraph::visit_workspace _ws;
+        return depth_first (_source, _g.num_vertices (), _vis, _ws);
+      }
+
+    /*!
+     * depth_first from each node of \b _g not reached yet, in the order of
+     * the graph's iterator (each one is discovered with a NULL parent), so
+     * all nodes are discovered and all edges classified: \b O(V + E).
+     * Edges to the nodes of earlier trees are cross edges.
+     */
+
+    template<typename _TpGraph, typename _TpVisitor>
+      size_t depth_first_forest (const _TpGraph& _g, _TpVisitor& _vis, typename _TpGraph::visit_workspace& _ws)
+      {
+        size_t _count = 0;
+
+        _ws._begin (_g.num_vertices (), true);
+
+        for (typename _TpGraph::const_iterator it = _g.begin (); it != _g.end (); ++it)
+          if (_ws._visit (it->id (), _count) && ! _depth_first_tree (*it, _vis, _ws, _count))
+            break;
+
+        return _count;
+      }
+
+    template<typename _TpGraph, typename _TpVisitor>
+      size_t depth_first_forest (const _TpGraph& _g, _TpVisitor& _vis)
+      {
+        typename _TpGraph::visit_workspace _ws;
+        return depth_first_forest (_g, _vis, _ws);
+      }
+
+
+    /*!
+     * \class _CycleFinder
+     * \brief A visitor that stops depth_first at the first back edge.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * In an undirected graph, the first adjacency from a node back to its
+     * parent is the tree edge seen from the other side, so it's skipped
+     * (another one, from a parallel edge, still closes a cycle). For that
+     * it keeps the parent of each node discovered, by id.
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _CycleFinder : public _SearchVisitor<_TpVertex, _TpEdge>
+      {
+        private:
+          typedef _GraphNode<_TpVertex, _TpEdge>      _Node;
+          typedef _GraphAdjacency<_TpVertex, _TpEdge> _Adjacency;
+
+        public:
+          _CycleFinder (const bool& _undirected = false) : _undirected (_undirected), _ptr_from (NULL), _ptr_adj (NULL) { }
+
+        public:
+          void discover (const _Node& _node, const _Node* _ptr_parent);
+          void back_edge (const _Node& _node, const _Adjacency& _adj);
+          const bool done () const { return (_ptr_adj != NULL); }
+
+        public:
+          /** the node where the back edge starts (NULL if there's none) */
+          const _Node* from () const { return _ptr_from; }
+
+          /** the back edge found: its node is the first of the cycle (NULL if there's none) */
+          const _Adjacency* adjacency () const { return _ptr_adj; }
+
+        private:
+          bool                            _undirected;
+          cgt::base::array<const _Node*>  _parent;  /** < node id -> its parent, while the edge back to it wasn't skipped (undirected graphs only) */
+          const _Node*                    _ptr_from;
+          const _Adjacency*               _ptr_adj;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CycleFinder<_TpVertex, _TpEdge>::discover (const _Node& _node, const _Node* _ptr_parent)
+      {
+        if (_undirected)
+        {
+          if (_node.id () >= _parent.size ())
+            _parent.resize (_node.id () + 1, NULL);
+
+          _parent [_node.id ()] = _ptr_parent;
+        }
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _CycleFinder<_TpVertex, _TpEdge>::back_edge (const _Node& _node, const _Adjacency& _adj)
+      {
+        if (_undirected && _parent [_node.id ()] == &(_adj.node ()))
+        {
+          _parent [_node.id ()] = NULL;
+          return;
+        }
+
+        _ptr_from = &_node;
+        _ptr_adj = &_adj;
+      }
+
+    /*!
+     * Tells whether \b _g has a cycle (a self-loop included): a depth-first
+     * search of all nodes that stops at the first back edge, \b O(V + E).
+     * In undirected graphs the edge from a node to its parent isn't a
+     * cycle, but two parallel edges between the same nodes are.
+     */
+
+    template<typename _TpGraph, typename _TpVertex, typename _TpEdge>
+      bool has_cycle (const _TpGraph& _g, _VisitWorkspace<_TpVertex, _TpEdge>& _ws)
+      {
+        _CycleFinder<_TpVertex, _TpEdge> _finder (_g.is_undirected ());
+        depth_first_forest (_g, _finder, _ws);
+
+        return _finder.done ();
+      }
+
+    template<typename _TpGraph>
+      bool has_cycle (const _TpGraph& _g)
+      {
+        typename _TpGraph::visit_workspace _ws;
+        return has_cycle (_g, _ws);
+      }
+  }
+}
+
+#endif // __CGTL__CGT_SEARCH_DEPTH_DEPTH_FIRST_H_
@@ -34,7 +34,7 @@
 #define __CGTL__CGT_SEARCH_DEPTH_DEPTH_ITERATOR_H_
 
 #include "cgt/search/search_iterator.h"
-#include "cgt/base/stack.h"
+#include "cgt/base/array_stack.h"
 
 
 namespace cgt
@@ -79,55 +79,58 @@ namespace cgt
        *      - paint it with GRAY, put it on the stack and turn it the current node.
        *    - if no more WHITE nodes are found:
        *      - point the current node to NULL.
+      *
+       * started with a _SearchWorkspace (a local search), the nodes are
+       * not painted at the beginning (nodes without info are WHITE), and
+       * the search ends when the stack is empty.
        */
 
       template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
-        class _DepthIterator : public _SearchIterator<_TpVertex, _TpEdge, cgt::base::stack, _TpIterator>
+        class _DepthIterator : public _SearchIterator<_TpVertex, _TpEdge, cgt::base::array_stack, _TpIterator>
       {
         public:
           typedef _SearchInfo<_TpVertex, _TpEdge>   _DepthInfo;
           typedef _SearchState<_TpVertex, _TpEdge>  _DepthState; // need to be public because it's used by scc_iterator
 
         private:
-          typedef _SearchIterator<_TpVertex, _TpEdge, cgt::base::stack, _TpIterator>  _Base;
+          typedef _SearchIterator<_TpVertex, _TpEdge, cgt::base::array_stack, _TpIterator>  _Base;
           typedef _DepthIterator<_TpVertex, _TpEdge, _TpIterator>                     _Self;
           typedef _DepthIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpCommon>  _SelfCommon;
           typedef _GraphNode<_TpVertex, _TpEdge>                                      _Node;
-
+          typedef _SearchWorkspace<_TpVertex, _TpEdge>                                _Workspace;
 #ifdef CGTL_DO_NOT_USE_STL
           typedef typename cgt::base::list<_Node>::iterator                           _NodeIterator;
 #else
           typedef typename std::list<_Node>::iterator                           _NodeIterator;
 #endif
 
+          typedef typename _Base::_Engine                                               _Engine;
+
         private:
           using _Base::_ptr_node;
-          using _Base::_it_node;
-          using _Base::_it_node_end;
-          using _Base::_infoList;
-          using _Base::_stContainer;
-          using _Base::_global_time;
 
         public:
           _DepthIterator () { }
           _DepthIterator (_Node* const _ptr_n) : _Base (_ptr_n) { }
           _DepthIterator (_Node* const _ptr_n, const _NodeIterator& _it_begin, const _NodeIterator& _it_end) : _Base (_ptr_n, _it_begin, _it_end) { }
           _DepthIterator (const _NodeIterator& _it, const _NodeIterator& _it_begin, const _NodeIterator& _it_end) : _Base (&(*_it), _it_begin, _it_end) { }
+          _DepthIterator (const _NodeIterator& _it, const _NodeIterator& _it_end, _Workspace& _ws) : _Base (&(*_it), _it_end, _ws) { }
           _DepthIterator (const _SelfCommon& _it) : _Base (_it) { }
 
         public:
           _Self& operator++();
+          _Self operator++(int) { _Self _it = *this; operator++(); return _it; }
 
         public:
-          const _DepthInfo* const info (const _Node* const _ptr_node) { return _get_depth_info_by_node (_ptr_node); }
+          const _DepthInfo* const info (const _Node* const _ptr_node) { return _get_depth_info_by_node (*_ptr_node); }
           const _DepthInfo* const info (const _Node& _node) { return _get_depth_info_by_node (_node); }
 
 #ifdef CGTL_DO_NOT_USE_STL
-          typename cgt::base::list<_DepthInfo>::iterator info_begin () { return _infoList.begin (); }
-          typename cgt::base::list<_DepthInfo>::iterator info_end () { return _infoList.end (); }
+          typename cgt::base::list<_DepthInfo>::iterator info_begin () { return _Base::_info_list ().begin (); }
+          typename cgt::base::list<_DepthInfo>::iterator info_end () { return _Base::_info_list ().end (); }
 #else
-          typename std::list<_DepthInfo>::iterator info_begin () { return _infoList.begin (); }
-          typename std::list<_DepthInfo>::iterator info_end () { return _infoList.end (); }
+          typename std::list<_DepthInfo>::iterator info_begin () { return _Base::_info_list ().begin (); }
+          typename std::list<_DepthInfo>::iterator info_end () { return _Base::_info_list ().end (); }
 #endif
       };
 
@@ -149,20 +152,24 @@ namespace cgt
            *    - point the current node to NULL.
            */
 
+          _Engine& _e = *(_Base::_engine);
+
           _ptr_node = NULL;
 
-          while (! _stContainer.empty ())
+          while (! _e._stContainer.empty ())
           {
-            _DepthState& _state  = _stContainer.top ();
+            _DepthState& _state  = _e._stContainer.top ();
 
             while (! _state.adj_finished ())
             {
               if (_has_color (_state._adj_node (), _DepthInfo::WHITE))
               {
+                /* _state is in the stack, and may move when it grows: it's used before the node is pushed */
+
                 _ptr_node = &(_state._adj_node ());
                 _state.adj_incr ();
-                _stContainer.push (_DepthState (*_ptr_node));
-                _discover_node (*_ptr_node, &(_state.node ()), ++_global_time);
+                _discover_node (*_ptr_node, &(_state.node ()), ++_e._global_time);
+                _e._stContainer.push (_DepthState (*_ptr_node));
                 break;
               }
               else
@@ -171,9 +178,7 @@ namespace cgt
 
             if (! _ptr_node)
             {
-              _DepthState *_ptr = _stContainer.pop ();
-              _finish_node (_ptr->node (), ++_global_time);
-              delete _ptr;
+              _finish_node (_e._stContainer.pop ().node (), ++_e._global_time);
             }
             else
               break;
@@ -181,14 +186,14 @@ namespace cgt
 
           if (! _ptr_node)
           {
-            while (_it_node != _it_node_end && ! _has_color (*_it_node, _DepthInfo::WHITE))
-              ++_it_node;
+            while (_e._it_node != _e._it_node_end && ! _has_color (*_e._it_node, _DepthInfo::WHITE))
+              ++_e._it_node;
 
-            if (_it_node != _it_node_end)
+            if (_e._it_node != _e._it_node_end)
             {
-              _ptr_node = &(*_it_node);
-              _stContainer.push (_DepthState (*_it_node));
-              _discover_node (*_it_node, NULL, ++_global_time);
+              _ptr_node = &(*_e._it_node);
+              _e._stContainer.push (_DepthState (*_e._it_node));
+              _discover_node (*_e._it_node, NULL, ++_e._global_time);
             }
           }
 
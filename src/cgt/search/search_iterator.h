@@ -36,6 +36,9 @@
 #include "cgt/graph_node.h"
 #include "cgt/search/search_state.h"
 #include "cgt/search/search_info.h"
+#include "cgt/search/search_workspace.h"
+#include "cgt/base/array.h"
+#include "cgt/base/shared.h"
 
 
 namespace cgt
@@ -49,6 +52,89 @@ namespace cgt
 
   namespace search
   {
+    /*!
+     * \class _SearchEngine
+     * \brief The state of a breadth-first or depth-first search, shared by the copies of its iterator.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * It keeps everything a search iterator needs to go on (the infos of
+     * the nodes, the queue or stack of states, the next root, etc.), so
+     * the iterator is just a pointer to its current node and a _Shared
+     * pointer to the engine: copying an iterator, or incrementing it with
+     * operator++(int), is \b O(1). Copies share the search (as copies of
+     * an input iterator): incrementing one of them moves the search on for
+     * all, and the others keep pointing to the node they were at.
+     */
+
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer>
+      class _SearchEngine
+      {
+        private:
+          typedef _SearchInfo<_TpVertex, _TpEdge>     _Info;
+#ifdef CGTL_DO_NOT_USE_STL
+          typedef cgt::base::list<_Info>              _InfoList;
+#else
+          typedef std::list<_Info>              _InfoList;
+#endif
+          typedef typename _InfoList::iterator        _InfoIterator;
+
+          typedef _GraphNode<_TpVertex, _TpEdge>      _Node;
+#ifdef CGTL_DO_NOT_USE_STL
+          typedef typename cgt::base::list<_Node>     _NodeList;
+#else
+          typedef typename std::list<_Node>     _NodeList;
+#endif
+          typedef typename _NodeList::iterator        _NodeIterator;
+
+          typedef _SearchState<_TpVertex, _TpEdge>    _State;
+          typedef _SearchWorkspace<_TpVertex, _TpEdge> _Workspace;
+
+        public:
+          _SearchEngine (const _NodeIterator& _it_begin, const _NodeIterator& _it_end, _Workspace* const _ptr_w)
+            : _it_node (_it_begin), _it_node_end (_it_end), _global_time (0), _root (0), _ptr_ws (_ptr_w) { }
+
+        private:
+          _SearchEngine (const _SearchEngine&);
+          _SearchEngine& operator=(const _SearchEngine&);
+
+        public:
+          /** paints \b _node (the first node) with GRAY and puts it (or all the roots) on the state container */
+          void _init (_Node& _node);
+
+          /** paints \b _node with GRAY and puts it on the state container, in a local search */
+          void _start (_Node& _node);
+
+          /** builds _infoTable and _colorTable from _infoList: O(V) */
+          void _index_infos ();
+
+          _Info* _get_depth_info_by_node (const _Node& _node);
+
+          /** the infos of the nodes: all of them, or the ones discovered by a local search */
+          _InfoList& _info_list () { return (_ptr_ws ? _ptr_ws->_infoList : _infoList); }
+
+          void _discover_node (const _Node& _node, const _Node* const _ptr_parent, const unsigned long& _d);
+          void _finish_node (const _Node& _node, const unsigned long& _f);
+          const bool _has_color (const _Node& _node, const typename _Info::_color_t& _color) const;
+
+        public:
+          _NodeIterator             _it_node;
+          _NodeIterator             _it_node_end;
+          _InfoList                 _infoList;
+          _TpStateContainer<_State> _stContainer;
+
+          unsigned long             _global_time;
+
+          cgt::base::array<_Node*>  _roots;   /** < the first nodes of a local search from many nodes */
+          size_t                    _root;    /** < the next of them to become the current node */
+
+        private:
+          cgt::base::array<_Info*>        _infoTable;   /** < the info of each node, by its id */
+          cgt::base::array<unsigned char> _colorTable;  /** < the color of each node, by its id */
+          _Workspace*                     _ptr_ws;      /** < the state of a local search, or NULL */
+      };
+
+
     /*!
      * \class _SearchIterator
      * \brief The base template for breadth-first and depth-first search iterators.
@@ -59,6 +145,20 @@ namespace cgt
      * operations that are shared by both, and accepts a template class as a
      * container template that is initialized as a queue or a stack according
      * to the method of search.
+     *
+     * The info of each node (see _SearchInfo) is kept in a list, in the
+     * order of the nodes of the graph, and is found by the id of the node
+     * in a table of pointers. The color of each node, checked for every
+     * edge examined, is also kept in an array of bytes indexed by id. So
+     * a whole search takes \b O(V + E) time.
+     *
+     * Started with a _SearchWorkspace, the search is local: it visits
+     * only the nodes reachable from the first one, and keeps the infos
+     * of the nodes it discovers in the workspace (see _SearchWorkspace),
+     * so it takes time proportional to the part of the graph it visits.
+     *
+     * All of this is kept in a _SearchEngine shared by the copies of the
+     * iterator, so copies are \b O(1) and advance the same search.
      */
 
     template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
@@ -78,8 +178,6 @@ namespace cgt
 #else
           typedef std::list<_Info>              _InfoList;
 #endif
-          typedef typename _InfoList::iterator        _InfoIterator;
-          typedef typename _InfoList::const_iterator  _InfoCIterator;
 
         protected:
           typedef _GraphNode<_TpVertex, _TpEdge>      _Node;
@@ -92,25 +190,45 @@ namespace cgt
           typedef typename _NodeList::const_iterator  _NodeCIterator;
 
           typedef _SearchState<_TpVertex, _TpEdge>    _State;
+          typedef _SearchWorkspace<_TpVertex, _TpEdge> _Workspace;
+          typedef _SearchEngine<_TpVertex, _TpEdge, _TpStateContainer> _Engine;
 
         private:
           typedef typename _TpIterator<_Node>::pointer    pointer;
           typedef typename _TpIterator<_Node>::reference  reference;
 
         protected:
-          _SearchIterator () : _ptr_node (NULL), _it_node (NULL), _it_node_end (NULL), _global_time (0) { }
-          _SearchIterator (_Node* const _ptr_n) : _ptr_node (_ptr_n), _global_time (0) { }
+          _SearchIterator () : _ptr_node (NULL) { }
+          _SearchIterator (_Node* const _ptr_n) : _ptr_node (_ptr_n) { }
           _SearchIterator (_Node* const _ptr_n, const _NodeIterator& _it_begin, const _NodeIterator& _it_end)
-            : _ptr_node (_ptr_n), _it_node (_it_begin), _it_node_end (_it_end), _global_time (0)
+            : _ptr_node (_ptr_n), _engine (new _Engine (_it_begin, _it_end, NULL))
           {
             _BRK();
             if (_ptr_node)
-              _init ();
+              _engine->_init (*_ptr_node);
             _BRK();
           }
 
+          /** a local search from \b _ptr_n, with its state in \b _ws: there's no next root, so _it_node is _it_end */
+          _SearchIterator (_Node* const _ptr_n, const _NodeIterator& _it_end, _Workspace& _ws)
+            : _ptr_node (_ptr_n), _engine (new _Engine (_it_end, _it_end, &_ws))
+          {
+            if (_ptr_node)
+              _engine->_init (*_ptr_node);
+          }
+
+          /** a local search from all nodes of \b _r at once (see _BreadthIterator): the first one is the current node */
+          _SearchIterator (const cgt::base::array<_Node*>& _r, const _NodeIterator& _it_end, _Workspace& _ws)
+            : _ptr_node (_r.empty () ? NULL : _r [0]), _engine (new _Engine (_it_end, _it_end, &_ws))
+          {
+            _engine->_roots = _r;
+
+            if (_ptr_node)
+              _engine->_init (*_ptr_node);
+          }
+
         public:
-          _SearchIterator (const _SelfCommon& _it) { *this = _it; }
+          _SearchIterator (const _SelfCommon& _it) : _ptr_node (_it._ptr_node), _engine (_it._engine) { }
 
         protected:
           virtual ~_SearchIterator () { }
@@ -118,59 +236,73 @@ namespace cgt
         public:
           const _Self& operator=(const _SelfCommon& _it)
           {
-            _ptr_node     = _it._ptr_node;
-            _it_node      = _it._it_node;
-            _it_node_end  = _it._it_node_end;
-            _global_time  = _it._global_time;
-            _infoList     = _it._infoList;
-            _stContainer  = _it._stContainer;
+            _ptr_node = _it._ptr_node;
+            _engine   = _it._engine;
 
             return *this;
           }
 
-        private:
-          void _init ();
-
         protected:
-          _Info* _get_depth_info_by_node (const _Node& _node);
+          _Info* _get_depth_info_by_node (const _Node& _node) { return _engine->_get_depth_info_by_node (_node); }
+          _InfoList& _info_list () { return _engine->_info_list (); }
 
         protected:
-          void _discover_node (const _Node& _node, const _Node* const _ptr_parent, const unsigned long& _d);
-          void _finish_node (const _Node& _node, const unsigned long& _f);
-          const bool _has_color (const _Node& _node, const typename _Info::_color_t& _color) const;
+          void _discover_node (const _Node& _node, const _Node* const _ptr_parent, const unsigned long& _d) { _engine->_discover_node (_node, _ptr_parent, _d); }
+          void _finish_node (const _Node& _node, const unsigned long& _f) { _engine->_finish_node (_node, _f); }
+          const bool _has_color (const _Node& _node, const typename _Info::_color_t& _color) const { return _engine->_has_color (_node, _color); }
 
         public:
           reference operator*() const { return *_ptr_node; }
           pointer operator->() const { return _ptr_node; }
           const bool operator==(const _Self& _other) const { return _ptr_node == _other._ptr_node; }
           const bool operator!=(const _Self& _other) const { return !(*this == _other); }
-          const _Self operator++(int);
 
         protected:
-          _Node*                    _ptr_node;
-          _NodeIterator             _it_node;
-          _NodeIterator             _it_node_end;
-          _InfoList                 _infoList;
-          _TpStateContainer<_State> _stContainer;
-
-          unsigned long             _global_time;
+          _Node*                      _ptr_node;
+          cgt::base::_Shared<_Engine> _engine;
       };
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer, template<typename> class _TpIterator>
-      void _SearchIterator<_TpVertex, _TpEdge, _TpStateContainer, _TpIterator>::_init ()
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer>
+      void _SearchEngine<_TpVertex, _TpEdge, _TpStateContainer>::_init (_Node& _node)
       {
         /*!
-         * paint the first node (_ptr_node) with GRAY;
+         * paint the first node (_node) with GRAY;
          * put it on the state container;
-         * turn it the current node (actualy, it already is the current node);
+         * (the iterator already points to it: it's the current node);
          * paint all the others with WHITE.
          */
 
+        if (_ptr_ws)
+        {
+          _ptr_ws->_reset ();
+
+          if (_roots.empty ())
+            _start (_node);
+          else
+          {
+            /* all the first nodes, but the repeated ones, at once */
+
+            size_t _k = 0;
+
+            for (size_t i = 0; i < _roots.size (); i++)
+              if (! _ptr_ws->_find (_roots [i]->id ()))
+              {
+                _start (*(_roots [i]));
+                _roots [_k++] = _roots [i];
+              }
+
+            _roots.resize (_k);
+            _root = 1;
+          }
+
+          return;
+        }
+
         _NodeIterator _it;
 
         for (_it = _it_node; _it != _it_node_end; ++_it)
         {
-          if (&(*_it) == _ptr_node)
+          if (&(*_it) == &_node)
           {
             _infoList.push_back (_Info (*_it, _Info::GRAY, ++_global_time));
             _stContainer.insert (_State (*_it));
@@ -178,43 +310,75 @@ namespace cgt
           else
             _infoList.push_back (_Info (*_it));
         }
+
+        _index_infos ();
+      }
+
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer>
+      void _SearchEngine<_TpVertex, _TpEdge, _TpStateContainer>::_start (_Node& _node)
+      {
+        _Info* _ptr = _ptr_ws->_insert (_node);
+        _ptr->set_color (_Info::GRAY);
+        _ptr->set_discovery (++_global_time);
+        _stContainer.insert (_State (_node));
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer, template<typename> class _TpIterator>
-      typename _SearchIterator<_TpVertex, _TpEdge, _TpStateContainer, _TpIterator>::_Info* _SearchIterator<_TpVertex, _TpEdge, _TpStateContainer, _TpIterator>::_get_depth_info_by_node (const _Node& _node)
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer>
+      void _SearchEngine<_TpVertex, _TpEdge, _TpStateContainer>::_index_infos ()
       {
-        _Info *_ptr = NULL;
+        size_t _n = 0;
 
         _InfoIterator _it;
         _InfoIterator _itEnd = _infoList.end ();
 
+        for (_it = _infoList.begin (); _it != _itEnd; ++_it)
+          if (_it->node ().id () >= _n)
+            _n = _it->node ().id () + 1;
+
+        _infoTable.clear ();
+        _infoTable.resize (_n, NULL);
+        _colorTable.clear ();
+        _colorTable.resize (_n, _Info::WHITE);
+
         for (_it = _infoList.begin (); _it != _itEnd; ++_it)
         {
-          if (_it->node ().vertex () == _node.vertex ())
-          {
-            _ptr = &(*_it);
-            break;
-          }
+          _infoTable [_it->node ().id ()] = &(*_it);
+          _colorTable [_it->node ().id ()] = _it->color ();
         }
+      }
+
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer>
+      typename _SearchEngine<_TpVertex, _TpEdge, _TpStateContainer>::_Info* _SearchEngine<_TpVertex, _TpEdge, _TpStateContainer>::_get_depth_info_by_node (const _Node& _node)
+      {
+        const size_t& _id = _node.id ();
+
+        if (_ptr_ws)
+          return _ptr_ws->_find (_id);
 
-        return _ptr;
+        return (_id < _infoTable.size () ? _infoTable [_id] : NULL);
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer, template<typename> class _TpIterator>
-      void _SearchIterator<_TpVertex, _TpEdge, _TpStateContainer, _TpIterator>::_discover_node (const _Node& _node, const _Node* const _ptr_parent, const unsigned long& _d)
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer>
+      void _SearchEngine<_TpVertex, _TpEdge, _TpStateContainer>::_discover_node (const _Node& _node, const _Node* const _ptr_parent, const unsigned long& _d)
       {
         _Info *_ptr = _get_depth_info_by_node (_node);
 
+        if (_ptr_ws && ! _ptr)
+          _ptr = _ptr_ws->_insert (const_cast<_Node&>(_node));
+
         if (_ptr)
         {
           _ptr->set_parent (_ptr_parent);
           _ptr->set_color (_Info::GRAY);
           _ptr->set_discovery (_d);
+
+          if (! _ptr_ws)
+            _colorTable [_node.id ()] = _Info::GRAY;
         }
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer, template<typename> class _TpIterator>
-      void _SearchIterator<_TpVertex, _TpEdge, _TpStateContainer, _TpIterator>::_finish_node (const _Node& _node, const unsigned long& _f)
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer>
+      void _SearchEngine<_TpVertex, _TpEdge, _TpStateContainer>::_finish_node (const _Node& _node, const unsigned long& _f)
       {
         _Info *_ptr = _get_depth_info_by_node (_node);
 
@@ -222,35 +386,24 @@ namespace cgt
         {
           _ptr->set_color (_Info::BLACK);
           _ptr->set_finish (_f);
+
+          if (! _ptr_ws)
+            _colorTable [_node.id ()] = _Info::BLACK;
         }
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer, template<typename> class _TpIterator>
-      const bool _SearchIterator<_TpVertex, _TpEdge, _TpStateContainer, _TpIterator>::_has_color (const _Node& _node, const typename _Info::_color_t& _color) const
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer>
+      const bool _SearchEngine<_TpVertex, _TpEdge, _TpStateContainer>::_has_color (const _Node& _node, const typename _Info::_color_t& _color) const
       {
-        bool bRet = false;
+        const size_t& _id = _node.id ();
 
-        _InfoCIterator it;
-        _InfoCIterator itEnd = _infoList.end ();
-
-        for (it = _infoList.begin (); it != itEnd; ++it)
+        if (_ptr_ws)
         {
-          if (it->node ().vertex () == _node.vertex ())
-          {
-            bRet = (it->color () == _color);
-            break;
-          }
+          const _Info* _ptr = _ptr_ws->_find (_id);
+          return ((_ptr ? _ptr->color () : _Info::WHITE) == _color);
         }
 
-        return bRet;
-      }
-
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer, template<typename> class _TpIterator>
-      const _SearchIterator<_TpVertex, _TpEdge, _TpStateContainer, _TpIterator> _SearchIterator<_TpVertex, _TpEdge, _TpStateContainer, _TpIterator>::operator++(int)
-      {
-        _Self _it = *this;
-        operator++();
-        return _it;
+        return (_id < _colorTable.size () && _colorTable [_id] == _color);
       }
   }
 }
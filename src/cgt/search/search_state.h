@@ -70,19 +70,19 @@ namespace cgt
 #endif
 
         public:
-          _SearchState (_Node& _n) : _node (_n), _it_adj (_node.adjlist ().begin ()), _it_adj_end (_node.adjlist ().end ()) { };
+          _SearchState (_Node& _n) : _ptr_node (&_n), _it_adj (_n.adjlist ().begin ()), _it_adj_end (_n.adjlist ().end ()) { };
 
 		_Self& operator=(const _Self& _s);
 
         public:
-          const _Node& node () { return _node; }
+          const _Node& node () const { return *_ptr_node; }
           const bool adj_finished () const { return (_it_adj == _it_adj_end); }
           void adj_incr () { ++_it_adj; }
           _Node& _adj_node () { return _it_adj->node (); }
-          const _TpVertex& value () const { return _node.vertex ().value (); }
+          const _TpVertex& value () const { return _ptr_node->vertex ().value (); }
 
         private:
-          _Node&       _node;
+          _Node*       _ptr_node;  /** < a pointer, so states can be assigned to the slots of a ring_queue or array_stack */
           _AdjIterator       _it_adj;
           _AdjIterator _it_adj_end;
       };
@@ -90,7 +90,7 @@ namespace cgt
 	template<typename _TpVertex, typename _TpEdge>
 		_SearchState<_TpVertex, _TpEdge>& _SearchState<_TpVertex, _TpEdge>::operator=(const _SearchState<_TpVertex, _TpEdge>& _s)
 		{
-			_node = _s._node;
+			_ptr_node = _s._ptr_node;
 			_it_adj = _s._it_adj;
 			_it_adj_end = _s._it_adj_end;
 
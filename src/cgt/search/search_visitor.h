@@ -0,0 +1,210 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/search/search_visitor.h
+ * \brief Contains the base of the visitors of breadth_first and depth_first, and their workspace.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SEARCH__SEARCH_VISITOR_H_
+#define __CGTL__CGT_SEARCH__SEARCH_VISITOR_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/graph_adjacency.h"
+#include "cgt/graph_adjlist.h"
+#include "cgt/base/array.h"
+#include "cgt/base/ring_queue.h"
+#include "cgt/base/array_stack.h"
+
+
+namespace cgt
+{
+  namespace search
+  {
+    /*!
+     * \class _SearchVisitor
+     * \brief The hooks called by breadth_first and depth_first, that do nothing.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * A visitor is any class with these methods, usually one derived from
+     * _SearchVisitor (graph::visitor) that hides the ones it needs. The
+     * search functions are templates of the visitor's type, so the calls
+     * are resolved at compile time (there's nothing virtual here), and the
+     * empty ones vanish when the search is inlined:
+     *
+     *  - discover: a node is reached for the first time, from \b _ptr_parent
+     *    (NULL for the source);
+     *  - examine_edge: an adjacency of \b _node is examined, whether its
+     *    node was already reached or not;
+     *  - finish: all adjacencies of a node were examined;
+     *  - done: checked after each discover (and, in depth_first, after each
+     *    back edge), stops the search when true.
+     *
+     * depth_first also classifies each adjacency examined, right after
+     * examine_edge, by the state of its node:
+     *
+     *  - tree_edge: the node wasn't reached yet (discover comes next);
+     *  - back_edge: the node is on the path from the source (discovered and
+     *    not finished), so the edge closes a cycle;
+     *  - forward_edge: the node was finished, and discovered after \b _node
+     *    (it's a descendant of \b _node);
+     *  - cross_edge: the node was finished, and discovered before \b _node.
+     *
+     * In undirected graphs each edge is in the lists of both nodes, so the
+     * edge from a node back to its parent is a back edge too.
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _SearchVisitor
+      {
+        private:
+          typedef _GraphNode<_TpVertex, _TpEdge>      _Node;
+          typedef _GraphAdjacency<_TpVertex, _TpEdge> _Adjacency;
+
+        public:
+          void discover (const _Node& _node, const _Node* _ptr_parent) { }
+          void examine_edge (const _Node& _node, const _Adjacency& _adj) { }
+          void finish (const _Node& _node) { }
+          const bool done () const { return false; }
+
+        public:
+          void tree_edge (const _Node& _node, const _Adjacency& _adj) { }
+          void back_edge (const _Node& _node, const _Adjacency& _adj) { }
+          void forward_edge (const _Node& _node, const _Adjacency& _adj) { }
+          void cross_edge (const _Node& _node, const _Adjacency& _adj) { }
+      };
+
+
+    /*!
+     * \class _VisitWorkspace
+     * \brief The state of breadth_first and depth_first, reused from one search to the next.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * Nodes reached are marked with the \b epoch of the search in an array
+     * by id, so a new search just increments the epoch (as in
+     * _SearchWorkspace), and the queue and the stack keep their buffers: a
+     * search from a node takes time proportional to the part of the graph
+     * it explores, and allocates nothing once the workspace has grown.
+     *
+     * depth_first also keeps the order in which each node was discovered,
+     * and marks the nodes finished with the epoch, so an edge is classified
+     * in \b O(1).
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _VisitWorkspace
+      {
+        private:
+          typedef _GraphNode<_TpVertex, _TpEdge>        _Node;
+          typedef _GraphAdjList<_TpVertex, _TpEdge>     _AdjList;
+          typedef typename _AdjList::const_iterator     _AdjCIterator;
+
+        public:
+          /** a node of the path of depth_first, and its next adjacency to examine */
+          struct _Frame
+          {
+            _Frame (const _Node& _n) : _ptr_node (&_n), _it (_n.adjlist ().begin ()), _it_end (_n.adjlist ().end ()) { }
+
+            const _Node*  _ptr_node;
+            _AdjCIterator _it;
+            _AdjCIterator _it_end;
+          };
+
+        public:
+          _VisitWorkspace () : _epoch (0) { }
+
+        public:
+          /** starts a search of a graph with \b _n nodes (\b _depth: one that classifies edges) */
+          void _begin (const size_t& _n, const bool& _depth = false);
+
+          /** marks the node with id \b _id: false if it was already marked */
+          bool _visit (const size_t& _id)
+          {
+            if (_stamps [_id] == _epoch)
+              return false;
+
+            _stamps [_id] = _epoch;
+            return true;
+          }
+
+          /** marks the node with id \b _id, the \b _n th discovered: false if it was already marked */
+          bool _visit (const size_t& _id, const size_t& _n)
+          {
+            if (! _visit (_id))
+              return false;
+
+            _order [_id] = _n;
+            return true;
+          }
+
+          void _finish (const size_t& _id) { _finished [_id] = _epoch; }
+          const bool _is_finished (const size_t& _id) const { return (_finished [_id] == _epoch); }
+          const size_t& _order_of (const size_t& _id) const { return _order [_id]; }
+
+        public:
+          cgt::base::ring_queue<const _Node*>  _queue;
+          cgt::base::array_stack<_Frame>       _stack;
+
+        private:
+          cgt::base::array<unsigned int>  _stamps;
+          cgt::base::array<unsigned int>  _finished;
+          cgt::base::array<size_t>        _order;
+          unsigned int                    _epoch;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _VisitWorkspace<_TpVertex, _TpEdge>::_begin (const size_t& _n, const bool& _depth)
+      {
+        if (_stamps.size () < _n)
+          _stamps.resize (_n, 0);
+
+        if (_depth && _finished.size () < _n)
+        {
+          _finished.resize (_n, 0);
+          _order.resize (_n, 0);
+        }
+
+        if (++_epoch == 0)
+        {
+          for (size_t i = 0; i < _stamps.size (); i++)
+            _stamps [i] = 0;
+
+          for (size_t i = 0; i < _finished.size (); i++)
+            _finished [i] = 0;
+
+          _epoch = 1;
+        }
+
+        _queue.clear ();
+        _stack.clear ();
+      }
+  }
+}
+
+#endif // __CGTL__CGT_SEARCH__SEARCH_VISITOR_H_
@@ -0,0 +1,166 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/search/search_workspace.h
+ * \brief Contains the workspace shared by local breadth-first and depth-first searches.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SEARCH__SEARCH_WORKSPACE_H_
+#define __CGTL__CGT_SEARCH__SEARCH_WORKSPACE_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/search/search_info.h"
+#include "cgt/base/array.h"
+#ifdef CGTL_DO_NOT_USE_STL
+#include "cgt/base/list.h"
+#else
+#include <list>
+#endif
+
+
+namespace cgt
+{
+  namespace search
+  {
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpStateContainer>
+      class _SearchEngine;
+
+    /*!
+     * \class _SearchWorkspace
+     * \brief The search state of local breadth-first and depth-first searches, reused from one search to the next.
+     * \author Leandro Costa
+     * \date 2011
+     *
+     * A search iterator started with a workspace (see graph::bbegin and
+     * graph::dbegin) doesn't paint every node of the graph WHITE before
+     * its first step: the info of a node (see _SearchInfo) is created
+     * when it's discovered, and every node without info is WHITE. So a
+     * search takes time and memory proportional to the part of the graph
+     * it visits, and not to the size of the graph.
+     *
+     * The infos of a node are found by its id in a table of pointers
+     * stamped with the \b epoch of the search that wrote them. A new
+     * search just increments the epoch, so the stamps of the previous
+     * one become old (and their nodes WHITE) without clearing the table.
+     * The table grows with the highest id discovered, and is kept for
+     * the next searches (reserve () allocates it at once).
+     *
+     * A workspace keeps the state of one search at a time: starting a
+     * search resets it, and the copies of a search iterator share it.
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      class _SearchWorkspace
+      {
+        private:
+          template<typename _TpV, typename _TpE, template<typename> class _TpS>
+            friend class _SearchEngine;
+
+        private:
+          typedef _GraphNode<_TpVertex, _TpEdge>  _Node;
+          typedef _SearchInfo<_TpVertex, _TpEdge> _Info;
+#ifdef CGTL_DO_NOT_USE_STL
+          typedef cgt::base::list<_Info>          _InfoList;
+#else
+          typedef std::list<_Info>                _InfoList;
+#endif
+
+        public:
+          _SearchWorkspace () : _epoch (0) { }
+
+        private:
+          _SearchWorkspace (const _SearchWorkspace&);
+          _SearchWorkspace& operator=(const _SearchWorkspace&);
+
+        public:
+          /** allocates the table for nodes with ids up to \b _n - 1 */
+          void reserve (const size_t& _n) { if (_n > _stamps.size ()) _grow (_n); }
+
+          /** the number of nodes discovered by the last search */
+          size_t size () const { return _infoList.size (); }
+
+        private:
+          /** starts a new search: O(1), but for the clear of the stamps when the epoch wraps around */
+          void _reset ();
+
+          _Info* _find (const size_t& _id) const { return (_id < _stamps.size () && _stamps [_id] == _epoch ? _infos [_id] : NULL); }
+          _Info* _insert (_Node& _node);
+
+          void _grow (const size_t& _n);
+
+        private:
+          _InfoList                       _infoList;  /** < the infos of the nodes discovered, in the order of discovery */
+          cgt::base::array<_Info*>        _infos;     /** < the info of each node, by its id */
+          cgt::base::array<unsigned int>  _stamps;    /** < the epoch when each entry of _infos was written */
+          unsigned int                    _epoch;
+      };
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _SearchWorkspace<_TpVertex, _TpEdge>::_reset ()
+      {
+        _infoList.clear ();
+
+        if (++_epoch == 0)
+        {
+          for (size_t i = 0; i < _stamps.size (); i++)
+            _stamps [i] = 0;
+
+          _epoch = 1;
+        }
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      typename _SearchWorkspace<_TpVertex, _TpEdge>::_Info* _SearchWorkspace<_TpVertex, _TpEdge>::_insert (_Node& _node)
+      {
+        const size_t& _id = _node.id ();
+
+        if (_id >= _stamps.size ())
+          _grow (_id + 1);
+
+        _infoList.push_back (_Info (_node));
+        _infos [_id] = &(_infoList.back ());
+        _stamps [_id] = _epoch;
+
+        return _infos [_id];
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _SearchWorkspace<_TpVertex, _TpEdge>::_grow (const size_t& _n)
+      {
+        size_t _c = (_stamps.size () ? _stamps.size () : 1);
+
+        while (_c < _n)
+          _c *= 2;
+
+        _infos.resize (_c, NULL);
+        _stamps.resize (_c, 0);
+      }
+  }
+}
+
+#endif // __CGTL__CGT_SEARCH__SEARCH_WORKSPACE_H_
@@ -0,0 +1,274 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/shortpath/single/astar/astar_iterator.h
+ * \brief Contains definition of an iterator that implements A* algorithm.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SHORTPATH_SINGLE_ASTAR_ASTAR_ITERATOR_H_
+#define __CGTL__CGT_SHORTPATH_SINGLE_ASTAR_ASTAR_ITERATOR_H_
+
+#include "cgt/shortpath/single/dijkstra/dijkstra_info.h"
+#include "cgt/graph_node.h"
+#include "cgt/graph_adjlist.h"
+#include "cgt/base/array.h"
+#include "cgt/base/indexed_heap.h"
+#include "cgt/base/shared.h"
+
+
+namespace cgt
+{
+	namespace shortpath
+	{
+		namespace single
+		{
+			/*!
+			 * \namespace cgt::shortpath::single::astar
+			 * \brief Where are defined structures related to A* iterator.
+			 * \author Leandro Costa
+			 * \date 2011
+			 */
+
+			namespace astar
+			{
+				/*!
+				 * \class _AStarEngine
+				 * \brief The state of A* algorithm, shared by the copies of its iterator.
+				 * \author Leandro Costa
+				 * \date 2011
+				 *
+				 * Only the nodes reached by the search have an info: they're kept
+				 * in an array, in the order they were reached, with a table from
+				 * node ids to their positions, and the positions of the nodes
+				 * reached but not taken in a cgt::base::indexed_heap, by distance
+				 * from the source plus the estimate of the heuristic.
+				 */
+
+				template<typename _TpVertex, typename _TpEdge, typename _TpHeuristic>
+					class _AStarEngine
+					{
+						public:
+							typedef cgt::shortpath::single::dijkstra::_DijkstraInfo<_TpVertex, _TpEdge>  _Info;
+
+						private:
+							typedef _GraphNode<_TpVertex, _TpEdge>        _Node;
+							typedef _GraphAdjList<_TpVertex, _TpEdge>     _AdjList;
+							typedef typename _AdjList::const_iterator     _AdjListIterator;
+							typedef cgt::base::indexed_heap<_TpEdge>      _Heap;
+
+						public:
+							/*
+							 * The constructor takes _ptr_n, and reaches the nodes from its adjacency list.
+							 * Node ids must be lower than _num_nodes.
+							 */
+							_AStarEngine (_Node* const _ptr_n, const size_t& _num_nodes, const _TpHeuristic& _h);
+
+						private:
+							_AStarEngine (const _AStarEngine&);
+							_AStarEngine& operator=(const _AStarEngine&);
+
+						public:
+							/** takes the node with the lowest distance plus estimate, and returns it (NULL when there are no more) */
+							_Node* _next ();
+
+							const _Info* const _get_info_by_node (const _Node* const _ptr_node) const;
+
+							/** the number of nodes reached so far (taken or not) */
+							size_t _num_reached () const { return _infos.size (); }
+
+						private:
+							void _reach (_Node& _node, const _TpEdge& _distance, const _Node* const _ptr_prev);
+							void _relax (const size_t& _p);
+
+						private:
+							_TpHeuristic              _h;
+							cgt::base::array<_Info>   _infos; /** < the infos of the nodes reached, in the order they were reached */
+							cgt::base::array<size_t>  _slots; /** < node id -> the position of its info in _infos (npos if it wasn't reached) */
+							_Heap                     _heap;  /** < the positions of the nodes reached and not taken */
+					};
+
+				template<typename _TpVertex, typename _TpEdge, typename _TpHeuristic>
+					_AStarEngine<_TpVertex, _TpEdge, _TpHeuristic>::_AStarEngine (_Node* const _ptr_n, const size_t& _num_nodes, const _TpHeuristic& _h) : _h (_h)
+					{
+						/*
+						 * each node has one info at most: with room for all of them,
+						 * _infos never moves, and the pointers given by
+						 * _get_info_by_node stay valid
+						 */
+
+						_infos.reserve (_num_nodes);
+						_slots.resize (_num_nodes, _Heap::npos);
+
+						_Info _info (*_ptr_n);
+						_info.set_origin ();
+						_slots [_ptr_n->id ()] = 0;
+						_infos.push_back (_info);
+
+						_relax (0);
+					}
+
+				template<typename _TpVertex, typename _TpEdge, typename _TpHeuristic>
+					const cgt::shortpath::single::dijkstra::_DijkstraInfo<_TpVertex, _TpEdge>* const _AStarEngine<_TpVertex, _TpEdge, _TpHeuristic>::_get_info_by_node (const _Node* const _ptr_node) const
+					{
+						size_t _id = _ptr_node->id ();
+
+						return (_id < _slots.size () && _slots [_id] != _Heap::npos ? &(_infos [_slots [_id]]) : NULL);
+					}
+
+				template<typename _TpVertex, typename _TpEdge, typename _TpHeuristic>
+					void _AStarEngine<_TpVertex, _TpEdge, _TpHeuristic>::_reach (_Node& _node, const _TpEdge& _distance, const _Node* const _ptr_prev)
+					{
+						size_t& _p = _slots [_node.id ()];
+
+						if (_p == _Heap::npos)
+						{
+							_p = _infos.size ();
+							_infos.push_back (_Info (_node));
+						}
+						else if (! (_distance < _infos [_p].distance ()))
+							return;
+
+						_Info& _info = _infos [_p];
+						_info._set_distance (_distance);
+						_info._set_previous (_ptr_prev);
+
+						/*
+						 * a node already taken is taken again when a shorter path
+						 * to it is found (only if the heuristic isn't consistent)
+						 */
+
+						_TpEdge _key = _distance + _h (_node.value ());
+
+						if (_heap.contains (_p))
+							_heap.decrease (_p, _key);
+						else
+							_heap.push (_p, _key);
+					}
+
+				template<typename _TpVertex, typename _TpEdge, typename _TpHeuristic>
+					void _AStarEngine<_TpVertex, _TpEdge, _TpHeuristic>::_relax (const size_t& _p)
+					{
+						_Node* _ptr_node = &(_infos [_p].node ());
+						_TpEdge _distance = _infos [_p].distance ();
+
+						const _AdjList &adjList = _ptr_node->adjlist ();
+						_AdjListIterator itAEnd = adjList.end ();
+
+						for (_AdjListIterator itA = adjList.begin (); itA != itAEnd; ++itA)
+							_reach (itA->node (), _distance + itA->edge ().value (), _ptr_node);
+					}
+
+				template<typename _TpVertex, typename _TpEdge, typename _TpHeuristic>
+					_GraphNode<_TpVertex, _TpEdge>* _AStarEngine<_TpVertex, _TpEdge, _TpHeuristic>::_next ()
+					{
+						if (_heap.empty ())
+							return NULL;
+
+						size_t _p = _heap.pop ();
+						_relax (_p);
+
+						return &(_infos [_p].node ());
+					}
+
+
+				/*!
+				 * \class _AStarIterator
+				 * \brief An iterator that implements A* algorithm.
+				 * \author Leandro Costa
+				 * \date 2011
+				 *
+				 * Like _DijkstraIterator, it returns the nodes reachable from the
+				 * source, with their distances and previous nodes (see info), but
+				 * in the order of their distance from the source plus an estimate
+				 * of their distance to a target, given by the heuristic: a functor
+				 * that takes a vertex and returns a _TpEdge. The search is led
+				 * towards the target, and when the target comes out, usually only
+				 * a small part of the nodes closer to the source than the target
+				 * were taken (in a grid with euclidean or manhattan estimates,
+				 * about the nodes along the way). With a heuristic that always
+				 * returns 0 it's Dijkstra Algorithm.
+				 *
+				 * The heuristic must be admissible (it can't return more than the
+				 * distance to the target), and then the target comes out with its
+				 * shortest distance. If it's also consistent (for each edge from
+				 * \b u to \b v, <b>h (u) <= value + h (v)</b>, as for any distance
+				 * on a map), each node comes out once, with its shortest distance;
+				 * otherwise a node may come out again, with a shorter distance.
+				 *
+				 * Only the nodes reached have state, so the search takes
+				 * <b>O(n log n)</b> for the \b n nodes it reaches, besides a table
+				 * of \b V ids. Copies of the iterator share the search, as in
+				 * _DijkstraIterator. Edge values can't be negative.
+				 */
+
+				template<typename _TpVertex, typename _TpEdge, typename _TpHeuristic>
+					class _AStarIterator
+					{
+						private:
+							typedef _AStarIterator<_TpVertex, _TpEdge, _TpHeuristic>  _Self;
+							typedef _AStarEngine<_TpVertex, _TpEdge, _TpHeuristic>    _Engine;
+							typedef _GraphNode<_TpVertex, _TpEdge>                    _Node;
+
+						public:
+							typedef typename _Engine::_Info                           _Info;
+
+						public:
+							_AStarIterator () : _ptr_node (NULL) { }
+							_AStarIterator (_Node* const _ptr_n) : _ptr_node (_ptr_n) { }
+							_AStarIterator (_Node* const _ptr_n, const size_t& _num_nodes, const _TpHeuristic& _h) : _ptr_node (_ptr_n)
+						{
+							if (_ptr_node)
+								_engine = cgt::base::_Shared<_Engine> (new _Engine (_ptr_node, _num_nodes, _h));
+						}
+
+						public:
+							_Node& operator*() const { return *_ptr_node; }
+							_Node* operator->() const { return _ptr_node; }
+							const bool operator==(const _Self& _other) const { return (_ptr_node == _other._ptr_node); }
+							const bool operator!=(const _Self& _other) const { return !(*this == _other); }
+							_Self& operator++() { _ptr_node = _engine->_next (); return *this; }
+							_Self operator++(int) { _Self _it = *this; operator++(); return _it; }
+
+						public:
+							/** the distance and the previous node of a node reached (NULL if it wasn't reached) */
+							const _Info* const info (const _Node* const _ptr_node) const { return _engine->_get_info_by_node (_ptr_node); }
+							const _Info* const info (const _Node& _node) const { return _engine->_get_info_by_node (&_node); }
+
+							/** the number of nodes reached so far */
+							size_t reached () const { return _engine->_num_reached (); }
+
+						private:
+							_Node*                      _ptr_node;
+							cgt::base::_Shared<_Engine> _engine;
+					};
+			}
+		}
+	}
+}
+
+#endif // __CGTL__CGT_SHORTPATH_SINGLE_ASTAR_ASTAR_ITERATOR_H_
@@ -95,8 +95,8 @@ namespace cgt
             typedef typename _Base::iterator          _Iterator;
 
           private:
-            static const bool _has_node (const _Info& _info, const _Node& _node) { return (_info.node ().vertex () == _node.vertex ()); }
-            static const bool _has_vertex (const _Info& _info, const _Vertex& _vertex) { return (_info.node ().vertex () == _vertex); }
+            static const bool _has_node (const _Info& _info, const _Node& _node) { return (&(_info.node ()) == &_node); }
+            static const bool _has_vertex (const _Info& _info, const _Vertex& _vertex) { return (&(_info.node ().vertex ()) == &_vertex); }
 
           public:
             _Iterator get_by_node (const _Node* const _ptr_node);
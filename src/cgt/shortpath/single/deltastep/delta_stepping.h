@@ -0,0 +1,748 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/shortpath/single/deltastep/delta_stepping.h
+ * \brief Contains the parallel delta-stepping single-source shortest-path search.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SHORTPATH_SINGLE_DELTASTEP_DELTA_STEPPING_H_
+#define __CGTL__CGT_SHORTPATH_SINGLE_DELTASTEP_DELTA_STEPPING_H_
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "cgt/shortpath/single/dijkstra/dijkstra_info.h"
+#include "cgt/graph_node.h"
+#include "cgt/graph_adjlist.h"
+#include "cgt/base/array.h"
+
+
+namespace cgt
+{
+  namespace shortpath
+  {
+    namespace single
+    {
+      /*!
+       * \namespace cgt::shortpath::single::deltastep
+       * \brief Where are defined structures related to delta-stepping search.
+       * \author Leandro Costa
+       * \date 2011
+       */
+
+      namespace deltastep
+      {
+        /*!
+         * \class _DeltaStepping
+         * \brief Finds the distances (and a shortest-path tree) from a node to all others with a group of threads.
+         * \author Leandro Costa
+         * \date 2011
+         *
+         * Delta-stepping keeps the nodes reached in buckets of distances
+         * \b delta wide, and takes a whole bucket at a time, with no order
+         * among its nodes: the threads take chunks of the nodes of the
+         * current bucket from a shared cursor and relax their \b light edges
+         * (values up to \b delta), that may put nodes back in the same
+         * bucket, until the bucket stays empty; then each thread relaxes the
+         * \b heavy edges (longer than \b delta) of the nodes it took, that
+         * only reach later buckets. A small \b delta makes it Dijkstra
+         * Algorithm (few nodes per bucket, each taken once), a large one
+         * Bellman-Ford's (many nodes per bucket, taken many times).
+         *
+         * Each thread keeps its own buckets, where it puts the nodes whose
+         * distance it lowered, so only the distance and previous node of a
+         * node are shared: they're written together under a spin lock of the
+         * node (a single mutex without GCC atomic builtins), after an
+         * unlocked read has shown the new distance is shorter. Between the
+         * phases of a bucket, the buckets of the threads are copied, each to
+         * its place, into the list of nodes of the next phase, as in
+         * _ParallelSearch, so a phase costs 3 barriers. The unlocked reads
+         * of a distance (and of whether the node was reached) are relaxed
+         * atomic loads, matched by atomic stores under the lock; without
+         * them, the distance is read under the lock.
+         *
+         * The buckets of a thread are a ring: the distances reached from the
+         * current bucket are at most the greatest edge value \b C beyond it,
+         * so <b>ceil (C / delta) + 1</b> slots hold them all, and bucket \b b
+         * lies in slot <b>b mod</b> that number, whatever the greatest
+         * distance. The ring has 1024 slots at most: a node put beyond it
+         * waits in an overflow list of the thread, and goes to the ring when
+         * the current bucket gets near, so the memory doesn't depend on
+         * \b C / \b delta either.
+         *
+         * The edges are copied when the search is built into arrays by
+         * node, with the light edges of each node before its heavy ones.
+         * The search doesn't see nodes or edges inserted later, and the
+         * graph must not change while it runs. As in _ParallelSearch there's
+         * no pool: the threads are created by each run () (the caller is one
+         * of them), wait at a gate until the barrier counts those that
+         * started, and are joined when it ends.
+         *
+         * The distances and previous nodes are those of _DijkstraIterator
+         * (see info). Where there are many shortest paths to a node, the
+         * previous node is the one of the first path found, so it may
+         * change from one run to the next. Edge values can't be negative.
+         */
+
+        template<typename _TpVertex, typename _TpEdge>
+          class _DeltaStepping
+          {
+            private:
+              typedef _DeltaStepping<_TpVertex, _TpEdge>    _Self;
+              typedef _GraphNode<_TpVertex, _TpEdge>        _Node;
+              typedef _GraphAdjList<_TpVertex, _TpEdge>     _AdjList;
+              typedef typename _AdjList::const_iterator     _AdjCIterator;
+
+            public:
+              typedef cgt::shortpath::single::dijkstra::_DijkstraInfo<_TpVertex, _TpEdge>  _Info;
+
+            private:
+              /** the number of nodes of a bucket a thread takes at a time */
+              static const size_t _CHUNK = 64;
+
+              /** the greatest number of buckets in the ring of a thread */
+              static const size_t _RING = 1024;
+
+              struct _Task
+              {
+                _Self*  _search;
+                size_t  _index;
+              };
+
+            public:
+              static const size_t npos = static_cast<size_t>(-1);
+
+            public:
+              /*
+               * With \b _threads == 0, there's a thread per processor; with
+               * \b _delta == 0, it's the greatest edge value divided by the
+               * average number of edges of a node.
+               */
+              template<typename _TpNodeIterator>
+                _DeltaStepping (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const size_t& _threads, const _TpEdge& _delta);
+
+            public:
+              /** finds the distances from \b _source to all nodes */
+              void run (const _Node& _source);
+
+            public:
+              /** the distance and the previous node of \b _node, as given by the dijkstra iterator */
+              _Info info (const _Node& _node) const;
+
+              const bool reached (const _Node& _node) const { return _reached [_node.id ()]; }
+
+              /** the distance of \b _node (meaningless if it wasn't reached) */
+              const _TpEdge& distance (const _Node& _node) const { return _dist [_node.id ()]; }
+
+              /** the previous node of \b _node in a shortest path, or NULL if it's the source or wasn't reached */
+              const _Node* previous (const _Node& _node) const { return (_prev [_node.id ()] == npos ? NULL : _nodes [_prev [_node.id ()]]); }
+
+              /** the number of nodes reached by the last search */
+              size_t size () const { return _count; }
+              size_t num_threads () const { return _buckets.size (); }
+              const _TpEdge& delta () const { return _delta; }
+
+            private:
+              static void* _run_thread (void* _ptr);
+              void _work (const size_t& _index);
+
+              /** opens the gate to the threads created, once the barrier counts them */
+              void _open_gate ();
+              void _wait_gate ();
+
+              size_t _bucket_of (const _TpEdge& _d) const { return static_cast<size_t>(_d / _delta); }
+
+              /** the slot of bucket \b _b in the ring of buckets of each thread */
+              size_t _slot_of (const size_t& _b) const { return _b % _slots; }
+
+              /** puts the node \b _v, with distance \b _d, in the ring or the overflow list of thread \b _index */
+              void _push (const size_t& _index, const size_t& _v, const _TpEdge& _d);
+
+              /** moves the nodes of the overflow list of thread \b _index that are now within the ring to it */
+              void _unload_overflow (const size_t& _index);
+
+              /** lowers the distance of the node \b _v to \b _d through \b _u, and puts it in a bucket of thread \b _index */
+              void _relax (const size_t& _index, const size_t& _u, const size_t& _v, const _TpEdge& _d);
+
+              void _lock (const size_t& _v);
+              void _unlock (const size_t& _v);
+
+              /** reads the distance of the node \b _v while other threads may lower it */
+              _TpEdge _load_distance (const size_t& _v);
+
+            private:
+              cgt::base::array<_Node*>    _nodes;     /** < the nodes, by id */
+              cgt::base::array<size_t>    _edges;     /** < node id -> where its edges begin in _targets (and its end, in the next one) */
+              cgt::base::array<size_t>    _heavy;     /** < node id -> where its heavy edges begin in _targets */
+              cgt::base::array<size_t>    _targets;   /** < the ids of the nodes the edges go to */
+              cgt::base::array<_TpEdge>   _values;    /** < the values of the edges */
+              _TpEdge                     _delta;
+              size_t                      _slots;     /** < the number of slots of the ring of buckets of each thread */
+
+              cgt::base::array<_TpEdge>   _dist;
+              cgt::base::array<size_t>    _prev;      /** < node id -> the id of its previous node (npos if there's none) */
+              cgt::base::array<char>      _reached;
+              cgt::base::array<char>      _taken;     /** < node id -> if a thread took it (and will relax its heavy edges) */
+              cgt::base::array<char>      _locks;
+
+              cgt::base::array<cgt::base::array<cgt::base::array<size_t> > > _buckets;  /** < the ring of buckets of each thread */
+              cgt::base::array<cgt::base::array<size_t> >                     _overflow; /** < the nodes of each thread in buckets beyond the ring */
+              cgt::base::array<size_t>    _overflow_min;  /** < the lowest bucket in the overflow list of each thread (npos if it's empty) */
+              cgt::base::array<cgt::base::array<size_t> >                     _taken_by; /** < the nodes taken by each thread in the current bucket */
+              cgt::base::array<size_t>    _phase;     /** < the nodes of the current phase */
+              cgt::base::array<size_t>    _offsets;   /** < where the current bucket of each thread goes in _phase */
+
+              pthread_barrier_t _barrier;
+#ifndef __GNUC__
+              pthread_mutex_t   _mutex;
+#endif
+              pthread_mutex_t   _gate;
+              pthread_cond_t    _open;
+              bool              _opened;    /** < if the threads created can start */
+              size_t            _cursor;    /** < the next chunk of _phase */
+              size_t            _current;   /** < the current bucket (npos when there are no more) */
+              size_t            _count;
+          };
+
+        template<typename _TpVertex, typename _TpEdge>
+          const size_t _DeltaStepping<_TpVertex, _TpEdge>::_CHUNK;
+
+        template<typename _TpVertex, typename _TpEdge>
+          const size_t _DeltaStepping<_TpVertex, _TpEdge>::_RING;
+
+        template<typename _TpVertex, typename _TpEdge>
+          const size_t _DeltaStepping<_TpVertex, _TpEdge>::npos;
+
+        template<typename _TpVertex, typename _TpEdge>
+          template<typename _TpNodeIterator>
+            _DeltaStepping<_TpVertex, _TpEdge>::_DeltaStepping (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const size_t& _threads, const _TpEdge& _delta)
+            : _delta (_delta), _cursor (0), _current (npos), _count (0)
+            {
+              for (_TpNodeIterator _it = _it_begin; _it != _it_end; ++_it)
+              {
+                if (_it->id () >= _nodes.size ())
+                  _nodes.resize (_it->id () + 1, NULL);
+
+                _nodes [_it->id ()] = const_cast<_Node*>(&(*_it));
+              }
+
+              size_t _n = _nodes.size ();
+              size_t _m = 0;
+              _TpEdge _max = _TpEdge ();
+
+              for (size_t i = 0; i < _n; i++)
+              {
+                if (_nodes [i])
+                {
+                  _AdjCIterator _itEnd = _nodes [i]->adjlist ().end ();
+
+                  for (_AdjCIterator _it = _nodes [i]->adjlist ().begin (); _it != _itEnd; ++_it, _m++)
+                    if (_max < _it->edge ().value ())
+                      _max = _it->edge ().value ();
+                }
+              }
+
+              if (! (_TpEdge () < this->_delta))
+              {
+                /* the default delta: the greatest value over the average number of edges of a node */
+
+                this->_delta = (_m > _n ? _max / static_cast<_TpEdge>(_m / _n) : _max);
+
+                if (! (_TpEdge () < this->_delta))
+                  this->_delta = (_TpEdge () < _max ? _max : static_cast<_TpEdge>(1));
+              }
+
+              /*
+               * a relaxation from bucket b reaches up to bucket b + ceil (max / delta):
+               * the ring has a slot for each of them, up to _RING
+               */
+
+              _slots = 2;
+
+              for (_TpEdge _span = this->_delta; _slots < _RING && _span < _max; _span += this->_delta)
+                _slots++;
+
+              _edges.reserve (_n + 1);
+              _heavy.reserve (_n);
+              _targets.reserve (_m);
+              _values.reserve (_m);
+
+              for (size_t i = 0; i < _n; i++)
+              {
+                _edges.push_back (_targets.size ());
+
+                if (! _nodes [i])
+                {
+                  _heavy.push_back (_targets.size ());
+                  continue;
+                }
+
+                /* the light edges first, then the heavy ones */
+
+                const _AdjList& _adj = _nodes [i]->adjlist ();
+                _AdjCIterator _itEnd = _adj.end ();
+
+                for (_AdjCIterator _it = _adj.begin (); _it != _itEnd; ++_it)
+                {
+                  if (! (this->_delta < _it->edge ().value ()))
+                  {
+                    _targets.push_back (_it->node ().id ());
+                    _values.push_back (_it->edge ().value ());
+                  }
+                }
+
+                _heavy.push_back (_targets.size ());
+
+                for (_AdjCIterator _it = _adj.begin (); _it != _itEnd; ++_it)
+                {
+                  if (this->_delta < _it->edge ().value ())
+                  {
+                    _targets.push_back (_it->node ().id ());
+                    _values.push_back (_it->edge ().value ());
+                  }
+                }
+              }
+
+              _edges.push_back (_targets.size ());
+
+              size_t _t = _threads;
+
+              if (! _t)
+              {
+                long _cpus = sysconf (_SC_NPROCESSORS_ONLN);
+                _t = (_cpus > 0 ? static_cast<size_t>(_cpus) : 1);
+              }
+
+              _dist.resize (_n, _TpEdge ());
+              _prev.resize (_n, npos);
+              _reached.resize (_n, 0);
+              _taken.resize (_n, 0);
+              _locks.resize (_n, 0);
+              _buckets.resize (_t);
+
+              for (size_t t = 0; t < _t; t++)
+                _buckets [t].resize (_slots);
+
+              _overflow.resize (_t);
+              _overflow_min.resize (_t, npos);
+              _taken_by.resize (_t);
+              _offsets.resize (_t, 0);
+            }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DeltaStepping<_TpVertex, _TpEdge>::run (const _Node& _source)
+          {
+            size_t _n = _nodes.size ();
+            size_t _t = _buckets.size ();
+
+            for (size_t i = 0; i < _n; i++)
+            {
+              _prev [i] = npos;
+              _reached [i] = 0;
+              _taken [i] = 0;
+            }
+
+            for (size_t t = 0; t < _t; t++)
+            {
+              for (size_t b = 0; b < _slots; b++)
+                _buckets [t][b].clear ();
+
+              _overflow [t].clear ();
+              _overflow_min [t] = npos;
+
+              _taken_by [t].clear ();
+            }
+
+            _dist [_source.id ()] = _TpEdge ();
+            _reached [_source.id ()] = 1;
+
+            _buckets [0][0].push_back (_source.id ());
+            _current = 0;
+            _cursor = 0;
+
+#ifndef __GNUC__
+            pthread_mutex_init (&_mutex, NULL);
+#endif
+            pthread_mutex_init (&_gate, NULL);
+            pthread_cond_init (&_open, NULL);
+            _opened = false;
+
+            cgt::base::array<_Task> _tasks (_t);
+            cgt::base::array<pthread_t> _ids (_t);
+            size_t _started = 1;
+
+            for (; _started < _t; _started++)
+            {
+              _tasks [_started]._search = this;
+              _tasks [_started]._index = _started;
+
+              if (pthread_create (&(_ids [_started]), NULL, _run_thread, &(_tasks [_started])) != 0)
+                break;
+            }
+
+            /* the buckets of the threads that couldn't be created stay empty */
+
+            pthread_barrier_init (&_barrier, NULL, _started);
+            _open_gate ();
+
+            _work (0);
+
+            for (size_t i = 1; i < _started; i++)
+              pthread_join (_ids [i], NULL);
+
+            pthread_cond_destroy (&_open);
+            pthread_mutex_destroy (&_gate);
+#ifndef __GNUC__
+            pthread_mutex_destroy (&_mutex);
+#endif
+            pthread_barrier_destroy (&_barrier);
+
+            _count = 0;
+
+            for (size_t i = 0; i < _n; i++)
+              if (_reached [i])
+                _count++;
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void* _DeltaStepping<_TpVertex, _TpEdge>::_run_thread (void* _ptr)
+          {
+            _Task* _task = static_cast<_Task*>(_ptr);
+            _task->_search->_wait_gate ();
+            _task->_search->_work (_task->_index);
+
+            return NULL;
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DeltaStepping<_TpVertex, _TpEdge>::_open_gate ()
+          {
+            pthread_mutex_lock (&_gate);
+            _opened = true;
+            pthread_cond_broadcast (&_open);
+            pthread_mutex_unlock (&_gate);
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DeltaStepping<_TpVertex, _TpEdge>::_wait_gate ()
+          {
+            pthread_mutex_lock (&_gate);
+
+            while (! _opened)
+              pthread_cond_wait (&_open, &_gate);
+
+            pthread_mutex_unlock (&_gate);
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          cgt::shortpath::single::dijkstra::_DijkstraInfo<_TpVertex, _TpEdge> _DeltaStepping<_TpVertex, _TpEdge>::info (const _Node& _node) const
+          {
+            _Info _info (*(_nodes [_node.id ()]));
+
+            if (_reached [_node.id ()])
+            {
+              _info._set_distance (_dist [_node.id ()]);
+              _info._set_previous (previous (_node));
+            }
+
+            return _info;
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DeltaStepping<_TpVertex, _TpEdge>::_lock (const size_t& _v)
+          {
+#ifdef __GNUC__
+            while (__sync_lock_test_and_set (&(_locks [_v]), 1))
+#ifdef __ATOMIC_RELAXED
+              while (__atomic_load_n (&(_locks [_v]), __ATOMIC_RELAXED))
+#endif
+                ;
+#else
+            pthread_mutex_lock (&_mutex);
+#endif
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DeltaStepping<_TpVertex, _TpEdge>::_unlock (const size_t& _v)
+          {
+#ifdef __GNUC__
+            __sync_lock_release (&(_locks [_v]));
+#else
+            pthread_mutex_unlock (&_mutex);
+#endif
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          _TpEdge _DeltaStepping<_TpVertex, _TpEdge>::_load_distance (const size_t& _v)
+          {
+            _TpEdge _d;
+
+#ifdef __ATOMIC_RELAXED
+            __atomic_load (&(_dist [_v]), &_d, __ATOMIC_RELAXED);
+#else
+            _lock (_v);
+            _d = _dist [_v];
+            _unlock (_v);
+#endif
+
+            return _d;
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DeltaStepping<_TpVertex, _TpEdge>::_relax (const size_t& _index, const size_t& _u, const size_t& _v, const _TpEdge& _d)
+          {
+#ifdef __ATOMIC_RELAXED
+            /* an unlocked read first: most edges don't lower the distance */
+
+            if (__atomic_load_n (&(_reached [_v]), __ATOMIC_RELAXED) && ! (_d < _load_distance (_v)))
+              return;
+#endif
+
+            bool _lowered = false;
+
+            _lock (_v);
+
+            if (! _reached [_v] || _d < _dist [_v])
+            {
+#ifdef __ATOMIC_RELAXED
+              __atomic_store (&(_dist [_v]), const_cast<_TpEdge*>(&_d), __ATOMIC_RELAXED);
+              __atomic_store_n (&(_reached [_v]), 1, __ATOMIC_RELAXED);
+#else
+              _dist [_v] = _d;
+              _reached [_v] = 1;
+#endif
+              _prev [_v] = _u;
+              _lowered = true;
+            }
+
+            _unlock (_v);
+
+            if (_lowered)
+            {
+              _push (_index, _v, _d);
+            }
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DeltaStepping<_TpVertex, _TpEdge>::_push (const size_t& _index, const size_t& _v, const _TpEdge& _d)
+          {
+            size_t _b = _bucket_of (_d);
+
+            if (_b < _current + _slots)
+              _buckets [_index][_slot_of (_b)].push_back (_v);
+            else
+            {
+              _overflow [_index].push_back (_v);
+
+              if (_b < _overflow_min [_index])
+                _overflow_min [_index] = _b;
+            }
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DeltaStepping<_TpVertex, _TpEdge>::_unload_overflow (const size_t& _index)
+          {
+            /*
+             * only the first thread calls it, between barriers: the bucket of
+             * a node is taken from its distance now, that may be lower than
+             * when it was put here (then it's in a bucket already, and this
+             * is a copy that will be skipped, or dropped if it's behind)
+             */
+
+            cgt::base::array<size_t>& _list = _overflow [_index];
+            size_t _kept = 0;
+
+            _overflow_min [_index] = npos;
+
+            for (size_t i = 0; i < _list.size (); i++)
+            {
+              const size_t _v = _list [i];
+              size_t _b = _bucket_of (_dist [_v]);
+
+              if (_b < _current)
+                continue;
+
+              if (_b < _current + _slots)
+                _buckets [_index][_slot_of (_b)].push_back (_v);
+              else
+              {
+                _list [_kept++] = _v;
+
+                if (_b < _overflow_min [_index])
+                  _overflow_min [_index] = _b;
+              }
+            }
+
+            _list.resize (_kept, 0);
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DeltaStepping<_TpVertex, _TpEdge>::_work (const size_t& _index)
+          {
+            cgt::base::array<cgt::base::array<size_t> >& _own = _buckets [_index];
+            cgt::base::array<size_t>& _taken_here = _taken_by [_index];
+
+            while (_current != npos)
+            {
+              const size_t _b = _current;
+              const size_t _s = _slot_of (_b);
+
+              for (;;)
+              {
+                pthread_barrier_wait (&_barrier);
+
+                /* the first thread finds the place of each bucket in the nodes of the phase */
+
+                if (_index == 0)
+                {
+                  size_t _total = 0;
+
+                  for (size_t t = 0; t < _buckets.size (); t++)
+                  {
+                    _offsets [t] = _total;
+                    _total += _buckets [t][_s].size ();
+                  }
+
+                  _phase.resize (_total, 0);
+                  _cursor = 0;
+                }
+
+                pthread_barrier_wait (&_barrier);
+
+                if (_phase.empty ())
+                  break;
+
+                for (size_t i = 0; i < _own [_s].size (); i++)
+                  _phase [_offsets [_index] + i] = _own [_s][i];
+
+                _own [_s].clear ();
+
+                pthread_barrier_wait (&_barrier);
+
+                /* relaxes the light edges of the nodes still in this bucket */
+
+                size_t _begin;
+                size_t _size = _phase.size ();
+
+#ifdef __GNUC__
+                while ((_begin = __sync_fetch_and_add (&_cursor, _CHUNK)) < _size)
+#else
+                for (;;)
+#endif
+                {
+#ifndef __GNUC__
+                  pthread_mutex_lock (&_mutex);
+                  _begin = _cursor;
+                  _cursor += _CHUNK;
+                  pthread_mutex_unlock (&_mutex);
+
+                  if (_begin >= _size)
+                    break;
+#endif
+                  size_t _end = (_begin + _CHUNK < _size ? _begin + _CHUNK : _size);
+
+                  for (size_t i = _begin; i < _end; i++)
+                  {
+                    const size_t _u = _phase [i];
+
+                    _TpEdge _d = _load_distance (_u);
+
+                    /* moved to an earlier bucket and taken there, or put here more than once */
+
+                    if (_bucket_of (_d) != _b)
+                      continue;
+
+#ifdef __GNUC__
+                    if (! __sync_lock_test_and_set (&(_taken [_u]), 1))
+#else
+                    pthread_mutex_lock (&_mutex);
+                    char _was = _taken [_u];
+                    _taken [_u] = 1;
+                    pthread_mutex_unlock (&_mutex);
+
+                    if (! _was)
+#endif
+                      _taken_here.push_back (_u);
+
+                    for (size_t e = _edges [_u]; e < _heavy [_u]; e++)
+                      _relax (_index, _u, _targets [e], _d + _values [e]);
+                  }
+                }
+              }
+
+              /* the distances of the nodes taken are final: relaxes their heavy edges */
+
+              for (size_t i = 0; i < _taken_here.size (); i++)
+              {
+                const size_t& _u = _taken_here [i];
+
+                for (size_t e = _heavy [_u]; e < _edges [_u + 1]; e++)
+                  _relax (_index, _u, _targets [e], _dist [_u] + _values [e]);
+              }
+
+              _taken_here.clear ();
+
+              pthread_barrier_wait (&_barrier);
+
+              /*
+               * the first thread finds the next bucket with a node in any
+               * thread: in the ring, within a turn from _b, or in an
+               * overflow list, whose nodes then go to the ring if it
+               * reaches them
+               */
+
+              if (_index == 0)
+              {
+                size_t _next = npos;
+
+                for (size_t b = _b + 1; b < _b + _slots && _next == npos; b++)
+                  for (size_t t = 0; t < _buckets.size () && _next == npos; t++)
+                    if (! _buckets [t][_slot_of (b)].empty ())
+                      _next = b;
+
+                for (size_t t = 0; t < _buckets.size (); t++)
+                  if (_overflow_min [t] < _next)
+                    _next = _overflow_min [t];
+
+                _current = _next;
+
+                if (_current != npos)
+                  for (size_t t = 0; t < _buckets.size (); t++)
+                    if (_overflow_min [t] < _current + _slots)
+                      _unload_overflow (t);
+              }
+
+              pthread_barrier_wait (&_barrier);
+            }
+          }
+      }
+    }
+  }
+}
+
+#endif // __CGTL__CGT_SHORTPATH_SINGLE_DELTASTEP_DELTA_STEPPING_H_
@@ -71,7 +71,7 @@ namespace cgt
 			  _Self& operator=(const _Self& _s);
 
             public:
-              const bool operator==(const _DijkstraInfo& _d) const { return (_node.vertex () == _d._node.vertex ()); }
+              const bool operator==(const _DijkstraInfo& _d) const { return (&_node == &(_d._node)); }
               const bool operator!=(const _DijkstraInfo& _d) const { return ! (*this == _d); }
               const bool operator<(const _DijkstraInfo& _d) const { return (! inf_distance () && (_d.inf_distance () || distance () < _d.distance ())); }
               const bool operator<=(const _DijkstraInfo& _d) const { return (! inf_distance () && (_d.inf_distance () || distance () <= _d.distance ())); }
@@ -35,7 +35,8 @@
 
 #include "cgt/shortpath/single/dijkstra/dijkstra_info.h"
 #include "cgt/graph_node.h"
-#include "cgt/base/heap.h"
+#include "cgt/base/array.h"
+#include "cgt/shortpath/single/dijkstra/dijkstra_queue.h"
 
 
 namespace cgt
@@ -54,53 +55,97 @@ namespace cgt
 				 *
 				 * The heap used by Dijkstra Algorithm to get the closest node
 				 * on each iteration.
+				 *
+				 * The infos of the nodes not visited are kept in an array, with a
+				 * table from node ids to their positions, and the positions of the
+				 * infos with a finite distance are kept in a cgt::base::indexed_heap
+				 * by distance (or another queue, see _DijkstraQueue). So get_by_node
+				 * is \b O(1), and relax, that lowers the distance of a node in place,
+				 * and pop are \b O(log V): Dijkstra runs in <b>O((V + E) log V)</b>.
+				 * Infos with infinite distance aren't in the heap until they're
+				 * relaxed.
 				 */
 
 				template<typename _TpVertex, typename _TpEdge>
-					class _DijkstraInfoHeap : public cgt::base::heap<_DijkstraInfo<_TpVertex, _TpEdge> >
+					class _DijkstraInfoHeap
 				{
 					private:
 						typedef _DijkstraInfo<_TpVertex, _TpEdge>     _Info;
-						typedef cgt::base::heap<_Info>                _Base;
 						typedef _DijkstraInfoHeap<_TpVertex, _TpEdge> _Self;
+						typedef typename _DijkstraQueue<_TpEdge>::_Type _Heap;
 
 					private:
 						typedef _GraphNode<_TpVertex, _TpEdge>  _Node;
 						typedef _GraphEdge<_TpVertex, _TpEdge>  _Edge;
-						typedef typename _Base::const_iterator  _ConstIterator;
 
 					public:
-						static void _set_previous (_Info& _info, const _Node* const _previous) { _info._set_previous (_previous); }
-						static void _set_distance (_Info& _info, const _TpEdge& _distance) { _info._set_distance (_distance); }
+						/** adds the info of a node not visited yet */
+						void push (const _Info& _info);
 
-					private:
-						static const bool _has_node (const _Info& _info, const _Node& _node) { return (_info.node ().vertex () == _node.vertex ()); }
+						/** removes the closest node from the heap, and returns its info (valid while the heap exists) */
+						_Info* pop ();
+
+						/** true if no node not visited was reached */
+						const bool empty () const { return _heap.empty (); }
 
 					public:
-						_ConstIterator get_by_node (const _Node* const _ptr_node);
-						_ConstIterator get_closest () { return _Base::begin (); }
+						const _Info* get_by_node (const _Node* const _ptr_node) const;
+						const _Info* get_closest () { return &(_infos [_heap.top ()]); }
 						void relax (const _Node* const _ptr_node, const _TpEdge& _distance, const _Edge& _edge, _Node* const _ptr_prev);
+
+					private:
+						cgt::base::array<_Info>   _infos; /** < the infos, in the order they were pushed */
+						cgt::base::array<size_t>  _slots; /** < node id -> the position of its info in _infos (npos once it's popped) */
+						_Heap                     _heap;  /** < the positions of the infos with a finite distance */
 				};
 
 				template<typename _TpVertex, typename _TpEdge>
-					typename _DijkstraInfoHeap<_TpVertex, _TpEdge>::_ConstIterator _DijkstraInfoHeap<_TpVertex, _TpEdge>::get_by_node (const _Node* const _ptr_node)
+					void _DijkstraInfoHeap<_TpVertex, _TpEdge>::push (const _Info& _info)
+					{
+						size_t _id = _info.node ().id ();
+
+						if (_id >= _slots.size ())
+							_slots.resize (_id + 1, _Heap::npos);
+
+						_slots [_id] = _infos.size ();
+						_infos.push_back (_info);
+
+						if (! _info.inf_distance ())
+							_heap.push (_slots [_id], _info.distance ());
+					}
+
+				template<typename _TpVertex, typename _TpEdge>
+					_DijkstraInfo<_TpVertex, _TpEdge>* _DijkstraInfoHeap<_TpVertex, _TpEdge>::pop ()
 					{
-						return find_if (_Base::begin (), _Base::end (), _has_node, *_ptr_node);
+						_Info* _ptr = &(_infos [_heap.pop ()]);
+						_slots [_ptr->node ().id ()] = _Heap::npos;
+
+						return _ptr;
+					}
+
+				template<typename _TpVertex, typename _TpEdge>
+					const _DijkstraInfo<_TpVertex, _TpEdge>* _DijkstraInfoHeap<_TpVertex, _TpEdge>::get_by_node (const _Node* const _ptr_node) const
+					{
+						size_t _id = _ptr_node->id ();
+
+						return (_id < _slots.size () && _slots [_id] != _Heap::npos ? &(_infos [_slots [_id]]) : NULL);
 					}
 
 				template<typename _TpVertex, typename _TpEdge>
 					void _DijkstraInfoHeap<_TpVertex, _TpEdge>::relax (const _Node* const _ptr_node, const _TpEdge& _distance, const _Edge& _edge, _Node* const _ptr_prev)
 					{
-						_ConstIterator it = get_by_node (_ptr_node);
+						size_t _id = _ptr_node->id ();
 
-						if (it != static_cast<const _Self*> (this)->_Base::end ())
+						if (_id < _slots.size () && _slots [_id] != _Heap::npos)
 						{
+							_Info& _info = _infos [_slots [_id]];
 							_TpEdge _new_distance = _distance + _edge.value ();
 
-							if (it->inf_distance () || it->distance () > _new_distance)
+							if (_info.inf_distance () || _info.distance () > _new_distance)
 							{
-								_Base::modify_by (it, _set_distance, _new_distance);
-								_Base::modify_by (it, _set_previous, _ptr_prev);
+								_info._set_distance (_new_distance);
+								_info._set_previous (_ptr_prev);
+								_heap.push_or_decrease (_slots [_id], _new_distance);
 							}
 						}
 					}
@@ -35,6 +35,7 @@
 
 #include "cgt/graph_node.h"
 #include "cgt/shortpath/single/dijkstra/dijkstra_info.h"
+#include "cgt/base/array.h"
 
 #ifdef CGTL_DO_NOT_USE_STL
 #include "cgt/base/list.h"
@@ -70,6 +71,9 @@ namespace cgt
          * The list used by Dijkstra Algorithm to keep the nodes already taken.
          * This is also the list of dijkstra infos that can be obtained after
          * the algorithm finish.
+         *
+         * Besides the list, it keeps a table from node ids to infos, so
+         * get_by_node is O(1). Infos must be inserted with _insert ().
          */
 
         template<typename _TpVertex, typename _TpEdge>
@@ -93,19 +97,69 @@ namespace cgt
             typedef _GraphEdge<_TpVertex, _TpEdge>    _Edge;
             typedef typename _Base::iterator          _Iterator;
 
+          public:
+            _DijkstraInfoList () { }
+            _DijkstraInfoList (const _Self& _l) : _Base (_l) { _build_table (); }
+
+          public:
+            _Self& operator=(const _Self& _l)
+            {
+              _Base::operator=(_l);
+              _build_table ();
+
+              return *this;
+            }
+
           private:
-            static const bool _has_node (const _Info& _info, const _Node& _node) { return (_info.node ().vertex () == _node.vertex ()); }
+            void _build_table ();
 
           public:
-            _Iterator get_by_node (const _Node* const _ptr_node);
+            void _insert (const _Info& _info);
+            _Info* get_by_node (const _Node* const _ptr_node) const;
             //_Iterator get_closest ();
             //void relax (const _Node* const _ptr_node, const _TpEdge& _distance, const _Edge& _edge, _Node* const _ptr_prev);
+
+          private:
+            cgt::base::array<_Info*> _table; /** < node id -> info (NULL if the node isn't in the list) */
         };
 
         template<typename _TpVertex, typename _TpEdge>
-          typename _DijkstraInfoList<_TpVertex, _TpEdge>::_Iterator _DijkstraInfoList<_TpVertex, _TpEdge>::get_by_node (const _Node* const _ptr_node)
+          void _DijkstraInfoList<_TpVertex, _TpEdge>::_build_table ()
+          {
+            _table.clear ();
+
+            _Iterator _itEnd = _Base::end ();
+
+            for (_Iterator _it = _Base::begin (); _it != _itEnd; ++_it)
+            {
+              size_t _id = _it->node ().id ();
+
+              if (_id >= _table.size ())
+                _table.resize (_id + 1, NULL);
+
+              _table [_id] = &(*_it);
+            }
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DijkstraInfoList<_TpVertex, _TpEdge>::_insert (const _Info& _info)
+          {
+            _Base::push_back (_info);
+
+            size_t _id = _info.node ().id ();
+
+            if (_id >= _table.size ())
+              _table.resize (_id + 1, NULL);
+
+            _table [_id] = &(_Base::back ());
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          _DijkstraInfo<_TpVertex, _TpEdge>* _DijkstraInfoList<_TpVertex, _TpEdge>::get_by_node (const _Node* const _ptr_node) const
           {
-            return find_if (_Base::begin (), _Base::end (), _has_node, *_ptr_node);
+            size_t _id = _ptr_node->id ();
+
+            return (_id < _table.size () ? _table [_id] : NULL);
           }
 
 		/*
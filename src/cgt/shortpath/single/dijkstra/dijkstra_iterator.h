@@ -36,6 +36,7 @@
 //#include "cgt/shortpath/single/dijkstra/dijkstra_info.h"
 #include "cgt/shortpath/single/dijkstra/dijkstra_info_list.h"
 #include "cgt/shortpath/single/dijkstra/dijkstra_info_heap.h"
+#include "cgt/base/shared.h"
 
 namespace cgt
 {
@@ -67,25 +68,19 @@ namespace cgt
 			namespace dijkstra
 			{
 				/*!
-				 * \class _DijkstraIterator
-				 * \brief An iterator that implements dijkstra algorithm.
+				 * \class _DijkstraEngine
+				 * \brief The state of Dijkstra algorithm, shared by the copies of its iterator.
 				 * \author Leandro Costa
 				 * \date 2009
 				 *
-				 * This iterator executes Dijkstra Algorithm and returns nodes
-				 * in the order found by the algorithm.
+				 * It keeps the list of visited nodes and the heap of the nodes not
+				 * visited yet, and returns the nodes one at a time (see _next), for
+				 * _DijkstraIterator.
 				 */
 
-				template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
-					class _DijkstraIterator
+				template<typename _TpVertex, typename _TpEdge>
+					class _DijkstraEngine
 					{
-						private:
-							friend class _DijkstraIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpConst>;
-
-						private:
-							typedef _DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>  _Self;
-							typedef _DijkstraIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpCommon>    _SelfCommon;
-
 						public:
 							typedef _DijkstraInfo<_TpVertex, _TpEdge>     _Info;
 
@@ -104,52 +99,37 @@ namespace cgt
 							typedef typename _AdjList::const_iterator     _AdjListIterator;
 
 						public:
-							_DijkstraIterator () { }
 							/*
-							 * The constructors need to insert all nodes (except _ptr_n) in _notVisitedInfoHeap with distance == infinite,
-							 * and after that, calculate distance for the nodes from adjacency list of _ptr_n.
+							 * The constructor inserts all nodes (except _ptr_n) in _notVisitedInfoHeap with distance == infinite,
+							 * and after that, calculates distance for the nodes from adjacency list of _ptr_n.
 							 */
-							_DijkstraIterator (_Node* const _ptr_n) : _ptr_node (_ptr_n) { }
-							_DijkstraIterator (_Node* const _ptr_n, const _NodeIterator& _it_begin, const _NodeIterator& _it_end) : _ptr_node (_ptr_n), _it_node (_it_begin), _it_node_end (_it_end)
-						{
-							if (_ptr_node)
-								_init ();
-						}
-							_DijkstraIterator (const _NodeIterator& _it, const _NodeIterator& _it_begin, const _NodeIterator& _it_end) : _ptr_node (&(*_it)), _it_node (_it_begin), _it_node_end (_it_end)
-						{
-							if (_ptr_node)
-								_init ();
-						}
-							_DijkstraIterator (const _SelfCommon& _it) : _ptr_node ( _it._ptr_node), _it_node (_it._it_node), _it_node_end (_it._it_node_end), _infoList (_it._infoList), _notVisitedInfoHeap (_it._notVisitedInfoHeap) { }
+							_DijkstraEngine (_Node* const _ptr_n, const _NodeIterator& _it_begin, const _NodeIterator& _it_end) : _it_node (_it_begin), _it_node_end (_it_end) { _init (_ptr_n); }
 
 						private:
-							void _init ();
-							const _Info* const _get_info_by_node (const _Node* const _ptr_node);
+							_DijkstraEngine (const _DijkstraEngine&);
+							_DijkstraEngine& operator=(const _DijkstraEngine&);
 
-						public:
-							_Node& operator*() const;
-							_Node* operator->() const;
-							const bool operator==(const _Self& _other) const;
-							const bool operator!=(const _Self& _other) const;
-							_Self& operator++();
+						private:
+							void _init (_Node* const _ptr_node);
 
 						public:
-							const _Info* const info (const _Node* const _ptr_node) { return _get_info_by_node (_ptr_node); }
-							const _Info* const info (const _Node& _node) { return _get_info_by_node (&_node); }
+							/** visits the closest node not visited yet, and returns it (NULL when there are no more) */
+							_Node* _next ();
 
-							_InfoIterator info_begin () { return _infoList.begin (); }
-							_InfoIterator info_end () { return _infoList.end (); }
+							const _Info* const _get_info_by_node (const _Node* const _ptr_node);
+
+							_InfoIterator _info_begin () { return _infoList.begin (); }
+							_InfoIterator _info_end () { return _infoList.end (); }
 
 						private:
-							_Node*        _ptr_node;
 							_NodeIterator _it_node;
 							_NodeIterator _it_node_end;
 							_InfoList     _infoList;
 							_InfoHeap     _notVisitedInfoHeap;
 					};
 
-				template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-					void _DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>::_init ()
+				template<typename _TpVertex, typename _TpEdge>
+					void _DijkstraEngine<_TpVertex, _TpEdge>::_init (_Node* const _ptr_node)
 					{
 						/*
 						 * Insert all nodes (except _ptr_node) in _notVisitedInfoHeap with distance == infinite,
@@ -162,7 +142,7 @@ namespace cgt
 							{
 								_Info _info (*it);
 								_info.set_origin ();
-								_infoList.push_back (_info);
+								_infoList._insert (_info);
 							}
 							else
 								_notVisitedInfoHeap.push (_Info (*it));
@@ -176,54 +156,30 @@ namespace cgt
 							_notVisitedInfoHeap.relax (&(itA->node ()), _TpEdge (), itA->edge (), &(_infoList.back ().node ()));
 					}
 
-				template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-					const _DijkstraInfo<_TpVertex, _TpEdge>* const _DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>::_get_info_by_node (const _Node* const _ptr_node)
+				template<typename _TpVertex, typename _TpEdge>
+					const _DijkstraInfo<_TpVertex, _TpEdge>* const _DijkstraEngine<_TpVertex, _TpEdge>::_get_info_by_node (const _Node* const _ptr_node)
 					{
-						const _Info* _ptr = NULL;
-
-						typename _InfoList::const_iterator _it = _infoList.get_by_node (_ptr_node);
-
-						if (_it != _infoList.end ())
-							_ptr = &(*_it);
-						else
-						{
-							typename _InfoHeap::const_iterator _it = _notVisitedInfoHeap.get_by_node (_ptr_node);
-
-							if (_it != _notVisitedInfoHeap.end ())
-								_ptr = &(*_it);
-						}
-
-						return _ptr;
-					}
+						const _Info* _ptr = _infoList.get_by_node (_ptr_node);
 
-				template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-					_GraphNode<_TpVertex, _TpEdge>& _DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>::operator*() const
-					{
-						return *_ptr_node;
+						return (_ptr ? _ptr : _notVisitedInfoHeap.get_by_node (_ptr_node));
 					}
 
-				template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-					_GraphNode<_TpVertex, _TpEdge>* _DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>::operator->() const
-					{
-						return _ptr_node;
-					}
-
-				template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-					_DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>& _DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>::operator++()
+				template<typename _TpVertex, typename _TpEdge>
+					_GraphNode<_TpVertex, _TpEdge>* _DijkstraEngine<_TpVertex, _TpEdge>::_next ()
 					{
 						/*
 						 * Remove the node with lowest distance from _notVisitedInfoHeap
 						 * and recalculate distances for the adjacency list of the chosen node.
 						 */
 
-						_ptr_node = NULL;
+						_Node* _ptr_node = NULL;
 
-						if (! _notVisitedInfoHeap.empty () && ! _notVisitedInfoHeap.get_closest ()->inf_distance ())
+						if (! _notVisitedInfoHeap.empty ())
 						{
 							_Info* _ptr = _notVisitedInfoHeap.pop ();
 
 							_ptr_node = &(_ptr->node ());
-							_infoList.push_back (*_ptr);
+							_infoList._insert (*_ptr);
 
 							const _AdjList &adjList = _ptr_node->adjlist ();
 							_AdjListIterator itA = adjList.begin ();
@@ -233,20 +189,84 @@ namespace cgt
 								_notVisitedInfoHeap.relax (&(itA->node ()), _ptr->distance (), itA->edge(), &(_infoList.back ().node ()));
 						}
 
-						return *this;
+						return _ptr_node;
 					}
 
-				template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-					const bool _DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>::operator==(const _Self& _other) const
-					{
-						return (_ptr_node == _other._ptr_node);
-					}
 
-				template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-					const bool _DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>::operator!=(const _Self& _other) const
+				/*!
+				 * \class _DijkstraIterator
+				 * \brief An iterator that implements dijkstra algorithm.
+				 * \author Leandro Costa
+				 * \date 2009
+				 *
+				 * This iterator executes Dijkstra Algorithm and returns nodes
+				 * in the order found by the algorithm.
+				 *
+				 * The algorithm runs in a _DijkstraEngine shared by the copies of
+				 * the iterator, so copying an iterator is \b O(1); copies share
+				 * the search, and incrementing one of them moves it on for all.
+				 */
+
+				template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
+					class _DijkstraIterator
 					{
-						return !(*this == _other);
-					}
+						private:
+							friend class _DijkstraIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpConst>;
+
+						private:
+							typedef _DijkstraIterator<_TpVertex, _TpEdge, _TpIterator>  _Self;
+							typedef _DijkstraIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpCommon>    _SelfCommon;
+
+						private:
+							typedef _DijkstraEngine<_TpVertex, _TpEdge>   _Engine;
+
+						public:
+							typedef _DijkstraInfo<_TpVertex, _TpEdge>     _Info;
+
+						private:
+							typedef _GraphNode<_TpVertex, _TpEdge>        _Node;
+#ifdef CGTL_DO_NOT_USE_STL
+							typedef typename cgt::base::list<_Node>::iterator        _NodeIterator;
+							typedef typename cgt::base::list<_Info>::iterator        _InfoIterator;
+#else
+							typedef typename std::list<_Node>::iterator        _NodeIterator;
+							typedef typename std::list<_Info>::iterator        _InfoIterator;
+#endif
+
+						public:
+							_DijkstraIterator () : _ptr_node (NULL) { }
+							_DijkstraIterator (_Node* const _ptr_n) : _ptr_node (_ptr_n) { }
+							_DijkstraIterator (_Node* const _ptr_n, const _NodeIterator& _it_begin, const _NodeIterator& _it_end) : _ptr_node (_ptr_n)
+						{
+							if (_ptr_node)
+								_engine = cgt::base::_Shared<_Engine> (new _Engine (_ptr_node, _it_begin, _it_end));
+						}
+							_DijkstraIterator (const _NodeIterator& _it, const _NodeIterator& _it_begin, const _NodeIterator& _it_end) : _ptr_node (&(*_it))
+						{
+							if (_ptr_node)
+								_engine = cgt::base::_Shared<_Engine> (new _Engine (_ptr_node, _it_begin, _it_end));
+						}
+							_DijkstraIterator (const _SelfCommon& _it) : _ptr_node ( _it._ptr_node), _engine (_it._engine) { }
+
+						public:
+							_Node& operator*() const { return *_ptr_node; }
+							_Node* operator->() const { return _ptr_node; }
+							const bool operator==(const _Self& _other) const { return (_ptr_node == _other._ptr_node); }
+							const bool operator!=(const _Self& _other) const { return !(*this == _other); }
+							_Self& operator++() { _ptr_node = _engine->_next (); return *this; }
+							_Self operator++(int) { _Self _it = *this; operator++(); return _it; }
+
+						public:
+							const _Info* const info (const _Node* const _ptr_node) { return _engine->_get_info_by_node (_ptr_node); }
+							const _Info* const info (const _Node& _node) { return _engine->_get_info_by_node (&_node); }
+
+							_InfoIterator info_begin () { return _engine->_info_begin (); }
+							_InfoIterator info_end () { return _engine->_info_end (); }
+
+						private:
+							_Node*                      _ptr_node;
+							cgt::base::_Shared<_Engine> _engine;
+					};
 			}
 		}
 	}
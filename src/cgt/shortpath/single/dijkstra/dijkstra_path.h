@@ -0,0 +1,355 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/shortpath/single/dijkstra/dijkstra_path.h
+ * \brief Contains definition of a Dijkstra search from one node to another, that stops at the target.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SHORTPATH_SINGLE_DIJKSTRA_DIJKSTRA_PATH_H_
+#define __CGTL__CGT_SHORTPATH_SINGLE_DIJKSTRA_DIJKSTRA_PATH_H_
+
+#include "cgt/graph_node.h"
+#include "cgt/graph_adjlist.h"
+#include "cgt/base/array.h"
+#include "cgt/shortpath/single/dijkstra/dijkstra_queue.h"
+
+
+namespace cgt
+{
+  namespace shortpath
+  {
+    namespace single
+    {
+      namespace dijkstra
+      {
+        /*!
+         * \class _DijkstraPath
+         * \brief Finds the distance (and a shortest path) from one node to another with Dijkstra Algorithm.
+         * \author Leandro Costa
+         * \date 2011
+         *
+         * Unlike _DijkstraIterator, that takes all nodes reachable from the
+         * source, run stops as soon as the target is taken (its distance
+         * can't change any more), so only the nodes closer to the source
+         * than the target are taken.
+         *
+         * run_bidirectional grows a second search from the target, over the
+         * inverted adjacency lists (the adjacency lists in undirected
+         * graphs), and takes a node from the side whose closest node is
+         * closer. It keeps the shortest path seen through an edge between
+         * both sides, and stops when the closest nodes of both sides are
+         * farther than that path: each side goes about half the distance,
+         * so in a graph like a road network, where the number of nodes
+         * within a distance grows with its square, about half the nodes are
+         * taken. Directed graphs without inverted lists (see
+         * _DirectedNoInverse) are searched from the source only.
+         *
+         * The state of the nodes (distance and previous node, for each side)
+         * is kept in arrays by id, stamped with the \b epoch of the search
+         * that wrote them (as in _BidirSearch), and the nodes reached but not
+         * taken in a queue for each side (see _DijkstraQueue): a search takes
+         * <b>O(n log n)</b> for the \b n nodes it reaches, and allocates
+         * nothing once the arrays have grown. Edge values can't be negative.
+         */
+
+        template<typename _TpVertex, typename _TpEdge>
+          class _DijkstraPath
+          {
+            private:
+              typedef _GraphNode<_TpVertex, _TpEdge>        _Node;
+              typedef _GraphAdjList<_TpVertex, _TpEdge>     _AdjList;
+              typedef typename _AdjList::const_iterator     _AdjCIterator;
+              typedef typename _DijkstraQueue<_TpEdge>::_Type _Heap;
+
+            private:
+              enum { _FORWARD = 0, _BACKWARD = 1 };
+
+            public:
+              template<typename _TpNodeIterator>
+                _DijkstraPath (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed, const bool& _inverse);
+
+            public:
+              /** searches from \b _source until \b _target is taken: false if it's not reachable */
+              bool run (const _Node& _source, const _Node& _target);
+
+              /** the same as run, with a search from each end */
+              bool run_bidirectional (const _Node& _source, const _Node& _target);
+
+            public:
+              /** true if the last search found a path */
+              const bool found () const { return _found; }
+
+              /** the distance found by the last search (meaningless if found () is false) */
+              const _TpEdge& distance () const { return _distance; }
+
+              /** the nodes of a shortest path, from the source to the target (empty if there's none) */
+              const cgt::base::array<const _Node*>& path () const { return _path; }
+
+              /** the number of nodes taken by the last search, by both sides */
+              size_t settled () const { return _settled; }
+
+            private:
+              void _begin ();
+              bool _is_reached (const size_t& _s, const size_t& _id) const { return (_stamp [_s][_id] == _epoch); }
+              void _reach (const size_t& _s, const _Node& _node, const _TpEdge& _d, const _Node* const _ptr_prev);
+
+              /** takes the closest node of side \b _s, and relaxes its edges (\b _meet: looks for the other side) */
+              void _settle (const size_t& _s, const bool& _meet);
+
+              void _make_path (const _Node* _ptr_forward, const _Node* _ptr_backward);
+
+            private:
+              bool    _directed;
+              bool    _bidirectional;
+
+              cgt::base::array<const _Node*>  _nodes;       /** < id -> node */
+              cgt::base::array<unsigned int>  _stamp [2];   /** < the epoch when each node was reached by each side */
+              cgt::base::array<_TpEdge>       _dist [2];    /** < the distance from the source (or to the target) */
+              cgt::base::array<const _Node*>  _prev [2];    /** < the previous node towards the source (or the target) */
+              _Heap                           _heap [2];
+              unsigned int                    _epoch;
+
+              bool                            _met;         /** < a path between both sides was seen */
+              _TpEdge                         _best;        /** < the shortest one of them */
+              const _Node*                    _ptr_meet [2];
+
+              bool                            _found;
+              _TpEdge                         _distance;
+              cgt::base::array<const _Node*>  _path;
+              size_t                          _settled;
+          };
+
+        template<typename _TpVertex, typename _TpEdge>
+          template<typename _TpNodeIterator>
+            _DijkstraPath<_TpVertex, _TpEdge>::_DijkstraPath (const _TpNodeIterator& _it_begin, const _TpNodeIterator& _it_end, const bool& _directed, const bool& _inverse)
+            : _directed (_directed), _bidirectional (_inverse || ! _directed), _epoch (0), _met (false), _best (), _found (false), _distance (), _settled (0)
+            {
+              size_t _n = 0;
+
+              for (_TpNodeIterator _it = _it_begin; _it != _it_end; ++_it)
+                if (_it->id () >= _n)
+                  _n = _it->id () + 1;
+
+              _nodes.resize (_n, NULL);
+
+              for (_TpNodeIterator _it = _it_begin; _it != _it_end; ++_it)
+                _nodes [_it->id ()] = &(*_it);
+
+              for (int s = _FORWARD; s <= _BACKWARD; s++)
+              {
+                _stamp [s].resize (_n, 0);
+                _dist [s].resize (_n, _TpEdge ());
+                _prev [s].resize (_n, NULL);
+                _heap [s].reserve (_n);
+              }
+            }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DijkstraPath<_TpVertex, _TpEdge>::_begin ()
+          {
+            if (++_epoch == 0)
+            {
+              for (int s = _FORWARD; s <= _BACKWARD; s++)
+                for (size_t i = 0; i < _stamp [s].size (); i++)
+                  _stamp [s][i] = 0;
+
+              _epoch = 1;
+            }
+
+            _heap [_FORWARD].clear ();
+            _heap [_BACKWARD].clear ();
+            _path.clear ();
+            _met = false;
+            _found = false;
+            _distance = _TpEdge ();
+            _settled = 0;
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DijkstraPath<_TpVertex, _TpEdge>::_reach (const size_t& _s, const _Node& _node, const _TpEdge& _d, const _Node* const _ptr_prev)
+          {
+            const size_t& _id = _node.id ();
+
+            if (! _is_reached (_s, _id))
+            {
+              _stamp [_s][_id] = _epoch;
+              _heap [_s].push (_id, _d);
+            }
+            else if (_heap [_s].contains (_id) && _d < _dist [_s][_id])
+              _heap [_s].decrease (_id, _d);
+            else
+              return;
+
+            _dist [_s][_id] = _d;
+            _prev [_s][_id] = _ptr_prev;
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DijkstraPath<_TpVertex, _TpEdge>::_settle (const size_t& _s, const bool& _meet)
+          {
+            const size_t _o = 1 - _s;
+            const _Node* _ptr = _nodes [_heap [_s].pop ()];
+            const _TpEdge& _d = _dist [_s][_ptr->id ()];
+            const _AdjList& _adj = (_s == _BACKWARD && _directed ? _ptr->iadjlist () : _ptr->adjlist ());
+            _AdjCIterator _itEnd = _adj.end ();
+
+            _settled++;
+
+            for (_AdjCIterator _it = _adj.begin (); _it != _itEnd; ++_it)
+            {
+              const _Node& _node = _it->node ();
+              _TpEdge _nd = _d + _it->edge ().value ();
+
+              _reach (_s, _node, _nd, _ptr);
+
+              /* an edge to the other side: a path from the source to the target */
+
+              if (_meet && _is_reached (_o, _node.id ()))
+              {
+                _TpEdge _len = _nd + _dist [_o][_node.id ()];
+
+                if (! _met || _len < _best)
+                {
+                  _met = true;
+                  _best = _len;
+                  _ptr_meet [_s] = _ptr;
+                  _ptr_meet [_o] = &_node;
+                }
+              }
+            }
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          bool _DijkstraPath<_TpVertex, _TpEdge>::run (const _Node& _source, const _Node& _target)
+          {
+            _begin ();
+            _reach (_FORWARD, _source, _TpEdge (), NULL);
+
+            while (! _heap [_FORWARD].empty ())
+            {
+              /* the target is taken with its final distance */
+
+              if (_heap [_FORWARD].top () == _target.id ())
+              {
+                _settled++;
+                _make_path (&_target, NULL);
+                break;
+              }
+
+              _settle (_FORWARD, false);
+            }
+
+            return _found;
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          bool _DijkstraPath<_TpVertex, _TpEdge>::run_bidirectional (const _Node& _source, const _Node& _target)
+          {
+            if (! _bidirectional || &_source == &_target)
+              return run (_source, _target);
+
+            _begin ();
+            _reach (_FORWARD, _source, _TpEdge (), NULL);
+            _reach (_BACKWARD, _target, _TpEdge (), NULL);
+
+            while (! _heap [_FORWARD].empty () && ! _heap [_BACKWARD].empty ())
+            {
+              const _TpEdge& _f = _heap [_FORWARD].top_key ();
+              const _TpEdge& _b = _heap [_BACKWARD].top_key ();
+
+              /* no path through the nodes not taken yet is shorter than the best one */
+
+              if (_met && ! (_f + _b < _best))
+                break;
+
+              const size_t _s = (_f < _b || (! (_b < _f) && _heap [_FORWARD].size () <= _heap [_BACKWARD].size ()) ? _FORWARD : _BACKWARD);
+              _settle (_s, true);
+            }
+
+            if (_met)
+              _make_path (_ptr_meet [_FORWARD], _ptr_meet [_BACKWARD]);
+
+            return _found;
+          }
+
+        template<typename _TpVertex, typename _TpEdge>
+          void _DijkstraPath<_TpVertex, _TpEdge>::_make_path (const _Node* _ptr_forward, const _Node* _ptr_backward)
+          {
+            /* from the source to _ptr_forward, reversed, then from _ptr_backward to the target */
+
+            for (const _Node* _ptr = _ptr_forward; _ptr; _ptr = _prev [_FORWARD][_ptr->id ()])
+              _path.push_back (_ptr);
+
+            for (size_t i = 0, j = _path.size () - 1; i < j; i++, j--)
+            {
+              const _Node* _tmp = _path [i];
+              _path [i] = _path [j];
+              _path [j] = _tmp;
+            }
+
+            _distance = _dist [_FORWARD][_ptr_forward->id ()];
+
+            if (_ptr_backward)
+            {
+              _distance = _best;
+
+              for (const _Node* _ptr = _ptr_backward; _ptr; _ptr = _prev [_BACKWARD][_ptr->id ()])
+                _path.push_back (_ptr);
+            }
+
+            _found = true;
+          }
+
+
+        /*!
+         * The distance from \b _source to \b _target in \b _g, and the nodes
+         * of a shortest path in \b _path: false if there's no path. It runs a
+         * bidirectional search when the graph allows it (see _DijkstraPath);
+         * for many searches in the same graph, a graph::djpath (see
+         * graph::djpath_init) should be kept and reused.
+         */
+
+        template<typename _TpGraph, typename _TpVertex, typename _TpEdge>
+          bool shortest_path (const _TpGraph& _g, const _GraphNode<_TpVertex, _TpEdge>& _source, const _GraphNode<_TpVertex, _TpEdge>& _target, _TpEdge& _distance, cgt::base::array<const _GraphNode<_TpVertex, _TpEdge>*>& _path)
+          {
+            _DijkstraPath<_TpVertex, _TpEdge> _p = _g.djpath_init ();
+
+            if (! _p.run_bidirectional (_source, _target))
+              return false;
+
+            _distance = _p.distance ();
+            _path = _p.path ();
+
+            return true;
+          }
+      }
+    }
+  }
+}
+
+#endif // __CGTL__CGT_SHORTPATH_SINGLE_DIJKSTRA_DIJKSTRA_PATH_H_
@@ -0,0 +1,105 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file cgt/shortpath/single/dijkstra/dijkstra_queue.h
+ * \brief Contains the choice of the priority queue of Dijkstra Algorithm for each type of edge.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CGT_SHORTPATH_SINGLE_DIJKSTRA_DIJKSTRA_QUEUE_H_
+#define __CGTL__CGT_SHORTPATH_SINGLE_DIJKSTRA_DIJKSTRA_QUEUE_H_
+
+#include "cgt/base/indexed_heap.h"
+#include "cgt/base/radix_heap.h"
+#include "cgt/base/bucket_queue.h"
+
+
+namespace cgt
+{
+  namespace shortpath
+  {
+    namespace single
+    {
+      namespace dijkstra
+      {
+        /*!
+         * \struct _DijkstraQueue
+         * \brief The queue of nodes not taken yet used by Dijkstra Algorithm for edges of type \b _TpEdge.
+         * \author Leandro Costa
+         * \date 2011
+         *
+         * Dijkstra Algorithm takes the nodes by increasing distance, so its
+         * queue only has to be monotone (no key is pushed below the last one
+         * popped). By default it's a cgt::base::indexed_heap, that compares
+         * keys. For unsigned integers, the keys are put in buckets by their
+         * bits, with no comparisons: in Dial's buckets (cgt::base::bucket_queue)
+         * for unsigned char and unsigned short, whose values are small, and in
+         * a cgt::base::radix_heap for wider ones. Other types can be given
+         * another queue, with the interface of cgt::base::indexed_heap, by
+         * specializing this struct (Dial's buckets for an unsigned type whose
+         * edges are known to be small, for instance).
+         *
+         * It's used by _DijkstraIterator and _DijkstraPath; A* and Prim
+         * Algorithm keep a cgt::base::indexed_heap, since their keys aren't
+         * monotone.
+         */
+
+        template<typename _TpEdge>
+          struct _DijkstraQueue
+          {
+            typedef cgt::base::indexed_heap<_TpEdge>  _Type;
+          };
+
+        template<>
+          struct _DijkstraQueue<unsigned char>
+          {
+            typedef cgt::base::bucket_queue<unsigned char>  _Type;
+          };
+
+        template<>
+          struct _DijkstraQueue<unsigned short>
+          {
+            typedef cgt::base::bucket_queue<unsigned short> _Type;
+          };
+
+        template<>
+          struct _DijkstraQueue<unsigned int>
+          {
+            typedef cgt::base::radix_heap<unsigned int>     _Type;
+          };
+
+        template<>
+          struct _DijkstraQueue<unsigned long>
+          {
+            typedef cgt::base::radix_heap<unsigned long>    _Type;
+          };
+      }
+    }
+  }
+}
+
+#endif // __CGTL__CGT_SHORTPATH_SINGLE_DIJKSTRA_DIJKSTRA_QUEUE_H_
@@ -109,10 +109,10 @@ namespace cgt
         {
           _Node& _n2 = _it->node ();
 
-          if ((_ptr_edge = _n1.get_edge (_n2.vertex ())))
+          if ((_ptr_edge = _n1.get_edge (_n2)))
             _node._insert (*_ptr_edge, _n2);
 
-          if ((_ptr_edge = _n2.get_edge (_n1.vertex ())))
+          if ((_ptr_edge = _n2.get_edge (_n1)))
             _it->_insert (*_ptr_edge, _n1);
         }
       }
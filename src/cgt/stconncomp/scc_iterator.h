@@ -35,6 +35,8 @@
 
 #include "cgt/stconncomp/graph_scc_component.h"
 #include "cgt/base/heap.h"
+#include "cgt/base/array_stack.h"
+#include "cgt/base/shared.h"
 #include "cgt/base/iterator/iterator_type.h"
 #include "cgt/search/depth/depth_iterator.h"
 
@@ -61,24 +63,26 @@ namespace cgt
   namespace stconncomp
   {
     /*!
-     * \class _SCCIterator
-     * \brief An iterator that returns strongly connected components.
+     * \class _SCCEngine
+     * \brief The state of the search of strongly connected components, shared by the copies of its iterator.
      * \author Leandro Costa
      * \date 2009
      *
-     * This iterator returns all strongly connected components that exist in the graph.
+     * It finds all strongly connected components that exist in the graph,
+     * one at a time (see _next), for _SCCIterator.
+     *
+     * The first DFS runs on the transposed graph, which is read from the inverted
+     * adjacency lists of the nodes. If the graph doesn't keep them (\b _inverse is
+     * false, see _DirectedNoInverse), the iterator fills them before this DFS and
+     * clears them after it, so they only take memory while the iterator is created.
      */
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
-      class _SCCIterator
+    template<typename _TpVertex, typename _TpEdge>
+      class _SCCEngine
       {
         private:
           class _SCC_DFSInfo;
 
-        private:
-          typedef _SCCIterator<_TpVertex, _TpEdge, _TpIterator> _Self;
-          typedef _SCCIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpCommon>   _SelfCommon;
-
         private:
           typedef _GraphNode<_TpVertex, _TpEdge>          _Node;
 #ifdef CGTL_DO_NOT_USE_STL
@@ -110,7 +114,7 @@ namespace cgt
           typedef typename _DFSInfoList::const_iterator _DFSInfoCIterator;
           typedef typename _DFSInfo::_color_t           _DFSColor;
           typedef typename _DFSIterator::_DepthState    _DFSState;
-          typedef cgt::base::stack<_DFSState>           _DFSStateStack;
+          typedef cgt::base::array_stack<_DFSState>     _DFSStateStack;
 
           typedef cgt::base::heap<_SCC_DFSInfo>       _SCC_DFSInfoHeap;
           typedef typename _SCC_DFSInfoHeap::iterator _SCC_DFSInfoHeapIterator;
@@ -150,52 +154,28 @@ namespace cgt
           };
 
         public:
-          _SCCIterator () : _ptr_component (NULL) { }
-          _SCCIterator (const _NodeIterator& _it_begin, const _NodeIterator& _it_end)
-            : _ptr_component (NULL), _it_node_begin (_it_begin), _it_node_end (_it_end)
+          _SCCEngine (const _NodeIterator& _it_begin, const _NodeIterator& _it_end, const bool& _inv = true)
+            : _ptr_component (NULL), _it_node_begin (_it_begin), _it_node_end (_it_end), _inverse (_inv)
           { _init (); }
-          _SCCIterator (const _SelfCommon& _it) { *this = _it; }
 
-        _Self& operator=(const _Self& _s)
-        {
-          _it_node_begin    = _s._it_node_begin;
-          _it_node_end      = _s._it_node_end;
-          _it_rdfs          = _s._it_rdfs;
-          _component_list   = _s._component_list;
-          _rdfs_heap        = _s._rdfs_heap;
-          _dfs_list         = _s._dfs_list;
-          _dfs_state_stack  = _s._dfs_state_stack;
-
-          /*!
-           * TODO:
-           *
-           * \todo We need a better way to initialize _ptr_component.
-           * It should point to the component pointed by _s._ptr_component:
-           * 
-           * \code
-           *   _ptr_component = NULL;
-           *
-           *   if (_s._ptr_component)
-           *   {
-           *     _ComponentIterator _it = _component_list.find (*_s._ptr_component);
-           *
-           *     if (_it != _component_list.end ())
-           *      _ptr_component  = &(*_it);
-           *   }
-           * \endcode
-           */
+        private:
+          _SCCEngine (const _SCCEngine&);
+          _SCCEngine& operator=(const _SCCEngine&);
 
-          if (_s._ptr_component)
-            _ptr_component  = &(_component_list.back ());
+        public:
+          /** the component found by the last step (NULL when there are no more) */
+          _Component* _current () const { return _ptr_component; }
 
-          return *this;
-        }
+          /** finds the next component */
+          void _next ();
 
         private:
           void _init ();
 
         private:
           void _run_reverse_dfs ();
+          void _fill_inverse ();
+          void _clear_inverse ();
           void _discover_node (const _Node& _node);
           void _finish_node (const _Node& _node);
           const bool _has_color (const _Node& _node, const _DFSColor &_color) const;
@@ -203,13 +183,6 @@ namespace cgt
           _SCC_DFSInfo* _get_node_for_new_scc ();
           void _make_new_scc (_Node& _node);
 
-        public:
-          _Component& operator*() const { return *_ptr_component; }
-          _Component* operator->() const { return _ptr_component; }
-          const bool operator==(const _Self& _other) const { return (_ptr_component == _other._ptr_component); }
-          const bool operator!=(const _Self& _other) const { return !(*this == _other); }
-          _Self& operator++();
-
         private:
           _Component*       _ptr_component;
           _ComponentList    _component_list;
@@ -217,6 +190,7 @@ namespace cgt
           _DFSIterator      _it_rdfs;
           _NodeIterator     _it_node_begin;
           _NodeIterator     _it_node_end;
+          bool              _inverse; /** < whether the nodes keep their inverted adjacency lists */
           
           _DFSInfoList      _dfs_list;
           _DFSStateStack    _dfs_state_stack;
@@ -224,8 +198,8 @@ namespace cgt
       };
 
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      void _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::_init ()
+    template<typename _TpVertex, typename _TpEdge>
+      void _SCCEngine<_TpVertex, _TpEdge>::_init ()
       {
         /*
          * Execute DFS in reverse graph and initialize heap
@@ -263,8 +237,8 @@ namespace cgt
      * used to get nodes in decreasing finish time.
      */
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      void _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::_run_reverse_dfs ()
+    template<typename _TpVertex, typename _TpEdge>
+      void _SCCEngine<_TpVertex, _TpEdge>::_run_reverse_dfs ()
       {
           /*!
            * TODO:
@@ -274,6 +248,9 @@ namespace cgt
 					 * way to read the original nodes in an 'inverted way'.
 					 */
 
+        if (! _inverse)
+          _fill_inverse ();
+
         for (_NodeIterator _it = _it_node_begin; _it != _it_node_end; ++_it)
           _it->_invert_edges ();
 
@@ -286,13 +263,43 @@ namespace cgt
         for (_NodeIterator _it = _it_node_begin; _it != _it_node_end; ++_it)
           _it->_invert_edges ();
 
+        if (! _inverse)
+          _clear_inverse ();
+
         _DFSInfoIterator _it_end (_it_rdfs.info_end ());
         for (_DFSInfoIterator _it (_it_rdfs.info_begin ()); _it != _it_end; ++_it)
           _rdfs_heap.push (_SCC_DFSInfo (*_it));
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      void _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::_discover_node (const _Node& _node)
+    /*
+     * Build the inverted adjacency lists of a graph that
+     * doesn't keep them: for each edge (n1, n2), add n1
+     * to the inverted list of n2. Time complexity: O(V + E).
+     */
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _SCCEngine<_TpVertex, _TpEdge>::_fill_inverse ()
+      {
+        typedef typename _Node::_AdjList::iterator _AdjIterator;
+
+        for (_NodeIterator _it = _it_node_begin; _it != _it_node_end; ++_it)
+        {
+          _AdjIterator _itAdjEnd = _it->_adjList.end ();
+
+          for (_AdjIterator _itAdj = _it->_adjList.begin (); _itAdj != _itAdjEnd; ++_itAdj)
+            _itAdj->node ()._insert_inverse (_itAdj->edge (), *_it);
+        }
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _SCCEngine<_TpVertex, _TpEdge>::_clear_inverse ()
+      {
+        for (_NodeIterator _it = _it_node_begin; _it != _it_node_end; ++_it)
+          _it->_clear_inverse ();
+      }
+
+    template<typename _TpVertex, typename _TpEdge>
+      void _SCCEngine<_TpVertex, _TpEdge>::_discover_node (const _Node& _node)
       {
         _DFSInfo *_ptr = _get_depth_info_by_node (_node);
 
@@ -300,8 +307,8 @@ namespace cgt
           _ptr->set_color (_DFSInfo::GRAY);
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      void _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::_finish_node (const _Node& _node)
+    template<typename _TpVertex, typename _TpEdge>
+      void _SCCEngine<_TpVertex, _TpEdge>::_finish_node (const _Node& _node)
       {
         _DFSInfo *_ptr = _get_depth_info_by_node (_node);
 
@@ -309,8 +316,8 @@ namespace cgt
           _ptr->set_color (_DFSInfo::BLACK);
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      const bool _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::_has_color (const _Node& _node, const _DFSColor &_color) const
+    template<typename _TpVertex, typename _TpEdge>
+      const bool _SCCEngine<_TpVertex, _TpEdge>::_has_color (const _Node& _node, const _DFSColor &_color) const
       {
         bool bRet = false;
 
@@ -318,7 +325,7 @@ namespace cgt
 
         for (_DFSInfoCIterator it = _dfs_list.begin (); it != itEnd; ++it)
         {
-          if (it->node ().vertex () == _node.vertex ())
+          if (&(it->node ()) == &_node)
           {
             bRet = (it->color () == _color);
             break;
@@ -328,8 +335,8 @@ namespace cgt
         return bRet;
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      typename cgt::search::depth::_DepthIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpConst>::_DepthInfo* _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::_get_depth_info_by_node (const _Node& _node)
+    template<typename _TpVertex, typename _TpEdge>
+      typename cgt::search::depth::_DepthIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpConst>::_DepthInfo* _SCCEngine<_TpVertex, _TpEdge>::_get_depth_info_by_node (const _Node& _node)
       {
         _DFSInfo *_ptr = NULL;
 
@@ -337,7 +344,7 @@ namespace cgt
 
         for (_DFSInfoIterator it = _dfs_list.begin (); it != itEnd; ++it)
         {
-          if (it->node ().vertex () == _node.vertex ())
+          if (&(it->node ()) == &_node)
           {
             _ptr = &(*it);
             break;
@@ -347,8 +354,8 @@ namespace cgt
         return _ptr;
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      typename _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::_SCC_DFSInfo* _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::_get_node_for_new_scc ()
+    template<typename _TpVertex, typename _TpEdge>
+      typename _SCCEngine<_TpVertex, _TpEdge>::_SCC_DFSInfo* _SCCEngine<_TpVertex, _TpEdge>::_get_node_for_new_scc ()
       {
         _SCC_DFSInfo* _ptr_rdfs_info = _rdfs_heap.pop ();
 
@@ -369,8 +376,8 @@ namespace cgt
      * _node) to the new SCC.
      */
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      void _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::_make_new_scc (_Node& _node)
+    template<typename _TpVertex, typename _TpEdge>
+      void _SCCEngine<_TpVertex, _TpEdge>::_make_new_scc (_Node& _node)
       {
          // Put _node into the stack
         _dfs_state_stack.insert (_DFSState (_node));
@@ -401,8 +408,8 @@ namespace cgt
             {
               _ptr_node = &(_state._adj_node ());
               _state.adj_incr ();
-              _dfs_state_stack.push (_DFSState (*_ptr_node));
               _discover_node (*_ptr_node);
+              _dfs_state_stack.push (_DFSState (*_ptr_node));
               break;
             }
             else
@@ -416,15 +423,13 @@ namespace cgt
           }
           else
           {
-            _DFSState *_ptr = _dfs_state_stack.pop ();
-            _finish_node (_ptr->node ());
-            delete _ptr;
+            _finish_node (_dfs_state_stack.pop ().node ());
           }
         }
       }
 
-    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator>
-      _SCCIterator<_TpVertex, _TpEdge, _TpIterator>& _SCCIterator<_TpVertex, _TpEdge, _TpIterator>::operator++()
+    template<typename _TpVertex, typename _TpEdge>
+      void _SCCEngine<_TpVertex, _TpEdge>::_next ()
       {
         _ptr_component = NULL;
 
@@ -440,9 +445,61 @@ namespace cgt
           _make_new_scc (_ptr_rdfs_info->node ());
           delete _ptr_rdfs_info;
         }
-
-        return *this;
       }
+
+
+    /*!
+     * \class _SCCIterator
+     * \brief An iterator that returns strongly connected components.
+     * \author Leandro Costa
+     * \date 2009
+     *
+     * This iterator returns all strongly connected components that exist in the graph.
+     *
+     * The components are found by a _SCCEngine shared by the copies of the
+     * iterator, so copying an iterator is \b O(1); copies share the search,
+     * and incrementing one of them moves it on for all.
+     */
+
+    template<typename _TpVertex, typename _TpEdge, template<typename> class _TpIterator = cgt::base::iterator::_TpCommon>
+      class _SCCIterator
+      {
+        private:
+          friend class _SCCIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpConst>;
+
+        private:
+          typedef _SCCIterator<_TpVertex, _TpEdge, _TpIterator> _Self;
+          typedef _SCCIterator<_TpVertex, _TpEdge, cgt::base::iterator::_TpCommon>   _SelfCommon;
+
+        private:
+          typedef _SCCEngine<_TpVertex, _TpEdge>          _Engine;
+          typedef _GraphNode<_TpVertex, _TpEdge>          _Node;
+#ifdef CGTL_DO_NOT_USE_STL
+          typedef typename cgt::base::list<_Node>::iterator _NodeIterator;
+#else
+          typedef typename std::list<_Node>::iterator _NodeIterator;
+#endif
+          typedef _GraphSCCComponent<_TpVertex, _TpEdge>  _Component;
+
+        public:
+          _SCCIterator () : _ptr_component (NULL) { }
+          _SCCIterator (const _NodeIterator& _it_begin, const _NodeIterator& _it_end, const bool& _inv = true)
+            : _engine (new _Engine (_it_begin, _it_end, _inv))
+          { _ptr_component = _engine->_current (); }
+          _SCCIterator (const _SelfCommon& _it) : _ptr_component (_it._ptr_component), _engine (_it._engine) { }
+
+        public:
+          _Component& operator*() const { return *_ptr_component; }
+          _Component* operator->() const { return _ptr_component; }
+          const bool operator==(const _Self& _other) const { return (_ptr_component == _other._ptr_component); }
+          const bool operator!=(const _Self& _other) const { return !(*this == _other); }
+          _Self& operator++() { _engine->_next (); _ptr_component = _engine->_current (); return *this; }
+          _Self operator++(int) { _Self _it = *this; operator++(); return _it; }
+
+        private:
+          _Component*                 _ptr_component;
+          cgt::base::_Shared<_Engine> _engine;
+      };
   }
 }
 
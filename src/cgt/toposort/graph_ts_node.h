@@ -76,7 +76,7 @@ namespace cgt
         public:
           const bool operator==(const _TSNode& _ts_node)
           {
-            return (_node.vertex () == _ts_node.node ().vertex ());
+            return (&_node == &(_ts_node.node ()));
           }
 
           const bool operator!=(const _TSNode& _ts_node)
@@ -162,7 +162,7 @@ namespace cgt
               _TSNode& _tsn2 = *_it2;
 
               /*! if there is an edge between _ts1 and _ts2, insert edge to auxiliary graph */
-              if ((_ptr_edge = _tsn1.node ().get_edge (_tsn2.node ().vertex ())))
+              if ((_ptr_edge = _tsn1.node ().get_edge (_tsn2.node ())))
                 _tsn2._insert_inverse (*_ptr_edge, _tsn1.node ());
             }
           }
@@ -0,0 +1,152 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/astarbench.cpp
+ * \brief Compares the A* iterator with the point-to-point dijkstra search
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a grid of <side> x <side> vertices (default: 300), like a road
+ * network, where each vertex has edges to its right and bottom neighbours
+ * with random values from 10 to 29, and finds the distance between
+ * <pairs> random pairs of vertices (default: 100): with djpath::run, and
+ * with the A* iterator, estimating the distance to the target by its
+ * manhattan distance times 10. It prints the time of each one and the
+ * number of nodes taken per pair.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Undirected, cgt::base::_HashFunc<int> > Graph;
+
+class Manhattan
+{
+	public:
+		Manhattan (const int& side, const int& target) : mSide (side), mTarget (target) { }
+
+	public:
+		int operator()(const int& v) const
+		{
+			int dr = v / mSide - mTarget / mSide;
+			int dc = v % mSide - mTarget % mSide;
+
+			return 10 * ((dr < 0 ? -dr : dr) + (dc < 0 ? -dc : dc));
+		}
+
+	private:
+		int mSide;
+		int mTarget;
+};
+
+int main (int argc, char* argv[])
+{
+	int side = (argc > 1 ? atoi (argv[1]) : 300);
+	int pairs = (argc > 2 ? atoi (argv[2]) : 100);
+	int n = side * side;
+
+	std::cout << "run: " << argv[0] << " [side] [pairs] (default: 300 100)" << std::endl << std::endl;
+
+	Graph g;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (1);
+	for (int r = 0; r < side; r++)
+	{
+		for (int c = 0; c < side; c++)
+		{
+			int i = r * side + c;
+
+			if (c + 1 < side)
+				g.insert_edge (10 + rand () % 20, its [i], its [i + 1]);
+
+			if (r + 1 < side)
+				g.insert_edge (10 + rand () % 20, its [i], its [i + side]);
+		}
+	}
+
+	std::vector<int> sources, targets;
+
+	for (int k = 0; k < pairs; k++)
+	{
+		sources.push_back (rand () % n);
+		targets.push_back (rand () % n);
+	}
+
+	BenchTimer timer;
+	Graph::djpath p = g.djpath_init ();
+	long sumDijkstra = 0;
+	size_t takenDijkstra = 0;
+
+	for (int k = 0; k < pairs; k++)
+	{
+		p.run (*its [sources [k]], *its [targets [k]]);
+		sumDijkstra += p.distance ();
+		takenDijkstra += p.settled ();
+	}
+
+	double tDijkstra = timer.elapsed ();
+
+	long sumAStar = 0;
+	size_t takenAStar = 0;
+
+	timer.reset ();
+	for (int k = 0; k < pairs; k++)
+	{
+		const Graph::node* target = &(*its [targets [k]]);
+		Graph::astar<Manhattan>::iterator it = g.asbegin (its [sources [k]], Manhattan (side, targets [k]));
+
+		for (; it != g.asend<Manhattan> (); ++it)
+		{
+			takenAStar++;
+
+			if (&(*it) == target)
+			{
+				sumAStar += it.info (*it)->distance ();
+				break;
+			}
+		}
+	}
+
+	double tAStar = timer.elapsed ();
+
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (16) << "search" << std::setw (12) << "time (ms)" << std::setw (18) << "nodes per pair" << std::endl;
+	std::cout << std::setw (16) << "dijkstra" << std::setw (12) << tDijkstra << std::setw (18) << takenDijkstra / pairs << std::endl;
+	std::cout << std::setw (16) << "A*" << std::setw (12) << tAStar << std::setw (18) << takenAStar / pairs << std::endl;
+	std::cout << std::endl << "distances: " << (sumDijkstra == sumAStar ? "same" : "DIFFERENT") << std::endl;
+
+	return 0;
+}
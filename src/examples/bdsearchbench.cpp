@@ -0,0 +1,149 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/bdsearchbench.cpp
+ * \brief Compares the bidirectional breadth-first search with the biterator on point-to-point queries
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a random directed graph with 2 ^ <scale> vertices (default: 18)
+ * and 4 edges per vertex, and finds the number of hops between 200 random
+ * pairs of nodes with the biterator (a local search from the source that
+ * stops at the target, see graph::bbegin (it, workspace)), and with
+ * graph::bdsearch, that grows a search from each end. It prints the total
+ * time and the average number of nodes explored by each one.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 4;
+static const int NUM_PAIRS = 200;
+
+int main (int argc, char* argv[])
+{
+	int scale = (argc > 1 ? atoi (argv[1]) : 18);
+	int n = (1 << scale);
+
+	std::cout << "run: " << argv[0] << " [scale] (default: 18)" << std::endl << std::endl;
+
+	Graph g;
+	std::vector<Graph::iterator> its;
+	BenchTimer timer;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (1);
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < EDGES_PER_VERTEX; j++)
+			g.insert_edge (j, its [i], its [rand () % n]);
+
+	std::cout << "random graph: " << n << " vertices, " << n * EDGES_PER_VERTEX << " edges, built in " << timer.elapsed () << " ms" << std::endl << std::endl;
+
+	std::vector<size_t> sources;
+	std::vector<size_t> targets;
+
+	srand (2);
+	for (int k = 0; k < NUM_PAIRS; k++)
+	{
+		sources.push_back (rand () % n);
+		targets.push_back (rand () % n);
+	}
+
+	/* the biterator: its depth info gives the hops, by the parents of the target */
+	Graph::search_workspace ws;
+	size_t hopsB = 0, exploredB = 0, errors = 0;
+	std::vector<size_t> hops;
+
+	timer.reset ();
+	for (int k = 0; k < NUM_PAIRS; k++)
+	{
+		const Graph::node& target = g.get_node_by_id (targets [k]);
+		size_t h = Graph::bdsearch::npos;
+
+		Graph::biterator it = g.bbegin (its [sources [k]], ws);
+
+		for (; it != g.bend (); ++it)
+		{
+			exploredB++;
+
+			if (&(*it) == &target)
+			{
+				h = 0;
+
+				for (const Graph::node* p = it.info (*it)->parent (); p; p = it.info (*p)->parent ())
+					h++;
+
+				break;
+			}
+		}
+
+		hops.push_back (h);
+
+		if (h != Graph::bdsearch::npos)
+			hopsB += h;
+	}
+
+	double tB = timer.elapsed ();
+
+	Graph::bdsearch s = g.bdsearch_init ();
+	size_t hopsS = 0, exploredS = 0;
+
+	timer.reset ();
+	for (int k = 0; k < NUM_PAIRS; k++)
+	{
+		size_t h = s.run (g.get_node_by_id (sources [k]), g.get_node_by_id (targets [k]));
+		exploredS += s.explored ();
+
+		if (h != hops [k])
+			errors++;
+
+		if (h != Graph::bdsearch::npos)
+			hopsS += h;
+	}
+
+	double tS = timer.elapsed ();
+
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (12) << "search" << std::setw (12) << "time (ms)" << std::setw (20) << "explored per pair" << std::setw (14) << "total hops" << std::endl;
+	std::cout << std::setw (12) << "biterator" << std::setw (12) << tB << std::setw (20) << static_cast<double>(exploredB) / NUM_PAIRS << std::setw (14) << hopsB << std::endl;
+	std::cout << std::setw (12) << "bdsearch" << std::setw (12) << tS << std::setw (20) << static_cast<double>(exploredS) / NUM_PAIRS << std::setw (14) << hopsS << std::endl;
+	std::cout << std::endl << "speedup " << tB / tS << std::endl;
+
+	if (errors)
+		std::cout << "error: " << errors << " distances differ" << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/bench_util.h
+ * \brief Helpers shared by the benchmark examples.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef _BENCH_UTIL_H_
+#define _BENCH_UTIL_H_
+
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/*!
+ * \class BenchTimer
+ * \brief A wall-clock timer with microsecond resolution.
+ */
+
+class BenchTimer
+{
+	public:
+		BenchTimer () { reset (); }
+
+	public:
+		void reset () { gettimeofday (&mStart, NULL); }
+
+		/** elapsed time since the last reset, in milliseconds */
+		double elapsed () const
+		{
+			struct timeval now;
+			gettimeofday (&now, NULL);
+
+			return (now.tv_sec - mStart.tv_sec) * 1000.0 + (now.tv_usec - mStart.tv_usec) / 1000.0;
+		}
+
+	private:
+		struct timeval mStart;
+};
+
+/** the peak resident set size of the process, in kilobytes */
+inline long peak_rss_kb ()
+{
+	struct rusage usage;
+	getrusage (RUSAGE_SELF, &usage);
+
+	return usage.ru_maxrss;
+}
+
+/** the current resident set size of the process, in kilobytes (-1 if /proc isn't available) */
+inline long current_rss_kb ()
+{
+	long pages = -1, resident = -1;
+	FILE* f = fopen ("/proc/self/statm", "r");
+
+	if (! f)
+		return -1;
+
+	if (fscanf (f, "%ld %ld", &pages, &resident) != 2)
+		resident = -1;
+
+	fclose (f);
+
+	return (resident < 0 ? -1 : resident * (sysconf (_SC_PAGESIZE) / 1024));
+}
+
+#endif // _BENCH_UTIL_H_
@@ -0,0 +1,145 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/bulkloadbench.cpp
+ * \brief Compares loading a graph edge by edge and with insert_edges ()
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Loads graphs with 8 edges per vertex (half of them leaving a few hubs,
+ * with repeated edges) by calls to insert_vertex () and insert_edge (), and
+ * by insert_vertices () and insert_edges (), with and without an index of
+ * vertices. Without the index each insert_edge () searches the node's list,
+ * so loading edge by edge is only measured up to <max-sequential-vertices>
+ * (default: 10000).
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int>                                             Graph;
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > HashedGraph;
+
+static const int EDGES_PER_VERTEX = 8;
+static const int NUM_HUBS = 16;
+
+template<typename _TpIterator>
+	size_t count (_TpIterator it, const _TpIterator& itEnd)
+	{
+		size_t n = 0;
+
+		for (; it != itEnd; ++it)
+			n++;
+
+		return n;
+	}
+
+/* prints the time to load the graph edge by edge (if n <= maxSequential) and in bulk */
+template<typename _TpGraph>
+	void load (const std::vector<int>& vertices, const std::vector<typename _TpGraph::edge_spec>& edges, const int& n, const int& maxSequential)
+	{
+		double tSequential = -1;
+		size_t nSequential = 0;
+
+		if (n <= maxSequential)
+		{
+			_TpGraph g;
+			BenchTimer timer;
+
+			for (size_t i = 0; i < vertices.size (); i++)
+				g.insert_vertex (vertices [i]);
+
+			for (size_t i = 0; i < edges.size (); i++)
+				g.insert_edge (edges [i].value (), edges [i].v1 (), edges [i].v2 ());
+
+			tSequential = timer.elapsed ();
+			nSequential = count (g.ebegin (), g.eend ());
+		}
+
+		_TpGraph g;
+		BenchTimer timer;
+
+		g.insert_vertices (vertices.begin (), vertices.end ());
+		g.insert_edges (edges.begin (), edges.end ());
+
+		double tBulk = timer.elapsed ();
+		size_t nBulk = count (g.ebegin (), g.eend ());
+
+		std::cout << std::setw (12) << nBulk;
+
+		if (tSequential < 0)
+			std::cout << std::setw (18) << "skipped";
+		else
+			std::cout << std::setw (18) << tSequential;
+
+		std::cout << std::setw (12) << tBulk;
+
+		if (tSequential >= 0 && nSequential != nBulk)
+			std::cout << "  (sequential: " << nSequential << " edges)";
+	}
+
+int main (int argc, char* argv[])
+{
+	int maxSequential = (argc > 1 ? atoi (argv[1]) : 10000);
+
+	std::cout << "run: " << argv[0] << " [max-sequential-vertices] (default: 10000)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (10) << "vertices" << std::setw (10) << "index" << std::setw (12) << "edges"
+		<< std::setw (18) << "sequential (ms)" << std::setw (12) << "bulk (ms)" << std::endl;
+
+	for (int n = 1000; n <= 1000000; n *= 10)
+	{
+		std::vector<int> vertices;
+		std::vector<Graph::edge_spec> edges;
+
+		for (int i = 0; i < n; i++)
+			vertices.push_back (i);
+
+		srand (1);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < EDGES_PER_VERTEX; j++)
+			{
+				int v = (j % 2 ? rand () % NUM_HUBS : rand () % n);
+				edges.push_back (Graph::edge_spec (rand () % 100, v, rand () % n));
+			}
+
+		std::cout << std::setw (10) << n << std::setw (10) << "none";
+		load<Graph> (vertices, edges, n, maxSequential);
+		std::cout << std::endl;
+
+		std::cout << std::setw (10) << n << std::setw (10) << "hash";
+		load<HashedGraph> (vertices, edges, n, 10 * maxSequential);
+		std::cout << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/csrbench.cpp
+ * \brief Compares iterators on a graph and on its CSR snapshot
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a graph with 4 edges per vertex, freezes it and measures a full
+ * breadth-first search, depth-first search and Dijkstra on both. Searches
+ * on the graph are quadratic on the number of vertices (the info lists
+ * are searched by vertex), so they're only measured up to
+ * <max-graph-vertices> (default: 10000).
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+typedef Graph::csr_graph                                                 CSRGraph;
+
+static const int EDGES_PER_VERTEX = 4;
+
+template<typename _TpIterator>
+	size_t count (_TpIterator it, const _TpIterator& itEnd)
+	{
+		size_t n = 0;
+
+		for (; it != itEnd; ++it)
+			n++;
+
+		return n;
+	}
+
+int main (int argc, char* argv[])
+{
+	int maxGraph = (argc > 1 ? atoi (argv[1]) : 10000);
+
+	std::cout << "run: " << argv[0] << " [max-graph-vertices] (default: 10000)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (10) << "vertices" << std::setw (12) << "freeze (ms)"
+		<< std::setw (14) << "search" << std::setw (14) << "graph (ms)" << std::setw (14) << "csr (ms)" << std::endl;
+
+	for (int n = 1000; n <= 1000000; n *= 10)
+	{
+		Graph g;
+
+		for (int i = 0; i < n; i++)
+			g.insert_vertex (i);
+
+		srand (1);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < EDGES_PER_VERTEX; j++)
+				g.insert_edge (rand () % 100, i, rand () % n);
+
+		BenchTimer timer;
+		CSRGraph c = g.freeze ();
+		double tFreeze = timer.elapsed ();
+
+		const char* names[] = { "breadth", "depth", "dijkstra" };
+
+		for (int s = 0; s < 3; s++)
+		{
+			double tGraph = -1;
+			size_t nGraph = 0, nCSR = 0;
+
+			if (n <= maxGraph)
+			{
+				timer.reset ();
+
+				switch (s)
+				{
+					case 0: nGraph = count (g.bbegin (), g.bend ()); break;
+					case 1: nGraph = count (g.dbegin (), g.dend ()); break;
+					case 2: nGraph = count (g.djbegin (), g.djend ()); break;
+				}
+
+				tGraph = timer.elapsed ();
+			}
+
+			timer.reset ();
+
+			switch (s)
+			{
+				case 0: nCSR = count (c.bbegin (), c.bend ()); break;
+				case 1: nCSR = count (c.dbegin (), c.dend ()); break;
+				case 2: nCSR = count (c.djbegin (), c.djend ()); break;
+			}
+
+			double tCSR = timer.elapsed ();
+
+			std::cout << std::setw (10) << n << std::setw (12) << tFreeze << std::setw (14) << names[s];
+
+			if (tGraph < 0)
+				std::cout << std::setw (14) << "skipped";
+			else
+				std::cout << std::setw (14) << tGraph;
+
+			std::cout << std::setw (14) << tCSR << "  (" << nCSR << " nodes";
+
+			if (tGraph >= 0 && nGraph != nCSR)
+				std::cout << ", graph: " << nGraph;
+
+			std::cout << ")" << std::endl;
+		}
+	}
+
+	return 0;
+}
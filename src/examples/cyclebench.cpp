@@ -0,0 +1,129 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/cyclebench.cpp
+ * \brief Measures cycle detection and edge classification by depth_first
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a random DAG with <vertices> vertices (default: 1000000) and 4
+ * edges per vertex (each one to a vertex with a greater value), and a
+ * path of <depth> vertices (default: 10000000). Measures has_cycle on both,
+ * before and after an edge that closes a cycle is inserted, and the
+ * classification of all edges of the DAG by depth_first_forest.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 4;
+
+/* counts the edges of each class */
+struct EdgeCounter : public Graph::visitor
+{
+	EdgeCounter () : tree (0), back (0), forward (0), cross (0) { }
+
+	void tree_edge (const Graph::node& n, const Graph::adjacency& a) { tree++; }
+	void back_edge (const Graph::node& n, const Graph::adjacency& a) { back++; }
+	void forward_edge (const Graph::node& n, const Graph::adjacency& a) { forward++; }
+	void cross_edge (const Graph::node& n, const Graph::adjacency& a) { cross++; }
+
+	size_t tree, back, forward, cross;
+};
+
+void measure (const char* name, Graph& g, Graph::iterator itFrom, Graph::iterator itTo)
+{
+	Graph::visit_workspace ws;
+	BenchTimer timer;
+
+	bool acyclic = ! cgt::search::has_cycle (g, ws);
+	double tAcyclic = timer.elapsed ();
+
+	g.insert_edge (0, itFrom, itTo);
+
+	timer.reset ();
+	bool cyclic = cgt::search::has_cycle (g, ws);
+	double tCyclic = timer.elapsed ();
+
+	std::cout << std::setw (8) << name << std::setw (20) << tAcyclic << std::setw (20) << tCyclic
+		<< "   (" << (acyclic && cyclic ? "ok" : "WRONG") << ")" << std::endl;
+}
+
+int main (int argc, char* argv[])
+{
+	int n = (argc > 1 ? atoi (argv[1]) : 1000000);
+	int depth = (argc > 2 ? atoi (argv[2]) : 10000000);
+
+	std::cout << "run: " << argv[0] << " [vertices] [depth] (default: 1000000 10000000)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+
+	Graph dag;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (dag.insert_vertex (i));
+
+	srand (1);
+	for (int i = 0; i < n - 1; i++)
+		for (int j = 0; j < EDGES_PER_VERTEX; j++)
+			dag.insert_edge (j, its [i], its [i + 1 + rand () % (n - i - 1)]);
+
+	EdgeCounter counter;
+	BenchTimer timer;
+	cgt::search::depth_first_forest (dag, counter);
+	double tClassify = timer.elapsed ();
+
+	std::cout << "classification of the DAG: " << tClassify << " ms (" << counter.tree << " tree, " << counter.back << " back, "
+		<< counter.forward << " forward, " << counter.cross << " cross edges)" << std::endl << std::endl;
+
+	std::cout << std::setw (8) << "graph" << std::setw (20) << "acyclic (ms)" << std::setw (20) << "one cycle (ms)" << std::endl;
+
+	measure ("dag", dag, its [n - 1], its [0]);
+	its.clear ();
+
+	Graph path;
+	Graph::iterator itFirst = path.insert_vertex (0);
+	Graph::iterator itPrev = itFirst;
+
+	for (int i = 1; i < depth; i++)
+	{
+		Graph::iterator itV = path.insert_vertex (i);
+		path.insert_edge (i, itPrev, itV);
+		itPrev = itV;
+	}
+
+	measure ("path", path, itPrev, itFirst);
+
+	return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/deltabench.cpp
+ * \brief Compares the dijkstra iterator with the parallel delta-stepping search
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a grid of <side> x <side> vertices (default: 500), where each
+ * vertex has edges to its right and bottom neighbours with random values
+ * from 10 to 29, and finds the distances from <sources> random vertices
+ * (default: 5) to all others: with the dijkstra iterator, and with
+ * deltastep on 1, 2 and 4 threads and on all cores, with the default delta.
+ * It prints the time of each one, and checks that all of them find the
+ * same distances.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Undirected, cgt::base::_HashFunc<int> > Graph;
+
+/* the sum of the distances from each source */
+long run_dijkstra (Graph& g, const std::vector<Graph::iterator>& its, const std::vector<int>& sources)
+{
+	long sum = 0;
+
+	for (size_t k = 0; k < sources.size (); k++)
+	{
+		Graph::djiterator it = g.djbegin (its [sources [k]]);
+
+		for (; it != g.djend (); ++it)
+			sum += it.info (*it)->distance ();
+	}
+
+	return sum;
+}
+
+long run_deltastep (Graph& g, const std::vector<Graph::iterator>& its, const std::vector<int>& sources, const size_t& threads)
+{
+	long sum = 0;
+	Graph::deltastep ds = g.deltastep_init (threads);
+
+	for (size_t k = 0; k < sources.size (); k++)
+	{
+		ds.run (*its [sources [k]]);
+
+		for (size_t i = 0; i < its.size (); i++)
+			if (ds.reached (*its [i]))
+				sum += ds.distance (*its [i]);
+	}
+
+	return sum;
+}
+
+int main (int argc, char* argv[])
+{
+	int side = (argc > 1 ? atoi (argv[1]) : 500);
+	int runs = (argc > 2 ? atoi (argv[2]) : 5);
+	int n = side * side;
+
+	std::cout << "run: " << argv[0] << " [side] [sources] (default: 500 5)" << std::endl << std::endl;
+
+	Graph g;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (1);
+	for (int r = 0; r < side; r++)
+	{
+		for (int c = 0; c < side; c++)
+		{
+			int i = r * side + c;
+
+			if (c + 1 < side)
+				g.insert_edge (10 + rand () % 20, its [i], its [i + 1]);
+
+			if (r + 1 < side)
+				g.insert_edge (10 + rand () % 20, its [i], its [i + side]);
+		}
+	}
+
+	std::vector<int> sources;
+
+	for (int k = 0; k < runs; k++)
+		sources.push_back (rand () % n);
+
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (16) << "search" << std::setw (12) << "time (ms)" << std::endl;
+
+	BenchTimer timer;
+	long sumDijkstra = run_dijkstra (g, its, sources);
+	std::cout << std::setw (16) << "dijkstra" << std::setw (12) << timer.elapsed () << std::endl;
+
+	bool same = true;
+	size_t threads [] = { 1, 2, 4, 0 };
+	const char* names [] = { "deltastep x1", "deltastep x2", "deltastep x4", "deltastep all" };
+
+	for (int t = 0; t < 4; t++)
+	{
+		timer.reset ();
+		long sum = run_deltastep (g, its, sources, threads [t]);
+		std::cout << std::setw (16) << names [t] << std::setw (12) << timer.elapsed () << std::endl;
+
+		if (sum != sumDijkstra)
+			same = false;
+	}
+
+	std::cout << std::endl << "distances: " << (same ? "same" : "DIFFERENT") << std::endl;
+
+	return 0;
+}
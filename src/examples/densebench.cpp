@@ -0,0 +1,244 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/densebench.cpp
+ * \brief Compares dense graphs with and without a bit matrix of their edges
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a random directed graph with <vertices> vertices (default: 2000)
+ * and density <density>% (default: 30), as a default graph (adjacency
+ * lists only) and as a _DirectedDense graph (lists and a bit matrix), and
+ * measures: the build, 1M random edge tests, the number of common
+ * neighbours of 20k pairs of nodes, and the set of nodes reachable from
+ * 100 nodes of a sparse graph (1% of the density) built the same way.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int>                        Graph;
+typedef cgt::graph<int, int, cgt::_DirectedDense>   DenseGraph;
+
+static const int NUM_TESTS = 1000000;
+static const int NUM_PAIRS = 20000;
+static const int NUM_SOURCES = 100;
+
+template<typename _TpGraph>
+	void build (_TpGraph& g, const int& n, const int& density)
+	{
+		std::vector<typename _TpGraph::iterator> its;
+
+		for (int i = 0; i < n; i++)
+			its.push_back (g.insert_vertex (i));
+
+		srand (1);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < n; j++)
+				if (rand () % 1000 < density)
+					g.insert_edge (rand () % 100, its [i], its [j]);
+	}
+
+/* edge tests by the adjacency lists (default graph) or by the bit matrix (dense graph) */
+size_t test_edges (const Graph& g)
+{
+	size_t found = 0;
+	size_t n = g.num_vertices ();
+
+	srand (2);
+	for (int k = 0; k < NUM_TESTS; k++)
+	{
+		size_t i = rand () % n;
+		size_t j = rand () % n;
+
+		if (g.get_node_by_id (i).get_edge (g.get_node_by_id (j)))
+			found++;
+	}
+
+	return found;
+}
+
+size_t test_edges (const DenseGraph& g)
+{
+	size_t found = 0;
+	size_t n = g.num_vertices ();
+
+	srand (2);
+	for (int k = 0; k < NUM_TESTS; k++)
+	{
+		size_t i = rand () % n;
+		size_t j = rand () % n;
+
+		if (g.has_edge (g.get_node_by_id (i), g.get_node_by_id (j)))
+			found++;
+	}
+
+	return found;
+}
+
+/* common neighbours: marks of the first node's list, searched in the second's list */
+size_t common_neighbours (const Graph& g)
+{
+	size_t n = g.num_vertices ();
+	size_t total = 0;
+	std::vector<int> mark (n, -1);
+
+	srand (3);
+	for (int k = 0; k < NUM_PAIRS; k++)
+	{
+		const Graph::node& n1 = g.get_node_by_id (rand () % n);
+		const Graph::node& n2 = g.get_node_by_id (rand () % n);
+
+		for (Graph::adjlist::const_iterator it = n1.adjlist ().begin (); it != n1.adjlist ().end (); ++it)
+			mark [it->node ().id ()] = k;
+
+		for (Graph::adjlist::const_iterator it = n2.adjlist ().begin (); it != n2.adjlist ().end (); ++it)
+			if (mark [it->node ().id ()] == k)
+				total++;
+	}
+
+	return total;
+}
+
+size_t common_neighbours (const DenseGraph& g)
+{
+	size_t n = g.num_vertices ();
+	size_t total = 0;
+	cgt::base::bitset s1;
+	cgt::base::bitset s2;
+
+	srand (3);
+	for (int k = 0; k < NUM_PAIRS; k++)
+	{
+		g.neighbours (g.get_node_by_id (rand () % n), s1);
+		g.neighbours (g.get_node_by_id (rand () % n), s2);
+		total += s1.count_and_words (s2.data ());
+	}
+
+	return total;
+}
+
+/* reachability: a breadth-first search on the adjacency lists, with an array of visited nodes */
+size_t reach (const Graph& g)
+{
+	size_t n = g.num_vertices ();
+	size_t total = 0;
+
+	for (int k = 0; k < NUM_SOURCES; k++)
+	{
+		std::vector<char> seen (n, 0);
+		std::vector<size_t> queue (1, k);
+		seen [k] = 1;
+
+		for (size_t i = 0; i < queue.size (); i++)
+		{
+			const Graph::node& node = g.get_node_by_id (queue [i]);
+
+			for (Graph::adjlist::const_iterator it = node.adjlist ().begin (); it != node.adjlist ().end (); ++it)
+			{
+				if (! seen [it->node ().id ()])
+				{
+					seen [it->node ().id ()] = 1;
+					queue.push_back (it->node ().id ());
+				}
+			}
+		}
+
+		total += queue.size ();
+	}
+
+	return total;
+}
+
+size_t reach (const DenseGraph& g)
+{
+	size_t total = 0;
+	cgt::base::bitset s;
+
+	for (int k = 0; k < NUM_SOURCES; k++)
+	{
+		g.reachable (g.get_node_by_id (k), s);
+		total += s.count ();
+	}
+
+	return total;
+}
+
+template<typename _TpGraph>
+	void run (const char* name, const int& n, const int& density)
+	{
+		BenchTimer timer;
+		double tBuild, tTests, tCommon, tReach;
+		size_t found, common, reached;
+
+		{
+			_TpGraph g;
+			build (g, n, density);
+			tBuild = timer.elapsed ();
+
+			timer.reset ();
+			found = test_edges (g);
+			tTests = timer.elapsed ();
+
+			timer.reset ();
+			common = common_neighbours (g);
+			tCommon = timer.elapsed ();
+		}
+
+		{
+			_TpGraph g;
+			build (g, n, density / 100 > 0 ? density / 100 : 1);
+
+			timer.reset ();
+			reached = reach (g);
+			tReach = timer.elapsed ();
+		}
+
+		std::cout << std::setw (8) << name << std::setw (12) << tBuild << std::setw (16) << tTests << std::setw (18) << tCommon << std::setw (16) << tReach
+			<< "   (" << found << " edges found, " << common << " common, " << reached << " reached)" << std::endl;
+	}
+
+int main (int argc, char* argv[])
+{
+	int n = (argc > 1 ? atoi (argv[1]) : 2000);
+	int density = (argc > 2 ? 10 * atoi (argv[2]) : 300);
+
+	std::cout << "run: " << argv[0] << " [vertices] [density %] (default: 2000 30)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (8) << "graph" << std::setw (12) << "build (ms)" << std::setw (16) << "edge tests (ms)"
+		<< std::setw (18) << "common nbrs (ms)" << std::setw (16) << "reachable (ms)" << std::endl;
+
+	run<Graph> ("lists", n, density);
+	run<DenseGraph> ("matrix", n, density);
+
+	return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/djpathbench.cpp
+ * \brief Compares the dijkstra iterator with the point-to-point dijkstra searches (graph::djpath)
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a grid of <side> x <side> vertices (default: 300), like a road
+ * network, where each vertex has edges to and from its right and bottom
+ * neighbours with random values from 1 to 100, and finds the distance
+ * between <pairs> random pairs of vertices (default: 100): with the
+ * djiterator until the target comes out, with djpath::run, which stops
+ * at the target, and with djpath::run_bidirectional. It prints the time
+ * of each one and the number of nodes taken per pair.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+int main (int argc, char* argv[])
+{
+	int side = (argc > 1 ? atoi (argv[1]) : 300);
+	int pairs = (argc > 2 ? atoi (argv[2]) : 100);
+	int n = side * side;
+
+	std::cout << "run: " << argv[0] << " [side] [pairs] (default: 300 100)" << std::endl << std::endl;
+
+	Graph g;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (1);
+	for (int r = 0; r < side; r++)
+	{
+		for (int c = 0; c < side; c++)
+		{
+			int i = r * side + c;
+			int right = 1 + rand () % 100;
+			int down = 1 + rand () % 100;
+
+			if (c + 1 < side)
+			{
+				g.insert_edge (right, its [i], its [i + 1]);
+				g.insert_edge (right, its [i + 1], its [i]);
+			}
+
+			if (r + 1 < side)
+			{
+				g.insert_edge (down, its [i], its [i + side]);
+				g.insert_edge (down, its [i + side], its [i]);
+			}
+		}
+	}
+
+	std::vector<int> sources, targets;
+
+	for (int k = 0; k < pairs; k++)
+	{
+		sources.push_back (rand () % n);
+		targets.push_back (rand () % n);
+	}
+
+	BenchTimer timer;
+	long sumIter = 0;
+	size_t takenIter = 0;
+
+	for (int k = 0; k < pairs; k++)
+	{
+		const Graph::node* target = &(*its [targets [k]]);
+
+		for (Graph::djiterator it = g.djbegin (its [sources [k]]); it != g.djend (); ++it)
+		{
+			takenIter++;
+
+			if (&(*it) == target)
+			{
+				sumIter += it.info (*it)->distance ();
+				break;
+			}
+		}
+	}
+
+	double tIter = timer.elapsed ();
+
+	Graph::djpath p = g.djpath_init ();
+	long sumRun = 0, sumBidir = 0;
+	size_t takenRun = 0, takenBidir = 0;
+
+	timer.reset ();
+	for (int k = 0; k < pairs; k++)
+	{
+		p.run (*its [sources [k]], *its [targets [k]]);
+		sumRun += p.distance ();
+		takenRun += p.settled ();
+	}
+	double tRun = timer.elapsed ();
+
+	timer.reset ();
+	for (int k = 0; k < pairs; k++)
+	{
+		p.run_bidirectional (*its [sources [k]], *its [targets [k]]);
+		sumBidir += p.distance ();
+		takenBidir += p.settled ();
+	}
+	double tBidir = timer.elapsed ();
+
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (16) << "search" << std::setw (12) << "time (ms)" << std::setw (18) << "nodes per pair" << std::endl;
+	std::cout << std::setw (16) << "djiterator" << std::setw (12) << tIter << std::setw (18) << takenIter / pairs << std::endl;
+	std::cout << std::setw (16) << "run" << std::setw (12) << tRun << std::setw (18) << takenRun / pairs << std::endl;
+	std::cout << std::setw (16) << "bidirectional" << std::setw (12) << tBidir << std::setw (18) << takenBidir / pairs << std::endl;
+	std::cout << std::endl << "distances: " << (sumIter == sumRun && sumRun == sumBidir ? "same" : "DIFFERENT") << std::endl;
+
+	return 0;
+}
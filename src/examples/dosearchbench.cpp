@@ -0,0 +1,143 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/dosearchbench.cpp
+ * \brief Compares the direction-optimizing breadth-first search with the biterator on R-MAT graphs
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds an undirected R-MAT graph (a = 0.57, b = c = 0.19) with
+ * 2 ^ <scale> vertices (default: 16) and 8 edges per vertex, like the
+ * Graph500 graphs: a small diameter, and a few levels that hold most
+ * of the nodes. Then it runs breadth-first searches from 8 nodes (with
+ * edges) with the biterator (a local search, see graph::bbegin (it,
+ * workspace)), with graph::dosearch kept top-down (alpha 0), and with
+ * graph::dosearch switching directions, and prints the time of each one.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Undirected, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 8;
+static const int NUM_SOURCES = 8;
+
+/* a vertex of the R-MAT graph: each bit chooses a quadrant of the adjacency matrix */
+void rmat_edge (const int& scale, int& u, int& v)
+{
+	u = v = 0;
+
+	for (int i = 0; i < scale; i++)
+	{
+		int r = rand () % 100;
+		int bu = (r >= 76);                 /* c + d: 0.19 + 0.05 */
+		int bv = (r >= 57 && r < 76) || (r >= 95);
+
+		u |= (bu << i);
+		v |= (bv << i);
+	}
+}
+
+int main (int argc, char* argv[])
+{
+	int scale = (argc > 1 ? atoi (argv[1]) : 16);
+	int n = (1 << scale);
+
+	std::cout << "run: " << argv[0] << " [scale] (default: 16)" << std::endl << std::endl;
+
+	Graph g;
+	std::vector<Graph::iterator> its;
+	BenchTimer timer;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (1);
+	for (int i = 0; i < n * EDGES_PER_VERTEX; i++)
+	{
+		int u, v;
+		rmat_edge (scale, u, v);
+		g.insert_edge (i, its [u], its [v]);
+	}
+
+	std::cout << "R-MAT graph: " << n << " vertices, " << n * EDGES_PER_VERTEX << " edges, built in " << timer.elapsed () << " ms" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (10) << "source" << std::setw (10) << "reached" << std::setw (18) << "biterator (ms)"
+		<< std::setw (18) << "top-down (ms)" << std::setw (18) << "dosearch (ms)" << std::setw (12) << "speedup" << std::setw (14) << "steps (td/bu)" << std::endl;
+
+	Graph::search_workspace ws;
+	Graph::dosearch td = g.dosearch_init ();
+	Graph::dosearch s = g.dosearch_init ();
+	double tTotalB = 0, tTotalT = 0, tTotalD = 0;
+
+	td.set_alpha (0);
+
+	srand (2);
+	for (int k = 0; k < NUM_SOURCES; k++)
+	{
+		Graph::iterator itSource = its [rand () % n];
+
+		while (itSource->adjlist ().empty ())
+			itSource = its [rand () % n];
+
+		size_t reached = 0;
+
+		timer.reset ();
+		for (Graph::biterator it = g.bbegin (itSource, ws); it != g.bend (); ++it)
+			reached++;
+
+		double tB = timer.elapsed ();
+
+		timer.reset ();
+		td.run (*itSource);
+		double tT = timer.elapsed ();
+
+		timer.reset ();
+		s.run (*itSource);
+		double tD = timer.elapsed ();
+
+		tTotalB += tB;
+		tTotalT += tT;
+		tTotalD += tD;
+
+		std::cout << std::setw (10) << itSource->vertex ().value () << std::setw (10) << reached << std::setw (18) << tB
+			<< std::setw (18) << tT << std::setw (18) << tD << std::setw (12) << tB / tD << std::setw (10) << s.top_down_steps () << "/" << s.bottom_up_steps () << std::endl;
+
+		if (reached != s.size () || reached != td.size ())
+			std::cout << "error: " << s.size () << " nodes reached by dosearch" << std::endl;
+	}
+
+	std::cout << std::endl << "total: " << tTotalB << " ms (biterator), " << tTotalT << " ms (top-down), " << tTotalD << " ms (dosearch), speedup " << tTotalB / tTotalD << std::endl;
+
+	return 0;
+}
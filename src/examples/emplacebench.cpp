@@ -0,0 +1,165 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/emplacebench.cpp
+ * \brief Compares inserting copies of vertices and edges with building them in place
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a graph with <vertices> vertices (default: 200000), named by
+ * strings of about 40 characters, and 8 edges per vertex, whose values
+ * have a label and an array of weights. It's built twice: with the
+ * C++98 methods (insert_vertex () and insert_edge () copy each value into
+ * the graph), and with the C++11 ones (vertices are moved into their nodes,
+ * and edges are built in place by emplace_edge ()). Built as C++98, only
+ * the first one runs.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+/* FNV-1a on the characters of the string (cgt::base::_HashFunc hashes the bytes of the object) */
+struct StringHash
+{
+	const size_t operator()(const std::string& _s) const
+	{
+		size_t _h = 2166136261u;
+
+		for (size_t i = 0; i < _s.size (); i++)
+			_h = (_h ^ static_cast<unsigned char>(_s [i])) * 16777619u;
+
+		return _h;
+	}
+};
+
+/* a heavy edge value: building it allocates twice */
+struct Payload
+{
+	Payload (const char* _tag, const int& _i, const int& _n) : label (_tag), weights (_n, 1.0 * _i)
+	{
+		char _buf [16];
+		sprintf (_buf, "%d", _i);
+		label += _buf;
+	}
+
+	const bool operator==(const Payload& _p) const { return (label == _p.label && weights == _p.weights); }
+
+	std::string         label;
+	std::vector<double> weights;
+};
+
+typedef cgt::graph<std::string, Payload, cgt::_Directed, StringHash> Graph;
+
+static const int EDGES_PER_VERTEX = 8;
+static const int WEIGHTS = 16;
+
+std::string name (const int& i)
+{
+	char _buf [64];
+	sprintf (_buf, "a-vertex-named-by-a-long-string-%08d", i);
+	return std::string (_buf);
+}
+
+void run_copy (const int& n, std::vector<int>& targets)
+{
+	BenchTimer timer;
+	Graph g;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+	{
+		std::string v = name (i);
+		its.push_back (g.insert_vertex (v));
+	}
+
+	double tVertex = timer.elapsed ();
+
+	timer.reset ();
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < EDGES_PER_VERTEX; j++)
+		{
+			Payload p ("edge-with-a-long-label-", j, WEIGHTS);
+			g.insert_edge (p, its [i], its [targets [i * EDGES_PER_VERTEX + j]]);
+		}
+
+	double tEdge = timer.elapsed ();
+
+	std::cout << std::setw (10) << "copy" << std::setw (16) << tVertex << std::setw (16) << tEdge << std::endl;
+}
+
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+void run_emplace (const int& n, std::vector<int>& targets)
+{
+	BenchTimer timer;
+	Graph g;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (name (i)));
+
+	double tVertex = timer.elapsed ();
+
+	timer.reset ();
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < EDGES_PER_VERTEX; j++)
+			g.emplace_edge (its [i], its [targets [i * EDGES_PER_VERTEX + j]], "edge-with-a-long-label-", j, WEIGHTS);
+
+	double tEdge = timer.elapsed ();
+
+	std::cout << std::setw (10) << "emplace" << std::setw (16) << tVertex << std::setw (16) << tEdge << std::endl;
+}
+#endif
+
+int main (int argc, char* argv[])
+{
+	int n = (argc > 1 ? atoi (argv[1]) : 200000);
+
+	std::vector<int> targets;
+	srand (1);
+	for (int i = 0; i < n * EDGES_PER_VERTEX; i++)
+		targets.push_back (rand () % n);
+
+	std::cout << "run: " << argv[0] << " [vertices] (default: 200000)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (10) << "insert" << std::setw (16) << "vertices (ms)" << std::setw (16) << "edges (ms)" << std::endl;
+
+	run_copy (n, targets);
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+	run_emplace (n, targets);
+#else
+	std::cout << "(built as C++98: no emplace)" << std::endl;
+#endif
+
+	return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/graphallocbench.cpp
+ * \brief Measures the time to build and destroy graphs, and the memory they take
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds graphs with 8 edges per vertex, destroys them, and prints the
+ * time spent in each step, the peak resident set size (RSS) and the RSS
+ * after each graph is destroyed. Each size is built twice, so the second
+ * round shows whether the memory of the first one was given back.
+ *
+ * It's built twice: \b graphallocbench, where each graph allocates its
+ * nodes, edges and adjacencies from its own arena, and
+ * \b graphallocbench_noarena (built with CGTL_DO_NOT_USE_ARENA), where
+ * they come from the static storages shared by the whole process.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 8;
+
+int main (int argc, char* argv[])
+{
+	int maxVertices = (argc > 1 ? atoi (argv[1]) : 1000000);
+
+	std::cout << "run: " << argv[0] << " [max-vertices] (default: 1000000)" << std::endl << std::endl;
+#if defined (CGTL_DO_NOT_USE_STL) && ! defined (CGTL_DO_NOT_USE_ARENA)
+	std::cout << "allocation: per-graph arena" << std::endl << std::endl;
+#else
+	std::cout << "allocation: shared storage" << std::endl << std::endl;
+#endif
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (10) << "vertices" << std::setw (8) << "round" << std::setw (14) << "build (ms)"
+		<< std::setw (16) << "destroy (ms)" << std::setw (16) << "peak RSS (MB)" << std::setw (16) << "RSS after (MB)" << std::endl;
+
+	for (int n = 10000; n <= maxVertices; n *= 10)
+	{
+		for (int round = 1; round <= 2; round++)
+		{
+			BenchTimer timer;
+
+			Graph* g = new Graph ();
+			std::vector<Graph::iterator> its;
+
+			for (int i = 0; i < n; i++)
+				its.push_back (g->insert_vertex (i));
+
+			srand (round);
+			for (int i = 0; i < n; i++)
+				for (int j = 0; j < EDGES_PER_VERTEX; j++)
+					g->insert_edge (rand () % 100, its [i], its [rand () % n]);
+
+			double tBuild = timer.elapsed ();
+			its.clear ();
+
+			timer.reset ();
+			delete g;
+			double tDestroy = timer.elapsed ();
+
+			std::cout << std::setw (10) << n << std::setw (8) << round << std::setw (14) << tBuild << std::setw (16) << tDestroy
+				<< std::setw (16) << peak_rss_kb () / 1024.0 << std::setw (16) << current_rss_kb () / 1024.0 << std::endl;
+		}
+	}
+
+	return 0;
+}
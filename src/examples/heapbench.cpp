@@ -0,0 +1,127 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/heapbench.cpp
+ * \brief Measures Dijkstra and Prim iterators on a grid, like a road network
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a grid of <side> x <side> vertices (default: 300), where each
+ * vertex has an edge to its right and bottom neighbours with a random value
+ * from 1 to 100, as a directed graph (edges both ways) and as an undirected
+ * one, and measures a whole run of the djiterator from a corner of the
+ * first and of the piterator on the second. Both keep the nodes reached
+ * but not taken yet in a cgt::base::indexed_heap.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> >    DGraph;
+typedef cgt::graph<int, int, cgt::_Undirected, cgt::base::_HashFunc<int> >  UGraph;
+
+template<typename _TpGraph>
+	void build (_TpGraph& g, const int& side, const bool& both)
+	{
+		std::vector<typename _TpGraph::iterator> its;
+
+		for (int i = 0; i < side * side; i++)
+			its.push_back (g.insert_vertex (i));
+
+		srand (1);
+		for (int r = 0; r < side; r++)
+		{
+			for (int c = 0; c < side; c++)
+			{
+				int i = r * side + c;
+				int right = 1 + rand () % 100;
+				int down = 1 + rand () % 100;
+
+				if (c + 1 < side)
+				{
+					g.insert_edge (right, its [i], its [i + 1]);
+
+					if (both)
+						g.insert_edge (right, its [i + 1], its [i]);
+				}
+
+				if (r + 1 < side)
+				{
+					g.insert_edge (down, its [i], its [i + side]);
+
+					if (both)
+						g.insert_edge (down, its [i + side], its [i]);
+				}
+			}
+		}
+	}
+
+int main (int argc, char* argv[])
+{
+	int side = (argc > 1 ? atoi (argv[1]) : 300);
+
+	std::cout << "run: " << argv[0] << " [side] (default: 300)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+
+	{
+		DGraph g;
+		build (g, side, true);
+
+		BenchTimer timer;
+		size_t n = 0;
+		DGraph::djiterator it = g.djbegin ();
+
+		for (; it != g.djend (); ++it)
+			n++;
+
+		double t = timer.elapsed ();
+		const DGraph::dijkstra_info* info = it.info (g.get_node_by_id (side * side - 1));
+
+		std::cout << "dijkstra: " << t << " ms (" << n << " nodes, distance to the far corner: " << info->distance () << ")" << std::endl;
+	}
+
+	{
+		UGraph g;
+		build (g, side, false);
+
+		BenchTimer timer;
+		size_t n = 0;
+		long total = 0;
+
+		for (UGraph::piterator it = g.pbegin (); it != g.pend (); ++it, n++)
+			total += it->value ();
+
+		std::cout << "prim:     " << timer.elapsed () << " ms (" << n << " edges, weight " << total << ")" << std::endl;
+	}
+
+	return 0;
+}
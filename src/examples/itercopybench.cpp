@@ -0,0 +1,116 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/itercopybench.cpp
+ * \brief Measures the cost of copying the iterators of breadth-first search, depth-first search and Dijkstra
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a random directed graph with <vertices> vertices (default: 2000)
+ * and 4 edges per vertex, and runs each search twice: with \b ++it only,
+ * and keeping a copy of the iterator before each step (as \b it++ does,
+ * or a function that takes iterators by value). A copy shares the state
+ * of the search, so both columns should be close; before, each copy took
+ * the whole state of the search (O(V) per step).
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 4;
+
+template<typename _TpIterator>
+	size_t walk (_TpIterator it, const _TpIterator& itEnd, const bool& copy)
+	{
+		size_t total = 0;
+
+		while (it != itEnd)
+		{
+			if (copy)
+			{
+				_TpIterator itPrev = it;
+				++it;
+				total += itPrev->vertex ().value ();
+			}
+			else
+			{
+				total += it->vertex ().value ();
+				++it;
+			}
+		}
+
+		return total;
+	}
+
+template<typename _TpIterator>
+	void run (const char* name, const _TpIterator& itBegin, const _TpIterator& itBegin2, const _TpIterator& itEnd)
+	{
+		BenchTimer timer;
+		size_t s1 = walk (itBegin, itEnd, false);
+		double tStep = timer.elapsed ();
+
+		timer.reset ();
+		size_t s2 = walk (itBegin2, itEnd, true);
+		double tCopy = timer.elapsed ();
+
+		std::cout << std::setw (10) << name << std::setw (14) << tStep << std::setw (18) << tCopy
+			<< "   (" << (s1 == s2 ? "same nodes" : "DIFFERENT nodes") << ")" << std::endl;
+	}
+
+int main (int argc, char* argv[])
+{
+	int n = (argc > 1 ? atoi (argv[1]) : 2000);
+
+	std::cout << "run: " << argv[0] << " [vertices] (default: 2000)" << std::endl << std::endl;
+
+	Graph g;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (1);
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < EDGES_PER_VERTEX; j++)
+			g.insert_edge (1 + rand () % 100, its [i], its [rand () % n]);
+
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (10) << "search" << std::setw (14) << "++it (ms)" << std::setw (18) << "copy + ++it (ms)" << std::endl;
+
+	run ("breadth", g.bbegin (), g.bbegin (), g.bend ());
+	run ("depth", g.dbegin (), g.dbegin (), g.dend ());
+	run ("dijkstra", g.djbegin (), g.djbegin (), g.djend ());
+
+	return 0;
+}
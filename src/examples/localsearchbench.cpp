@@ -0,0 +1,114 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/localsearchbench.cpp
+ * \brief Compares local breadth-first searches with and without a search workspace
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds random directed graphs with 4 edges per vertex, from 1000 up to
+ * <max-vertices> vertices (default: 1000000), and runs 100 local queries
+ * on each: a breadth-first search from a random node that stops after
+ * visiting 64 nodes. The queries start with bbegin (it), which paints
+ * every node of the graph before the first step, and with
+ * bbegin (it, workspace), which creates the state of the nodes as they
+ * are discovered, reusing one workspace for all the queries. The time of
+ * the first grows with the graph, and the time of the second shouldn't.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 4;
+static const int NUM_QUERIES = 100;
+static const int NODES_PER_QUERY = 64;
+
+int main (int argc, char* argv[])
+{
+	int maxVertices = (argc > 1 ? atoi (argv[1]) : 1000000);
+
+	std::cout << "run: " << argv[0] << " [max-vertices] (default: 1000000)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (4);
+	std::cout << std::setw (10) << "vertices" << std::setw (22) << "full (ms/query)" << std::setw (22) << "workspace (ms/query)" << std::endl;
+
+	for (int n = 1000; n <= maxVertices; n *= 10)
+	{
+		Graph g;
+		std::vector<Graph::iterator> its;
+
+		for (int i = 0; i < n; i++)
+			its.push_back (g.insert_vertex (i));
+
+		srand (1);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < EDGES_PER_VERTEX; j++)
+				g.insert_edge (j, its [i], its [rand () % n]);
+
+		size_t visitedFull = 0;
+		size_t visitedLocal = 0;
+		BenchTimer timer;
+
+		srand (2);
+		for (int q = 0; q < NUM_QUERIES; q++)
+		{
+			Graph::biterator it = g.bbegin (its [rand () % n]);
+
+			for (int k = 0; k < NODES_PER_QUERY && it != g.bend (); ++it, k++)
+				visitedFull++;
+		}
+
+		double tFull = timer.elapsed ();
+
+		Graph::search_workspace ws;
+
+		timer.reset ();
+		srand (2);
+		for (int q = 0; q < NUM_QUERIES; q++)
+		{
+			Graph::biterator it = g.bbegin (its [rand () % n], ws);
+
+			for (int k = 0; k < NODES_PER_QUERY && it != g.bend (); ++it, k++)
+				visitedLocal++;
+		}
+
+		double tLocal = timer.elapsed ();
+
+		std::cout << std::setw (10) << n << std::setw (22) << tFull / NUM_QUERIES << std::setw (22) << tLocal / NUM_QUERIES << std::endl;
+
+		if (visitedFull != visitedLocal)
+			std::cout << "error: " << visitedFull << " and " << visitedLocal << " nodes visited" << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/mssearchbench.cpp
+ * \brief Compares breadth-first searches of many sources one by one and in bit-parallel batches
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a random directed graph with <vertices> vertices (default:
+ * 100000) and 8 edges per vertex, and computes, for <sources> random
+ * sources (default: 512), the number of nodes each one reaches and the
+ * sum of their distances: with a local biterator from each source (see
+ * graph::bbegin (it, workspace)), and with graph::mssearch in batches of
+ * 64, 256 and 512 sources. It also times a single breadth-first search
+ * from all the sources at once (graph::bbegin (first, last, workspace)),
+ * which gives the distance to the nearest source.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 8;
+
+int main (int argc, char* argv[])
+{
+	int n = (argc > 1 ? atoi (argv[1]) : 100000);
+	int numSources = (argc > 2 ? atoi (argv[2]) : 512);
+
+	std::cout << "run: " << argv[0] << " [vertices] [sources] (default: 100000 512)" << std::endl << std::endl;
+
+	Graph g;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (1);
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < EDGES_PER_VERTEX; j++)
+			g.insert_edge (j, its [i], its [rand () % n]);
+
+	std::vector<Graph::iterator> sources;
+
+	for (int i = 0; i < numSources; i++)
+		sources.push_back (its [rand () % n]);
+
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (24) << "search" << std::setw (14) << "time (ms)" << std::setw (12) << "speedup" << std::setw (20) << "sum of distances" << std::endl;
+
+	/* one local biterator from each source */
+
+	Graph::search_workspace ws;
+	std::vector<size_t> level (n, 0);
+	unsigned long sumB = 0;
+	BenchTimer timer;
+
+	for (int i = 0; i < numSources; i++)
+	{
+		/* a parent is visited before its children, so its level is already set */
+
+		for (Graph::biterator it = g.bbegin (sources [i], ws); it != g.bend (); ++it)
+		{
+			const Graph::node* parent = it.info (*it)->parent ();
+
+			level [it->id ()] = (parent ? level [parent->id ()] + 1 : 0);
+			sumB += level [it->id ()];
+		}
+	}
+
+	double tB = timer.elapsed ();
+
+	std::cout << std::setw (24) << "biterator x sources" << std::setw (14) << tB << std::setw (12) << 1.0 << std::setw (20) << sumB << std::endl;
+
+	/* batches of 64 * w sources */
+
+	for (size_t w = 1; w <= 8; w = (w == 1 ? 4 : 2 * w))
+	{
+		Graph::mssearch s = g.mssearch_init (w);
+		unsigned long sum = 0;
+
+		timer.reset ();
+		for (size_t first = 0; first < sources.size (); first += s.capacity ())
+		{
+			size_t last = (first + s.capacity () < sources.size () ? first + s.capacity () : sources.size ());
+			s.run (sources.begin () + first, sources.begin () + last);
+
+			for (size_t i = 0; i < s.num_sources (); i++)
+				sum += s.distance_sum (i);
+		}
+
+		double t = timer.elapsed ();
+
+		std::cout << std::setw (16) << "mssearch (" << std::setw (3) << s.capacity () << ")" << std::setw (14) << t
+			<< std::setw (12) << tB / t << std::setw (20) << sum << std::endl;
+
+		if (sum != sumB)
+			std::cout << "error: the sums of distances differ" << std::endl;
+	}
+
+	/* all the sources at once: the nearest one */
+
+	size_t reached = 0;
+
+	timer.reset ();
+	for (Graph::biterator it = g.bbegin (sources.begin (), sources.end (), ws); it != g.bend (); ++it)
+		reached++;
+
+	std::cout << std::endl << "one search from all the sources: " << timer.elapsed () << " ms, " << reached << " nodes reached" << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/psearchbench.cpp
+ * \brief Measures the parallel breadth-first search with a growing number of threads
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a random directed graph with <vertices> vertices (default:
+ * 500000) and 8 edges per vertex, and searches it from the same node with
+ * the biterator (a local search, see graph::bbegin (it, workspace)) and
+ * with graph::psearch, with 1, 2, 4, ... up to <max-threads> threads
+ * (default: the number of processors online). Each search runs 3 times,
+ * and the best time is printed, with the speedup over 1 thread.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <unistd.h>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 8;
+static const int NUM_RUNS = 3;
+
+int main (int argc, char* argv[])
+{
+	int n = (argc > 1 ? atoi (argv[1]) : 500000);
+	int maxThreads = (argc > 2 ? atoi (argv[2]) : static_cast<int>(sysconf (_SC_NPROCESSORS_ONLN)));
+
+	std::cout << "run: " << argv[0] << " [vertices] [max-threads] (default: 500000 <processors>)" << std::endl << std::endl;
+
+	Graph g;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (1);
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < EDGES_PER_VERTEX; j++)
+			g.insert_edge (j, its [i], its [rand () % n]);
+
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (12) << "search" << std::setw (10) << "threads" << std::setw (12) << "time (ms)"
+		<< std::setw (10) << "speedup" << std::setw (10) << "reached" << std::endl;
+
+	Graph::search_workspace ws;
+	double tBest = 0;
+	size_t reached = 0;
+
+	for (int r = 0; r < NUM_RUNS; r++)
+	{
+		BenchTimer timer;
+		reached = 0;
+
+		for (Graph::biterator it = g.bbegin (its [0], ws); it != g.bend (); ++it)
+			reached++;
+
+		double t = timer.elapsed ();
+		tBest = (r == 0 || t < tBest ? t : tBest);
+	}
+
+	std::cout << std::setw (12) << "biterator" << std::setw (10) << 1 << std::setw (12) << tBest << std::setw (10) << "" << std::setw (10) << reached << std::endl;
+
+	double tOne = 0;
+
+	for (int t = 1; t <= maxThreads; t *= 2)
+	{
+		Graph::psearch s = g.psearch_init (t);
+
+		for (int r = 0; r < NUM_RUNS; r++)
+		{
+			BenchTimer timer;
+			s.run (*its [0]);
+
+			double tRun = timer.elapsed ();
+			tBest = (r == 0 || tRun < tBest ? tRun : tBest);
+		}
+
+		if (t == 1)
+			tOne = tBest;
+
+		std::cout << std::setw (12) << "psearch" << std::setw (10) << t << std::setw (12) << tBest
+			<< std::setw (10) << tOne / tBest << std::setw (10) << s.size () << std::endl;
+
+		if (s.size () != reached)
+			std::cout << "error: " << s.size () << " nodes reached" << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/queuebench.cpp
+ * \brief Compares the queues of Dijkstra Algorithm for signed and unsigned edges
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a grid of <side> x <side> vertices (default: 300), like a road
+ * network, where each vertex has edges to and from its right and bottom
+ * neighbours with random values from 1 to 100, with edges of type int
+ * (kept by Dijkstra Algorithm in a cgt::base::indexed_heap), unsigned int
+ * (in a cgt::base::radix_heap) and unsigned short (in Dial's buckets, a
+ * cgt::base::bucket_queue), and measures a whole run of the djiterator
+ * from a corner and <pairs> searches between random pairs of vertices
+ * with djpath::run (default: 50). With the default side, distances fit
+ * in an unsigned short.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+template<typename _TpGraph>
+	void build (_TpGraph& g, const int& side)
+	{
+		std::vector<typename _TpGraph::iterator> its;
+
+		for (int i = 0; i < side * side; i++)
+			its.push_back (g.insert_vertex (i));
+
+		srand (1);
+		for (int r = 0; r < side; r++)
+		{
+			for (int c = 0; c < side; c++)
+			{
+				int i = r * side + c;
+				int right = 1 + rand () % 100;
+				int down = 1 + rand () % 100;
+
+				if (c + 1 < side)
+				{
+					g.insert_edge (right, its [i], its [i + 1]);
+					g.insert_edge (right, its [i + 1], its [i]);
+				}
+
+				if (r + 1 < side)
+				{
+					g.insert_edge (down, its [i], its [i + side]);
+					g.insert_edge (down, its [i + side], its [i]);
+				}
+			}
+		}
+	}
+
+template<typename _TpEdge>
+	void run (const char* name, const int& side, const int& pairs)
+	{
+		typedef cgt::graph<int, _TpEdge, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+		Graph g;
+		build (g, side);
+
+		BenchTimer timer;
+		typename Graph::djiterator it = g.djbegin ();
+
+		while (it != g.djend ())
+			++it;
+
+		double tIter = timer.elapsed ();
+		long far = it.info (g.get_node_by_id (side * side - 1))->distance ();
+
+		typename Graph::djpath p = g.djpath_init ();
+		int n = side * side;
+		long total = 0;
+
+		srand (2);
+		timer.reset ();
+		for (int k = 0; k < pairs; k++)
+		{
+			p.run (g.get_node_by_id (rand () % n), g.get_node_by_id (rand () % n));
+			total += p.distance ();
+		}
+
+		double tPath = timer.elapsed ();
+
+		std::cout << std::setw (16) << name << std::setw (18) << tIter << std::setw (16) << tPath << "   (far corner: " << far << ", sum of distances: " << total << ")" << std::endl;
+	}
+
+int main (int argc, char* argv[])
+{
+	int side = (argc > 1 ? atoi (argv[1]) : 300);
+	int pairs = (argc > 2 ? atoi (argv[2]) : 50);
+
+	std::cout << "run: " << argv[0] << " [side] [pairs] (default: 300 50)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (16) << "edges" << std::setw (18) << "djiterator (ms)" << std::setw (16) << "djpath (ms)" << std::endl;
+
+	run<int> ("int", side, pairs);
+	run<unsigned int> ("unsigned int", side, pairs);
+	run<unsigned short> ("unsigned short", side, pairs);
+
+	return 0;
+}
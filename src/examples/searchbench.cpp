@@ -0,0 +1,97 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/searchbench.cpp
+ * \brief Measures breadth-first and depth-first searches of growing graphs
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds random directed graphs with 4 edges per vertex, from 1000 up to
+ * <max-vertices> vertices (default: 1000000), and measures a breadth-first
+ * and a depth-first search of each whole graph (biterator and diterator).
+ * Both are O(V + E), so the time per vertex and edge should stay about the
+ * same as the graphs grow.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 4;
+
+int main (int argc, char* argv[])
+{
+	int maxVertices = (argc > 1 ? atoi (argv[1]) : 1000000);
+
+	std::cout << "run: " << argv[0] << " [max-vertices] (default: 1000000)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (10) << "vertices" << std::setw (14) << "breadth (ms)" << std::setw (14) << "depth (ms)"
+		<< std::setw (22) << "breadth (ns/(V+E))" << std::setw (20) << "depth (ns/(V+E))" << std::endl;
+
+	for (int n = 1000; n <= maxVertices; n *= 10)
+	{
+		Graph g;
+		std::vector<Graph::iterator> its;
+
+		for (int i = 0; i < n; i++)
+			its.push_back (g.insert_vertex (i));
+
+		srand (1);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < EDGES_PER_VERTEX; j++)
+				g.insert_edge (j, its [i], its [rand () % n]);
+
+		size_t visited = 0;
+		BenchTimer timer;
+
+		for (Graph::biterator it = g.bbegin (); it != g.bend (); ++it)
+			visited++;
+
+		double tBreadth = timer.elapsed ();
+
+		timer.reset ();
+		for (Graph::diterator it = g.dbegin (); it != g.dend (); ++it)
+			visited++;
+
+		double tDepth = timer.elapsed ();
+		double size = n * (1.0 + EDGES_PER_VERTEX);
+
+		std::cout << std::setw (10) << n << std::setw (14) << tBreadth << std::setw (14) << tDepth
+			<< std::setw (22) << 1e6 * tBreadth / size << std::setw (20) << 1e6 * tDepth / size << std::endl;
+
+		if (visited != 2 * static_cast<size_t>(n))
+			std::cout << "error: " << visited << " nodes visited" << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/stringkeybench.cpp
+ * \brief Compares traversals of graphs whose vertices are integers and strings
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds the same random directed graph with <vertices> vertices (default:
+ * 3000) and 4 edges per vertex twice: with int vertices, and with string
+ * vertices that share a long prefix (so comparing two of them is slow).
+ * Then it measures a depth-first and a breadth-first search of the whole
+ * graph, and a topological sort of a DAG built the same way. Iterators
+ * compare nodes by identity, never vertices by value, so both graphs
+ * should take about the same time.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+static const int EDGES_PER_VERTEX = 4;
+
+int key (const int& i, int*) { return i; }
+
+std::string key (const int& i, std::string*)
+{
+	char _buf [80];
+	sprintf (_buf, "a-vertex-whose-name-shares-a-long-prefix-with-the-others-%08d", i);
+	return std::string (_buf);
+}
+
+/* random edges, from smaller to bigger ids if \b dag is true */
+template<typename _TpGraph, typename _TpVertex>
+	void build (_TpGraph& g, const int& n, const bool& dag)
+	{
+		std::vector<typename _TpGraph::iterator> its;
+
+		for (int i = 0; i < n; i++)
+			its.push_back (g.insert_vertex (key (i, static_cast<_TpVertex*>(NULL))));
+
+		srand (1);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < EDGES_PER_VERTEX; j++)
+			{
+				int k = rand () % n;
+
+				if (! dag || i < k)
+					g.insert_edge (j, its [i], its [k]);
+			}
+	}
+
+template<typename _TpVertex>
+	void run (const char* name, const int& n)
+	{
+		typedef cgt::graph<_TpVertex, int> Graph;
+
+		BenchTimer timer;
+		double tDepth, tBreadth, tTopo;
+		size_t visited = 0;
+
+		{
+			Graph g;
+			build<Graph, _TpVertex> (g, n, false);
+
+			timer.reset ();
+			for (typename Graph::diterator it = g.dbegin (); it != g.dend (); ++it)
+				visited++;
+			tDepth = timer.elapsed ();
+
+			timer.reset ();
+			for (typename Graph::biterator it = g.bbegin (); it != g.bend (); ++it)
+				visited++;
+			tBreadth = timer.elapsed ();
+		}
+
+		{
+			Graph g;
+			build<Graph, _TpVertex> (g, n, true);
+
+			timer.reset ();
+			for (typename Graph::tsiterator it = g.tsbegin (); it != g.tsend (); ++it)
+				visited++;
+			tTopo = timer.elapsed ();
+		}
+
+		std::cout << std::setw (8) << name << std::setw (12) << tDepth << std::setw (14) << tBreadth << std::setw (14) << tTopo
+			<< "   (" << visited << " nodes visited)" << std::endl;
+	}
+
+int main (int argc, char* argv[])
+{
+	int n = (argc > 1 ? atoi (argv[1]) : 3000);
+
+	std::cout << "run: " << argv[0] << " [vertices] (default: 3000)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (8) << "vertex" << std::setw (12) << "depth (ms)" << std::setw (14) << "breadth (ms)" << std::setw (14) << "toposort (ms)" << std::endl;
+
+	run<int> ("int", n);
+	run<std::string> ("string", n);
+
+	return 0;
+}
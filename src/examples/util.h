@@ -10,7 +10,7 @@ using namespace std;
 
 namespace cgt
 {
-  template<typename _TpVertex, typename _TpEdge, typename _TpGraphType>
+  template<typename _TpVertex, typename _TpEdge, typename _TpGraphType, typename _TpVertexHash>
     class graph;
 }
 
@@ -0,0 +1,105 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/vertexindexbench.cpp
+ * \brief Compares vertex lookups with and without an index of vertices
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Measures insert_vertex, insert_edge (by vertices) and find for graphs
+ * with 10^4, 10^5 and 10^6 vertices (and 4 edges per vertex), with the
+ * default linear search and with a hashed index of vertices.
+ *
+ * The linear search is quadratic on the number of vertices, so it's only
+ * measured up to <max-scan-vertices> (default: 10000).
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int>                                             ScanGraph;
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > IndexGraph;
+
+static const int EDGES_PER_VERTEX = 4;
+
+template<typename _TpGraph>
+	void run (const char* name, int numVertices)
+	{
+		_TpGraph g;
+		BenchTimer timer;
+
+		for (int i = 0; i < numVertices; i++)
+			g.insert_vertex (i);
+
+		double tVertex = timer.elapsed ();
+
+		timer.reset ();
+		srand (1);
+		for (int i = 0; i < numVertices; i++)
+			for (int j = 0; j < EDGES_PER_VERTEX; j++)
+				g.insert_edge (j, i, rand () % numVertices);
+
+		double tEdge = timer.elapsed ();
+
+		timer.reset ();
+		size_t found = 0;
+		for (int i = 0; i < numVertices; i++)
+			if (g.find (static_cast<int>((static_cast<size_t>(i) * 7919) % numVertices)) != g.end ())
+				found++;
+
+		double tFind = timer.elapsed ();
+
+		std::cout << std::setw (8) << name << std::setw (10) << numVertices
+			<< std::setw (16) << tVertex << std::setw (16) << tEdge << std::setw (16) << tFind
+			<< "  (" << found << " found)" << std::endl;
+	}
+
+int main (int argc, char* argv[])
+{
+	int maxScan = (argc > 1 ? atoi (argv[1]) : 10000);
+
+	std::cout << "run: " << argv[0] << " [max-scan-vertices] (default: 10000)" << std::endl << std::endl;
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (8) << "lookup" << std::setw (10) << "vertices"
+		<< std::setw (16) << "vertices (ms)" << std::setw (16) << "edges (ms)" << std::setw (16) << "find (ms)" << std::endl;
+
+	for (int n = 10000; n <= 1000000; n *= 10)
+	{
+		if (n <= maxScan)
+			run<ScanGraph> ("scan", n);
+		else
+			std::cout << std::setw (8) << "scan" << std::setw (10) << n << "  skipped" << std::endl;
+
+		run<IndexGraph> ("index", n);
+	}
+
+	return 0;
+}
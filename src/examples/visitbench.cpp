@@ -0,0 +1,130 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file examples/visitbench.cpp
+ * \brief Compares search iterators with the visitor searches (breadth_first and depth_first)
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * Builds a random directed graph with <vertices> vertices (default:
+ * 1000000) and 4 edges per vertex, and counts the nodes with even values
+ * reachable from 10 nodes: with the biterator and the diterator (local
+ * searches, see graph::bbegin (it, workspace)), and with
+ * cgt::search::breadth_first and cgt::search::depth_first and a visitor
+ * that only counts, and prints the time of each one.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "cgt/graph.h"
+
+#include "bench_util.h"
+
+typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > Graph;
+
+static const int EDGES_PER_VERTEX = 4;
+static const int NUM_SOURCES = 10;
+
+/* counts the nodes with even values: the other hooks are the empty ones of graph::visitor */
+struct EvenCounter : public Graph::visitor
+{
+	EvenCounter () : count (0) { }
+
+	void discover (const Graph::node& node, const Graph::node* parent) { if (node.vertex ().value () % 2 == 0) count++; }
+
+	size_t count;
+};
+
+int main (int argc, char* argv[])
+{
+	int n = (argc > 1 ? atoi (argv[1]) : 1000000);
+
+	std::cout << "run: " << argv[0] << " [vertices] (default: 1000000)" << std::endl << std::endl;
+
+	Graph g;
+	std::vector<Graph::iterator> its;
+
+	for (int i = 0; i < n; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (1);
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < EDGES_PER_VERTEX; j++)
+			g.insert_edge (j, its [i], its [rand () % n]);
+
+	Graph::search_workspace ws;
+	Graph::visit_workspace vws;
+	BenchTimer timer;
+	size_t countB = 0, countD = 0, countBV = 0, countDV = 0;
+
+	for (int k = 0; k < NUM_SOURCES; k++)
+		for (Graph::biterator it = g.bbegin (its [k], ws); it != g.bend (); ++it)
+			if (it->vertex ().value () % 2 == 0)
+				countB++;
+
+	double tB = timer.elapsed ();
+
+	timer.reset ();
+	for (int k = 0; k < NUM_SOURCES; k++)
+		for (Graph::diterator it = g.dbegin (its [k], ws); it != g.dend (); ++it)
+			if (it->vertex ().value () % 2 == 0)
+				countD++;
+
+	double tD = timer.elapsed ();
+
+	timer.reset ();
+	for (int k = 0; k < NUM_SOURCES; k++)
+	{
+		EvenCounter c;
+		cgt::search::breadth_first (g, *its [k], c, vws);
+		countBV += c.count;
+	}
+
+	double tBV = timer.elapsed ();
+
+	timer.reset ();
+	for (int k = 0; k < NUM_SOURCES; k++)
+	{
+		EvenCounter c;
+		cgt::search::depth_first (g, *its [k], c, vws);
+		countDV += c.count;
+	}
+
+	double tDV = timer.elapsed ();
+
+	std::cout << std::fixed << std::setprecision (2);
+	std::cout << std::setw (10) << "search" << std::setw (16) << "iterator (ms)" << std::setw (16) << "visitor (ms)" << std::setw (12) << "speedup" << std::endl;
+	std::cout << std::setw (10) << "breadth" << std::setw (16) << tB << std::setw (16) << tBV << std::setw (12) << tB / tBV << std::endl;
+	std::cout << std::setw (10) << "depth" << std::setw (16) << tD << std::setw (16) << tDV << std::setw (12) << tD / tDV << std::endl;
+
+	if (countB != countBV || countD != countDV)
+		std::cout << "error: " << countB << "/" << countBV << " and " << countD << "/" << countDV << " nodes counted" << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/base/alloc/arena_cxx.h
+ * \brief Unit tests for the arena and for allocators bound to it.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_BASE_ALLOC_ARENA_CXX_H_
+#define __CGTL__CXXTEST_CGT_BASE_ALLOC_ARENA_CXX_H_
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/base/alloc/arena.h"
+#include "cgt/base/alloc/allocator.h"
+#include "cgt/base/list.h"
+
+
+class arena_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::base::alloc::_Arena _Arena;
+
+  private:
+    static const size_t align = cgt::base::alloc::_ARENA_ALIGN;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_basic ()
+    {
+      _Arena arena;
+
+      TS_ASSERT_EQUALS (arena._head, static_cast<_Arena::_Chunk*>(NULL));
+      TS_ASSERT_EQUALS (arena.capacity (), static_cast<size_t>(0));
+
+      char* p1 = static_cast<char *>(arena.allocate (3 * align));
+      char* p2 = static_cast<char *>(arena.allocate (3 * align - 1));
+
+      TS_ASSERT_EQUALS (arena.capacity (), cgt::base::alloc::_ARENA_CHUNK_SIZE);
+      TS_ASSERT_EQUALS (p1, reinterpret_cast<char *>(arena._head + 1));
+      TS_ASSERT_EQUALS (p2, p1 + 3 * align);
+    }
+
+    void test_reuse ()
+    {
+      _Arena arena;
+
+      void* p1 = arena.allocate (2 * align);
+      void* p2 = arena.allocate (4 * align);
+
+      arena.deallocate (p1, 2 * align);
+      arena.deallocate (p2, 4 * align);
+
+      TS_ASSERT_EQUALS (arena.allocate (4 * align), p2);
+      TS_ASSERT_EQUALS (arena.allocate (2 * align), p1);
+      TS_ASSERT_DIFFERS (arena.allocate (2 * align), p1);
+    }
+
+    void test_big_blocks ()
+    {
+      _Arena arena;
+
+      void* p = arena.allocate (cgt::base::alloc::_ARENA_MAX_BLOCK + 1);
+
+      TS_ASSERT_DIFFERS (p, static_cast<void *>(NULL));
+      TS_ASSERT_EQUALS (arena.capacity (), static_cast<size_t>(0));
+
+      arena.deallocate (p, cgt::base::alloc::_ARENA_MAX_BLOCK + 1);
+    }
+
+    void test_two_chunks ()
+    {
+      _Arena arena;
+
+      size_t n = cgt::base::alloc::_ARENA_CHUNK_SIZE / (4 * align);
+
+      char* p1 = static_cast<char *>(arena.allocate (4 * align));
+
+      for (size_t i = 1; i < n; i++)
+        arena.allocate (4 * align);
+
+      TS_ASSERT_EQUALS (arena.capacity (), cgt::base::alloc::_ARENA_CHUNK_SIZE);
+
+      char* p2 = static_cast<char *>(arena.allocate (4 * align));
+
+      TS_ASSERT_EQUALS (arena.capacity (), 2 * cgt::base::alloc::_ARENA_CHUNK_SIZE);
+      TS_ASSERT_EQUALS (p2, reinterpret_cast<char *>(arena._head + 1));
+      TS_ASSERT_EQUALS (reinterpret_cast<char *>(arena._head->_next + 1), p1);
+    }
+
+    void test_allocator ()
+    {
+      _Arena arena;
+
+      cgt::base::alloc::_Allocator<int> allocator (&arena);
+      cgt::base::alloc::_Allocator<double> other (allocator);
+
+      TS_ASSERT_EQUALS (other.arena (), &arena);
+      TS_ASSERT_EQUALS (cgt::base::alloc::_Allocator<int> ().arena (), static_cast<_Arena *>(NULL));
+
+      int* ptr = allocator.allocate (1);
+      allocator.construct (ptr, int (1));
+
+      TS_ASSERT_EQUALS (*ptr, 1);
+      TS_ASSERT_EQUALS (reinterpret_cast<char *>(ptr), reinterpret_cast<char *>(arena._head + 1));
+
+      allocator.destroy (ptr);
+      allocator.deallocate (ptr, 1);
+    }
+
+    void test_list ()
+    {
+      _Arena arena;
+
+      {
+        cgt::base::list<int> l1 ((cgt::base::alloc::_Allocator<cgt::base::_ListItem<int> > (&arena)));
+
+        for (int i = 0; i < 100; i++)
+          l1.push_back (i);
+
+        TS_ASSERT_EQUALS (arena.capacity (), cgt::base::alloc::_ARENA_CHUNK_SIZE);
+
+        cgt::base::list<int> l2 (l1);
+        cgt::base::list<int> l3;
+
+        cgt::base::list<int>::swap (l2, l3);
+
+        TS_ASSERT_EQUALS (l3.size (), static_cast<size_t>(100));
+        TS_ASSERT_EQUALS (l3.back (), 99);
+        TS_ASSERT_EQUALS (l2.size (), static_cast<size_t>(0));
+        TS_ASSERT_EQUALS (arena.capacity (), cgt::base::alloc::_ARENA_CHUNK_SIZE);
+      }
+
+      TS_ASSERT (arena._free [0] || arena._free [1] || arena._free [2] || arena._free [3]);
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_BASE_ALLOC_ARENA_CXX_H_
@@ -0,0 +1,122 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/base/array_cxx.h
+ * \brief Functional tests for cgt::base::array.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_BASE_ARRAY_CXX_H_
+#define __CGTL__CXXTEST_CGT_BASE_ARRAY_CXX_H_
+
+#include <cxxtest/TestSuite.h>
+#include <string>
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/base/array.h"
+
+
+class array_cxx : public CxxTest::TestSuite
+{
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_basic ()
+    {
+      cgt::base::array<int> a;
+      TS_ASSERT_EQUALS (a.size (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (a.empty (), true);
+
+      cgt::base::array<int> b (10, 7);
+      TS_ASSERT_EQUALS (b.size (), static_cast<size_t>(10));
+      TS_ASSERT_EQUALS (b [0], 7);
+      TS_ASSERT_EQUALS (b [9], 7);
+    }
+
+    void test_push_back ()
+    {
+      cgt::base::array<std::string> a;
+
+      for (int i = 0; i < 1000; i++)
+        a.push_back (std::string (i % 10 + 1, 'x'));
+
+      TS_ASSERT_EQUALS (a.size (), static_cast<size_t>(1000));
+      TS_ASSERT_EQUALS (a.front (), "x");
+      TS_ASSERT_EQUALS (a.back (), "xxxxxxxxxx");
+      TS_ASSERT_EQUALS (a [123], "xxxx");
+      TS_ASSERT_EQUALS (&(a [999]) - &(a [0]), 999);
+
+      a.pop_back ();
+      TS_ASSERT_EQUALS (a.size (), static_cast<size_t>(999));
+    }
+
+    void test_resize ()
+    {
+      cgt::base::array<int> a;
+      a.reserve (100);
+      TS_ASSERT (a.capacity () >= static_cast<size_t>(100));
+      TS_ASSERT_EQUALS (a.size (), static_cast<size_t>(0));
+
+      a.resize (50, 1);
+      a.resize (20);
+      a.resize (30, 2);
+      TS_ASSERT_EQUALS (a.size (), static_cast<size_t>(30));
+      TS_ASSERT_EQUALS (a [19], 1);
+      TS_ASSERT_EQUALS (a [20], 2);
+
+      int _sum = 0;
+      for (cgt::base::array<int>::const_iterator it = a.begin (); it != a.end (); ++it)
+        _sum += *it;
+
+      TS_ASSERT_EQUALS (_sum, 40);
+
+      a.clear ();
+      TS_ASSERT_EQUALS (a.empty (), true);
+    }
+
+    void test_copy_swap ()
+    {
+      cgt::base::array<int> a (3, 1);
+      cgt::base::array<int> b (a);
+      b.push_back (2);
+
+      TS_ASSERT_EQUALS (a.size (), static_cast<size_t>(3));
+      TS_ASSERT_EQUALS (b.size (), static_cast<size_t>(4));
+
+      a.swap (b);
+      TS_ASSERT_EQUALS (a.size (), static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (a.back (), 2);
+      TS_ASSERT_EQUALS (b.size (), static_cast<size_t>(3));
+
+      b = a;
+      TS_ASSERT_EQUALS (b.size (), static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (b.back (), 2);
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_BASE_ARRAY_CXX_H_
@@ -0,0 +1,119 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/base/array_stack_cxx.h
+ * \brief Contains unit tests for class cgt::base::array_stack.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_BASE_ARRAY_STACK_CXX_H_
+#define __CGTL__CXXTEST_CGT_BASE_ARRAY_STACK_CXX_H_
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/base/array_stack.h"
+
+
+class array_stack_cxx : public CxxTest::TestSuite
+{
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_basic ()
+    {
+      cgt::base::array_stack<int> s;
+      TS_ASSERT_EQUALS (s.size (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (s.empty (), true);
+    }
+
+    void test_pop ()
+    {
+      cgt::base::array_stack<int> s;
+      s.insert (1);
+      s.push (2);
+      s.push (3);
+      TS_ASSERT_EQUALS (s.size (), static_cast<size_t>(3));
+      TS_ASSERT_EQUALS (s.top (), 3);
+      TS_ASSERT_EQUALS (s.pop (), 3);
+      TS_ASSERT_EQUALS (s.size (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (s.top (), 2);
+
+      /* a popped position is reused by the next push */
+      s.push (4);
+      TS_ASSERT_EQUALS (s.pop (), 4);
+      TS_ASSERT_EQUALS (s.pop (), 2);
+      TS_ASSERT_EQUALS (s.pop (), 1);
+      TS_ASSERT_EQUALS (s.empty (), true);
+    }
+
+    void test_deep ()
+    {
+      cgt::base::array_stack<int> s;
+
+      for (int i = 0; i < 1000; i++)
+        s.push (i);
+
+      TS_ASSERT_EQUALS (s.size (), static_cast<size_t>(1000));
+
+      for (int i = 999; i >= 0; i--)
+        TS_ASSERT_EQUALS (s.pop (), i);
+
+      TS_ASSERT_EQUALS (s.empty (), true);
+    }
+
+    void test_clear ()
+    {
+      cgt::base::array_stack<int> s;
+      s.insert (1);
+      s.insert (2);
+      s.clear ();
+      TS_ASSERT_EQUALS (s.size (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (s.empty (), true);
+
+      s.insert (3);
+      TS_ASSERT_EQUALS (s.top (), 3);
+    }
+
+    void test_operator_assign ()
+    {
+      cgt::base::array_stack<int> s1;
+      s1.insert (1);
+      s1.insert (2);
+      s1.insert (3);
+
+      cgt::base::array_stack<int> s2;
+      s2 = s1;
+
+      TS_ASSERT_EQUALS (s2.size (), s1.size ());
+      TS_ASSERT_EQUALS (s2.pop (), 3);
+      TS_ASSERT_EQUALS (s1.top (), 3);
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_BASE_ARRAY_STACK_CXX_H_
@@ -0,0 +1,151 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/base/bitset_cxx.h
+ * \brief Unit tests for the bitset.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_BASE_BITSET_CXX_H_
+#define __CGTL__CXXTEST_CGT_BASE_BITSET_CXX_H_
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/base/bitset.h"
+
+
+class bitset_cxx : public CxxTest::TestSuite
+{
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_basic ()
+    {
+      cgt::base::bitset b (130);
+
+      TS_ASSERT_EQUALS (b.size (), static_cast<size_t>(130));
+      TS_ASSERT_EQUALS (b.num_words (), cgt::base::_num_words (130));
+      TS_ASSERT_EQUALS (b.any (), false);
+      TS_ASSERT_EQUALS (b.find_first (), static_cast<size_t>(130));
+
+      b.set (0);
+      b.set (63);
+      b.set (64);
+      b.set (129);
+
+      TS_ASSERT_EQUALS (b.count (), static_cast<size_t>(4));
+      TS_ASSERT (b.test (63));
+      TS_ASSERT (b.test (64));
+      TS_ASSERT (! b.test (65));
+
+      b.reset (63);
+      TS_ASSERT (! b.test (63));
+      TS_ASSERT_EQUALS (b.count (), static_cast<size_t>(3));
+
+      b.clear ();
+      TS_ASSERT_EQUALS (b.any (), false);
+    }
+
+    void test_find ()
+    {
+      cgt::base::bitset b (200);
+      size_t _bits [] = { 3, 64, 65, 127, 199 };
+
+      for (size_t i = 0; i < 5; i++)
+        b.set (_bits [i]);
+
+      size_t k = 0;
+
+      for (size_t i = b.find_first (); i < b.size (); i = b.find_next (i + 1), k++)
+        TS_ASSERT_EQUALS (i, _bits [k]);
+
+      TS_ASSERT_EQUALS (k, static_cast<size_t>(5));
+      TS_ASSERT_EQUALS (b.find_next (200), static_cast<size_t>(200));
+    }
+
+    void test_operations ()
+    {
+      cgt::base::bitset a (100);
+      cgt::base::bitset b (100);
+
+      for (size_t i = 0; i < 100; i += 2)
+        a.set (i);
+
+      for (size_t i = 0; i < 100; i += 3)
+        b.set (i);
+
+      TS_ASSERT_EQUALS (a.count_and_words (b.data ()), static_cast<size_t>(17));
+
+      cgt::base::bitset c (a);
+      c &= b;
+      TS_ASSERT_EQUALS (c.count (), static_cast<size_t>(17));
+      TS_ASSERT (c.test (0));
+      TS_ASSERT (c.test (96));
+      TS_ASSERT (! c.test (4));
+
+      c = a;
+      c |= b;
+      TS_ASSERT_EQUALS (c.count (), static_cast<size_t>(50 + 34 - 17));
+
+      c = a;
+      c.and_not (b);
+      TS_ASSERT_EQUALS (c.count (), static_cast<size_t>(50 - 17));
+      TS_ASSERT (c != a);
+
+      c |= b;
+      c.and_not (b);
+      c |= a;
+      TS_ASSERT (c == a);
+    }
+
+    void test_resize ()
+    {
+      cgt::base::bitset b (10);
+      b.set (9);
+
+      b.resize (100);
+      TS_ASSERT_EQUALS (b.size (), static_cast<size_t>(100));
+      TS_ASSERT_EQUALS (b.count (), static_cast<size_t>(1));
+      b.set (99);
+
+      b.resize (50);
+      TS_ASSERT_EQUALS (b.count (), static_cast<size_t>(1));
+
+      b.resize (100);
+      TS_ASSERT (! b.test (99));
+
+      cgt::base::bitset c;
+      c.swap (b);
+      TS_ASSERT_EQUALS (b.size (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (c.size (), static_cast<size_t>(100));
+      TS_ASSERT (c.test (9));
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_BASE_BITSET_CXX_H_
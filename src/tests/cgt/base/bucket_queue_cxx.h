@@ -0,0 +1,191 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/base/bucket_queue_cxx.h
+ * \brief Contains unit tests for class cgt::base::bucket_queue.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_BASE_BUCKET_QUEUE_CXX_H_
+#define __CGTL__CXXTEST_CGT_BASE_BUCKET_QUEUE_CXX_H_
+
+#include <cstdlib>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/base/bucket_queue.h"
+
+
+class bucket_queue_cxx : public CxxTest::TestSuite
+{
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_basic ()
+    {
+      cgt::base::bucket_queue<unsigned short> h;
+      TS_ASSERT_EQUALS (h.size (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (h.empty (), true);
+      TS_ASSERT_EQUALS (h.contains (0), false);
+    }
+
+    void test_pop ()
+    {
+      cgt::base::bucket_queue<unsigned short> h;
+      h.push (3, 30);
+      h.push (0, 50);
+      h.push (7, 10);
+      h.push (2, 31);
+
+      TS_ASSERT_EQUALS (h.size (), static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (h.contains (7), true);
+      TS_ASSERT_EQUALS (h.contains (5), false);
+      TS_ASSERT_EQUALS (h.top (), static_cast<size_t>(7));
+      TS_ASSERT_EQUALS (h.top_key (), static_cast<unsigned short>(10));
+
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(7));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(3));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (h.contains (2), false);
+      TS_ASSERT_EQUALS (h.key (2), static_cast<unsigned short>(31));
+
+      /* keys can be pushed again from the last one popped on */
+      h.push (2, 31);
+      h.push (9, 40);
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(9));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (h.empty (), true);
+    }
+
+    void test_decrease ()
+    {
+      cgt::base::bucket_queue<unsigned short> h;
+      h.push (0, 10);
+      h.push (1, 20);
+      h.push (2, 30);
+
+      h.decrease (2, 5);
+      TS_ASSERT_EQUALS (h.top (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (h.key (2), static_cast<unsigned short>(5));
+
+      TS_ASSERT_EQUALS (h.push_or_decrease (1, 25), false);
+      TS_ASSERT_EQUALS (h.key (1), static_cast<unsigned short>(20));
+      TS_ASSERT_EQUALS (h.push_or_decrease (1, 7), true);
+      TS_ASSERT_EQUALS (h.push_or_decrease (4, 8), true);
+      TS_ASSERT_EQUALS (h.size (), static_cast<size_t>(4));
+
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(0));
+    }
+
+    void test_monotone ()
+    {
+      /*
+       * as in Dijkstra Algorithm: each index popped pushes or decreases
+       * others, with keys from its own up to 1000 more
+       */
+
+      const size_t _n = 5000;
+      cgt::base::bucket_queue<unsigned short> h;
+      std::vector<unsigned short> _keys (_n, 0);
+      std::vector<char> _popped (_n, 0);
+
+      srand (1);
+      h.push (0, 0);
+
+      unsigned short _prev = 0;
+      size_t _count = 0;
+
+      while (! h.empty ())
+      {
+        size_t i = h.pop ();
+
+        TS_ASSERT (_prev <= _keys [i]);
+        TS_ASSERT_EQUALS (h.key (i), _keys [i]);
+        _prev = _keys [i];
+        _popped [i] = 1;
+        _count++;
+
+        for (int k = 0; k < 4; k++)
+        {
+          size_t j = rand () % _n;
+          unsigned short _key = _keys [i] + rand () % 1000;
+
+          if (! _popped [j] && h.push_or_decrease (j, _key))
+            _keys [j] = _key;
+        }
+      }
+
+      TS_ASSERT (_count > _n / 2);
+    }
+
+    void test_clear ()
+    {
+      cgt::base::bucket_queue<unsigned short> h;
+      h.push (1, 100);
+      h.push (2, 200);
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(1));
+      h.clear ();
+      TS_ASSERT_EQUALS (h.empty (), true);
+      TS_ASSERT_EQUALS (h.contains (2), false);
+
+      /* after clear, keys start again from 0 */
+      h.push (2, 3);
+      h.push (1, 1);
+      TS_ASSERT_EQUALS (h.top (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(2));
+    }
+
+    void test_grow ()
+    {
+      /* keys farther than the ring from the last one popped make it grow */
+      cgt::base::bucket_queue<unsigned short> h;
+
+      h.push (0, 10);
+      h.push (1, 5000);
+      h.push (2, 63);
+      h.push (3, 640);
+
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(2));
+      h.push (4, 65000);
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(3));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (h.top_key (), static_cast<unsigned short>(65000));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (h.empty (), true);
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_BASE_BUCKET_QUEUE_CXX_H_
@@ -63,6 +63,33 @@ class hash_cxx : public CxxTest::TestSuite
       TS_ASSERT_EQUALS (h[2], static_cast<std::string *>(NULL));
     }
 
+    void test_remove ()
+    {
+      cgt::base::hash<int, std::string> h;
+
+      for (int i = 0; i < 10; i++)
+        h.insert (i, "item");
+
+      h.remove (3);
+      h.remove (10);
+
+      TS_ASSERT_EQUALS (h.size (), static_cast<size_t>(9));
+      TS_ASSERT_EQUALS (h[3], static_cast<std::string *>(NULL));
+      TS_ASSERT_EQUALS (*(h[4]), "item");
+    }
+
+    void test_pointer_key ()
+    {
+      int v [100];
+      cgt::base::hash<int*, int> h;
+
+      for (int i = 0; i < 100; i++)
+        h.insert (&(v [i]), i);
+
+      for (int i = 0; i < 100; i++)
+        TS_ASSERT_EQUALS (*(h[&(v [i])]), i);
+    }
+
     void test_iterator ()
     {
       cgt::base::hash<int, std::string> h;
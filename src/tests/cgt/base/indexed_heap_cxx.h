@@ -0,0 +1,155 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/base/indexed_heap_cxx.h
+ * \brief Contains unit tests for class cgt::base::indexed_heap.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_BASE_INDEXED_HEAP_CXX_H_
+#define __CGTL__CXXTEST_CGT_BASE_INDEXED_HEAP_CXX_H_
+
+#include <cstdlib>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/base/indexed_heap.h"
+
+
+class indexed_heap_cxx : public CxxTest::TestSuite
+{
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_basic ()
+    {
+      cgt::base::indexed_heap<int> h;
+      TS_ASSERT_EQUALS (h.size (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (h.empty (), true);
+      TS_ASSERT_EQUALS (h.contains (0), false);
+    }
+
+    void test_pop ()
+    {
+      cgt::base::indexed_heap<int> h;
+      h.push (3, 30);
+      h.push (0, 50);
+      h.push (7, 10);
+      h.push (2, 30);
+
+      TS_ASSERT_EQUALS (h.size (), static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (h.contains (7), true);
+      TS_ASSERT_EQUALS (h.contains (5), false);
+      TS_ASSERT_EQUALS (h.top (), static_cast<size_t>(7));
+      TS_ASSERT_EQUALS (h.top_key (), 10);
+
+      /* 2 and 3 have the same key: the lowest index comes first */
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(7));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(3));
+      TS_ASSERT_EQUALS (h.contains (3), false);
+      TS_ASSERT_EQUALS (h.key (3), 30);
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (h.empty (), true);
+    }
+
+    void test_decrease ()
+    {
+      cgt::base::indexed_heap<int> h;
+      h.push (0, 10);
+      h.push (1, 20);
+      h.push (2, 30);
+
+      h.decrease (2, 5);
+      TS_ASSERT_EQUALS (h.top (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (h.key (2), 5);
+
+      TS_ASSERT_EQUALS (h.push_or_decrease (1, 25), false);
+      TS_ASSERT_EQUALS (h.key (1), 20);
+      TS_ASSERT_EQUALS (h.push_or_decrease (1, 1), true);
+      TS_ASSERT_EQUALS (h.push_or_decrease (4, 7), true);
+      TS_ASSERT_EQUALS (h.size (), static_cast<size_t>(4));
+
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (h.pop (), static_cast<size_t>(0));
+    }
+
+    void test_random ()
+    {
+      /* random pushes and decreases: indices come out in order of their last keys */
+      const size_t _n = 5000;
+      cgt::base::indexed_heap<int, 3> h;
+      std::vector<int> _keys (_n);
+
+      srand (1);
+      for (size_t i = 0; i < _n; i++)
+      {
+        _keys [i] = rand () % 100000;
+        h.push (i, _keys [i]);
+      }
+
+      for (int k = 0; k < 20000; k++)
+      {
+        size_t i = rand () % _n;
+        int _key = _keys [i] - rand () % 1000;
+
+        if (h.push_or_decrease (i, _key))
+          _keys [i] = _key;
+      }
+
+      size_t _prev = h.pop ();
+
+      while (! h.empty ())
+      {
+        size_t i = h.pop ();
+
+        TS_ASSERT (_keys [_prev] < _keys [i] || (_keys [_prev] == _keys [i] && _prev < i));
+        TS_ASSERT_EQUALS (h.key (i), _keys [i]);
+        _prev = i;
+      }
+    }
+
+    void test_clear ()
+    {
+      cgt::base::indexed_heap<int> h;
+      h.push (1, 1);
+      h.push (2, 2);
+      h.clear ();
+      TS_ASSERT_EQUALS (h.empty (), true);
+      TS_ASSERT_EQUALS (h.contains (1), false);
+
+      h.push (2, 3);
+      TS_ASSERT_EQUALS (h.top (), static_cast<size_t>(2));
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_BASE_INDEXED_HEAP_CXX_H_
@@ -0,0 +1,134 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/base/ring_queue_cxx.h
+ * \brief Contains unit tests for class cgt::base::ring_queue.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_BASE_RING_QUEUE_CXX_H_
+#define __CGTL__CXXTEST_CGT_BASE_RING_QUEUE_CXX_H_
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/base/ring_queue.h"
+
+
+class ring_queue_cxx : public CxxTest::TestSuite
+{
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_basic ()
+    {
+      cgt::base::ring_queue<int> q;
+      TS_ASSERT_EQUALS (q.size (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (q.empty (), true);
+    }
+
+    void test_dequeue ()
+    {
+      cgt::base::ring_queue<int> q;
+      q.insert (1);
+      q.enqueue (2);
+      q.enqueue (3);
+      TS_ASSERT_EQUALS (q.size (), static_cast<size_t>(3));
+      TS_ASSERT_EQUALS (q.first (), 1);
+      TS_ASSERT_EQUALS (q.dequeue (), 1);
+      TS_ASSERT_EQUALS (q.size (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (q.first (), 2);
+      TS_ASSERT_EQUALS (q.dequeue (), 2);
+      TS_ASSERT_EQUALS (q.dequeue (), 3);
+      TS_ASSERT_EQUALS (q.empty (), true);
+    }
+
+    void test_wrap ()
+    {
+      /* the items wrap around the end of the buffer, and keep their order when it grows */
+      cgt::base::ring_queue<int> q;
+      int _next = 0;
+      int _first = 0;
+
+      for (int i = 0; i < 10; i++)
+        q.enqueue (_next++);
+
+      size_t _capacity = q.capacity ();
+
+      for (int k = 0; k < 100; k++)
+      {
+        q.enqueue (_next++);
+        TS_ASSERT_EQUALS (q.dequeue (), _first++);
+      }
+
+      TS_ASSERT_EQUALS (q.capacity (), _capacity);
+
+      for (int i = 0; i < 100; i++)
+        q.enqueue (_next++);
+
+      TS_ASSERT (q.capacity () > _capacity);
+      TS_ASSERT_EQUALS (q.size (), static_cast<size_t>(110));
+
+      while (! q.empty ())
+        TS_ASSERT_EQUALS (q.dequeue (), _first++);
+
+      TS_ASSERT_EQUALS (_first, _next);
+    }
+
+    void test_clear ()
+    {
+      cgt::base::ring_queue<int> q;
+      q.insert (1);
+      q.insert (2);
+      q.clear ();
+      TS_ASSERT_EQUALS (q.size (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (q.empty (), true);
+
+      q.insert (3);
+      TS_ASSERT_EQUALS (q.first (), 3);
+    }
+
+    void test_operator_assign ()
+    {
+      cgt::base::ring_queue<int> q1;
+      q1.insert (1);
+      q1.insert (2);
+      q1.insert (3);
+      q1.dequeue ();
+
+      cgt::base::ring_queue<int> q2;
+      q2 = q1;
+
+      TS_ASSERT_EQUALS (q2.size (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (q2.dequeue (), 2);
+      TS_ASSERT_EQUALS (q2.dequeue (), 3);
+      TS_ASSERT_EQUALS (q1.size (), static_cast<size_t>(2));
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_BASE_RING_QUEUE_CXX_H_
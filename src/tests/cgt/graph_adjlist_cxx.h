@@ -0,0 +1,114 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/graph_adjlist_cxx.h
+ * \brief Functional tests for adjacency lists of high-degree vertices.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_GRAPH_ADJLIST_CXX_H_
+#define __CGTL__CXXTEST_CGT_GRAPH_ADJLIST_CXX_H_
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/graph.h"
+
+
+class graph_adjlist_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                        dgraph;
+    typedef cgt::graph<int, void, cgt::_Undirected>     ugraph;
+
+    static const int HUB_DEGREE = 4 * CGTL_ADJLIST_INDEX_THRESHOLD;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_hub_directed ()
+    {
+      dgraph g;
+
+      for (int i = 0; i <= HUB_DEGREE; i++)
+        g.insert_vertex (i);
+
+      for (int i = 1; i <= HUB_DEGREE; i++)
+        g.insert_edge (i, 0, i);
+
+      /* duplicated edges are ignored */
+      for (int i = 1; i <= HUB_DEGREE; i++)
+        g.insert_edge (-i, 0, i);
+
+      dgraph::iterator itHub = g.find (0);
+      TS_ASSERT_EQUALS (itHub->adjlist ().size (), static_cast<size_t>(HUB_DEGREE));
+
+      for (dgraph::iterator it = ++(g.begin ()); it != g.end (); ++it)
+      {
+        TS_ASSERT_DIFFERS (itHub->get_edge (*it), static_cast<dgraph::edge *>(NULL));
+        TS_ASSERT_EQUALS (itHub->get_edge (*it)->value (), it->vertex ().value ());
+        TS_ASSERT_EQUALS (itHub->get_edge (it->vertex ()), itHub->get_edge (*it));
+        TS_ASSERT_EQUALS (it->get_edge (*itHub), static_cast<dgraph::edge *>(NULL));
+      }
+
+      /* a copy of a vertex is found by value */
+      dgraph::vertex v (HUB_DEGREE);
+      TS_ASSERT_EQUALS (itHub->get_edge (v)->value (), HUB_DEGREE);
+
+      /* the index follows the lists when the graph is inverted */
+      g.invert ();
+      TS_ASSERT_EQUALS (itHub->get_edge (*(++(g.begin ()))), static_cast<dgraph::edge *>(NULL));
+      TS_ASSERT_EQUALS (g.find (1)->get_edge (*itHub)->value (), 1);
+    }
+
+    void test_hub_undirected ()
+    {
+      ugraph g;
+
+      for (int i = 0; i <= HUB_DEGREE; i++)
+        g.insert_vertex (i);
+
+      for (int i = 0; i <= HUB_DEGREE; i++)
+      {
+        g.insert_edge (0, i);
+        g.insert_edge (i, 0);
+      }
+
+      size_t _count = 0;
+      for (ugraph::eiterator it = g.ebegin (); it != g.eend (); ++it)
+        _count++;
+
+      TS_ASSERT_EQUALS (_count, static_cast<size_t>(HUB_DEGREE + 1));
+      TS_ASSERT_EQUALS (g.find (0)->adjlist ().size (), static_cast<size_t>(HUB_DEGREE + 1));
+      TS_ASSERT_EQUALS (g.find (1)->adjlist ().size (), static_cast<size_t>(1));
+    }
+};
+
+const int graph_adjlist_cxx::HUB_DEGREE;
+
+#endif // __CGTL__CXXTEST_CGT_GRAPH_ADJLIST_CXX_H_
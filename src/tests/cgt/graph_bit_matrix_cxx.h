@@ -0,0 +1,298 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/graph_bit_matrix_cxx.h
+ * \brief Functional tests for dense graphs, that keep a bit matrix of their edges.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_GRAPH_BIT_MATRIX_CXX_H_
+#define __CGTL__CXXTEST_CGT_GRAPH_BIT_MATRIX_CXX_H_
+
+#include <vector>
+#include <cstdlib>
+
+#include <cxxtest/TestSuite.h>
+
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/graph.h"
+
+
+/* a directed type that keeps the matrix of edges too */
+struct _DirectedEdgeMatrix
+{
+  enum { _directed = true, _inverse = true, _matrix = cgt::_EDGE_MATRIX };
+};
+
+class graph_bit_matrix_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                                    dgraph;
+    typedef cgt::graph<int, int, cgt::_DirectedDense>               ddgraph;
+    typedef cgt::graph<int, void, cgt::_UndirectedDense>            udgraph;
+    typedef cgt::graph<int, int, _DirectedEdgeMatrix>               edgraph;
+
+    static const int N = 150; /* more than two words per row */
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  private:
+    template<typename _TpGraph>
+      void _build (_TpGraph& g)
+      {
+        for (int i = 0; i < N; i++)
+          g.insert_vertex (i);
+
+        srand (7);
+
+        for (int i = 0; i < 4 * N; i++)
+          g.insert_edge (i, rand () % N, rand () % N);
+      }
+
+    /* the nodes reachable from the node with id _id, by the adjacency lists */
+    template<typename _TpGraph>
+      std::vector<bool> _reachable (const _TpGraph& g, size_t _id)
+      {
+        std::vector<bool> _seen (g.num_vertices (), false);
+        std::vector<size_t> _queue (1, _id);
+        _seen [_id] = true;
+
+        for (size_t k = 0; k < _queue.size (); k++)
+        {
+          const typename _TpGraph::node& _n = g.get_node_by_id (_queue [k]);
+
+          for (typename _TpGraph::adjlist::const_iterator it = _n.adjlist ().begin (); it != _n.adjlist ().end (); ++it)
+          {
+            if (! _seen [it->node ().id ()])
+            {
+              _seen [it->node ().id ()] = true;
+              _queue.push_back (it->node ().id ());
+            }
+          }
+        }
+
+        return _seen;
+      }
+
+  public:
+    void test_has_edge ()
+    {
+      dgraph d;
+      ddgraph g;
+
+      _build (d);
+      _build (g);
+
+      for (size_t i = 0; i < g.num_vertices (); i++)
+      {
+        for (size_t j = 0; j < g.num_vertices (); j++)
+        {
+          const ddgraph::node& _n1 = g.get_node_by_id (i);
+          const ddgraph::node& _n2 = g.get_node_by_id (j);
+
+          TS_ASSERT_EQUALS (g.has_edge (_n1, _n2), _n1.get_edge (_n2) != NULL);
+          TS_ASSERT_EQUALS (g.get_edge (_n1, _n2), _n1.get_edge (_n2));
+          TS_ASSERT_EQUALS (g.has_edge (_n1, _n2), d.has_edge (d.get_node_by_id (i), d.get_node_by_id (j)));
+        }
+      }
+
+      /* repeated edges are still ignored */
+      size_t _count = 0;
+      for (ddgraph::const_eiterator it = g.ebegin (); it != g.eend (); ++it)
+        _count++;
+
+      size_t _countd = 0;
+      for (dgraph::const_eiterator it = d.ebegin (); it != d.eend (); ++it)
+        _countd++;
+
+      TS_ASSERT_EQUALS (_count, _countd);
+    }
+
+    void test_undirected ()
+    {
+      udgraph g;
+
+      for (int i = 0; i < 100; i++)
+        g.insert_vertex (i);
+
+      g.insert_edge (1, 99);
+      g.insert_edge (99, 1);
+      g.insert_edge (5, 5);
+
+      TS_ASSERT (g.has_edge (*g.get_node (1), *g.get_node (99)));
+      TS_ASSERT (g.has_edge (*g.get_node (99), *g.get_node (1)));
+      TS_ASSERT (g.has_edge (*g.get_node (5), *g.get_node (5)));
+      TS_ASSERT (! g.has_edge (*g.get_node (1), *g.get_node (5)));
+      TS_ASSERT_EQUALS (g.get_node (1)->adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (g.get_node (99)->adjlist ().size (), static_cast<size_t>(1));
+    }
+
+    void test_neighbours ()
+    {
+      ddgraph g;
+      _build (g);
+
+      cgt::base::bitset _s1;
+      cgt::base::bitset _s2;
+
+      for (size_t i = 0; i + 1 < g.num_vertices (); i++)
+      {
+        const ddgraph::node& _n1 = g.get_node_by_id (i);
+        const ddgraph::node& _n2 = g.get_node_by_id (i + 1);
+
+        g.neighbours (_n1, _s1);
+        g.neighbours (_n2, _s2);
+
+        TS_ASSERT_EQUALS (_s1.size (), g.num_vertices ());
+        TS_ASSERT_EQUALS (_s1.count (), _n1.adjlist ().size ());
+
+        /* common neighbours, by the lists */
+        size_t _common = 0;
+        for (ddgraph::adjlist::const_iterator it = _n1.adjlist ().begin (); it != _n1.adjlist ().end (); ++it)
+          if (_n2.get_edge (it->node ()))
+            _common++;
+
+        _s1 &= _s2;
+        TS_ASSERT_EQUALS (_s1.count (), _common);
+      }
+    }
+
+    void test_reachable ()
+    {
+      ddgraph g;
+
+      for (int i = 0; i < N; i++)
+        g.insert_vertex (i);
+
+      /* a chain 0 -> 1 -> ... -> 99, and a cycle 100 -> ... -> 149 -> 100 */
+      for (int i = 0; i < 99; i++)
+        g.insert_edge (i, i, i + 1);
+
+      for (int i = 100; i < N; i++)
+        g.insert_edge (i, i, (i + 1 < N ? i + 1 : 100));
+
+      g.insert_edge (0, 120, 50);
+
+      cgt::base::bitset _set;
+
+      for (size_t i = 0; i < g.num_vertices (); i += 7)
+      {
+        g.reachable (g.get_node_by_id (i), _set);
+        std::vector<bool> _seen = _reachable (g, i);
+
+        for (size_t j = 0; j < g.num_vertices (); j++)
+          TS_ASSERT_EQUALS (_set.test (j), _seen [j]);
+      }
+
+      g.reachable (g.get_node_by_id (130), _set);
+      TS_ASSERT_EQUALS (_set.count (), static_cast<size_t>(50 + 50));
+    }
+
+    void test_edge_matrix ()
+    {
+      edgraph g;
+      _build (g);
+
+      for (size_t i = 0; i < g.num_vertices (); i++)
+      {
+        for (size_t j = 0; j < g.num_vertices (); j++)
+        {
+          const edgraph::node& _n1 = g.get_node_by_id (i);
+          const edgraph::node& _n2 = g.get_node_by_id (j);
+
+          TS_ASSERT_EQUALS (g.get_edge (_n1, _n2), _n1.get_edge (_n2));
+          TS_ASSERT_EQUALS (g.has_edge (_n1, _n2), _n1.get_edge (_n2) != NULL);
+        }
+      }
+    }
+
+    void test_invert ()
+    {
+      ddgraph g;
+      edgraph e;
+
+      _build (g);
+      _build (e);
+
+      g.invert ();
+      e.invert ();
+
+      for (size_t i = 0; i < g.num_vertices (); i++)
+      {
+        for (size_t j = 0; j < g.num_vertices (); j++)
+        {
+          const ddgraph::node& _n1 = g.get_node_by_id (i);
+          const ddgraph::node& _n2 = g.get_node_by_id (j);
+          const edgraph::node& _e1 = e.get_node_by_id (i);
+          const edgraph::node& _e2 = e.get_node_by_id (j);
+
+          TS_ASSERT_EQUALS (g.has_edge (_n1, _n2), _n1.get_edge (_n2) != NULL);
+          TS_ASSERT_EQUALS (g.get_edge (_n1, _n2), _n1.get_edge (_n2));
+          TS_ASSERT_EQUALS (e.has_edge (_e1, _e2), _e1.get_edge (_e2) != NULL);
+          TS_ASSERT_EQUALS (e.get_edge (_e1, _e2), _e1.get_edge (_e2));
+        }
+      }
+
+      /* an edge already there after the inversion isn't inserted again */
+      ddgraph h;
+      h.insert_vertex (1);
+      h.insert_vertex (2);
+      h.insert_edge (10, 1, 2);
+      h.invert ();
+
+      TS_ASSERT (h.has_edge (*h.get_node (2), *h.get_node (1)));
+      TS_ASSERT (! h.has_edge (*h.get_node (1), *h.get_node (2)));
+      TS_ASSERT_EQUALS (h.get_edge (*h.get_node (2), *h.get_node (1))->value (), 10);
+
+      h.insert_edge (20, 2, 1);
+      TS_ASSERT_EQUALS (h.get_node (2)->adjlist ().size (), 1);
+    }
+
+    void test_insert_edges ()
+    {
+      ddgraph g;
+
+      for (int i = 0; i < 70; i++)
+        g.insert_vertex (i);
+
+      std::vector<ddgraph::edge_spec> edges;
+      edges.push_back (ddgraph::edge_spec (1, 0, 69));
+      edges.push_back (ddgraph::edge_spec (2, 69, 0));
+      edges.push_back (ddgraph::edge_spec (3, 0, 69));
+
+      g.insert_edges (edges.begin (), edges.end ());
+
+      TS_ASSERT (g.has_edge (*g.get_node (0), *g.get_node (69)));
+      TS_ASSERT (g.has_edge (*g.get_node (69), *g.get_node (0)));
+      TS_ASSERT_EQUALS (g.get_edge (*g.get_node (0), *g.get_node (69))->value (), 1);
+      TS_ASSERT (! g.has_edge (*g.get_node (0), *g.get_node (68)));
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_GRAPH_BIT_MATRIX_CXX_H_
@@ -0,0 +1,227 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/graph_bulk_cxx.h
+ * \brief Functional tests for bulk insertion of vertices and edges.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_GRAPH_BULK_CXX_H_
+#define __CGTL__CXXTEST_CGT_GRAPH_BULK_CXX_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/graph.h"
+
+
+class graph_bulk_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                                                        dgraph;
+    typedef cgt::graph<int, int, cgt::_Undirected>                                      ugraph;
+    typedef cgt::graph<int, void, cgt::_Undirected>                                     vgraph;
+    typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> >            hdgraph;
+    typedef cgt::graph<int, void, cgt::_Undirected, cgt::base::_HashFunc<int> >         hvgraph;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  private:
+    /*
+     * a batch with repeated vertices, repeated edges (in both
+     * directions), self-loops and edges to unknown vertices.
+     */
+
+    static const int NUM_VERTICES = 20;
+    static const int NUM_EDGES = 200;
+
+    static int _vertex (const int& i) { return (i * 7) % NUM_VERTICES; }
+    static int _v1 (const int& i) { return (i * 13) % NUM_VERTICES; }
+    static int _v2 (const int& i) { return (i % 17 ? (i * 5 + 3) % (NUM_VERTICES + 2) : _v1 (i)); }
+
+    template<typename _TpGraph>
+      static void _fill_weighted (_TpGraph& _seq, _TpGraph& _bulk)
+      {
+        cgt::base::array<int> _vertices;
+        cgt::base::array<typename _TpGraph::edge_spec> _edges;
+
+        for (int i = 0; i < 2 * NUM_VERTICES; i++)
+        {
+          _seq.insert_vertex (_vertex (i));
+          _vertices.push_back (_vertex (i));
+        }
+
+        for (int i = 0; i < NUM_EDGES; i++)
+        {
+          _seq.insert_edge (i, _v1 (i), _v2 (i));
+          _edges.push_back (typename _TpGraph::edge_spec (i, _v1 (i), _v2 (i)));
+        }
+
+        _bulk.insert_vertices (_vertices.begin (), _vertices.end ());
+        _bulk.insert_edges (_edges.begin (), _edges.end ());
+      }
+
+    template<typename _TpGraph>
+      static void _fill_simple (_TpGraph& _seq, _TpGraph& _bulk)
+      {
+        cgt::base::array<int> _vertices;
+        cgt::base::array<typename _TpGraph::edge_spec> _edges;
+
+        for (int i = 0; i < 2 * NUM_VERTICES; i++)
+        {
+          _seq.insert_vertex (_vertex (i));
+          _vertices.push_back (_vertex (i));
+        }
+
+        for (int i = 0; i < NUM_EDGES; i++)
+        {
+          _seq.insert_edge (_v1 (i), _v2 (i));
+          _edges.push_back (typename _TpGraph::edge_spec (_v1 (i), _v2 (i)));
+        }
+
+        _bulk.insert_vertices (_vertices.begin (), _vertices.end ());
+        _bulk.insert_edges (_edges.begin (), _edges.end ());
+      }
+
+    template<typename _TpGraph>
+      static void _assert_same (_TpGraph& _g1, _TpGraph& _g2)
+      {
+        TS_ASSERT_EQUALS (_g1.num_vertices (), _g2.num_vertices ());
+
+        typename _TpGraph::iterator it1 = _g1.begin ();
+        typename _TpGraph::iterator it2 = _g2.begin ();
+
+        for (; it1 != _g1.end () && it2 != _g2.end (); ++it1, ++it2)
+        {
+          TS_ASSERT_EQUALS (it1->vertex ().value (), it2->vertex ().value ());
+          TS_ASSERT_EQUALS (it1->id (), it2->id ());
+          TS_ASSERT_EQUALS (it1->adjlist ().size (), it2->adjlist ().size ());
+          TS_ASSERT_EQUALS (it1->iadjlist ().size (), it2->iadjlist ().size ());
+
+          typename _TpGraph::adjlist::iterator itA1 = it1->adjlist ().begin ();
+          typename _TpGraph::adjlist::iterator itA2 = it2->adjlist ().begin ();
+
+          for (; itA1 != it1->adjlist ().end () && itA2 != it2->adjlist ().end (); ++itA1, ++itA2)
+            TS_ASSERT (*itA1 == *itA2);
+
+          itA1 = it1->iadjlist ().begin ();
+          itA2 = it2->iadjlist ().begin ();
+
+          for (; itA1 != it1->iadjlist ().end () && itA2 != it2->iadjlist ().end (); ++itA1, ++itA2)
+            TS_ASSERT (*itA1 == *itA2);
+        }
+
+        TS_ASSERT_EQUALS (it1, _g1.end ());
+        TS_ASSERT_EQUALS (it2, _g2.end ());
+
+        typename _TpGraph::eiterator itE1 = _g1.ebegin ();
+        typename _TpGraph::eiterator itE2 = _g2.ebegin ();
+
+        for (; itE1 != _g1.eend () && itE2 != _g2.eend (); ++itE1, ++itE2)
+          TS_ASSERT (*itE1 == *itE2);
+
+        TS_ASSERT_EQUALS (itE1, _g1.eend ());
+        TS_ASSERT_EQUALS (itE2, _g2.eend ());
+      }
+
+  public:
+    void test_insert_vertices ()
+    {
+      dgraph g;
+      int _vertices [] = { 3, 1, 3, 2, 1, 0 };
+
+      g.insert_vertex (2);
+      g.insert_vertices (_vertices, _vertices + 6);
+
+      TS_ASSERT_EQUALS (g.num_vertices (), static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (g.get_node_by_id (0).vertex ().value (), 2);
+      TS_ASSERT_EQUALS (g.get_node_by_id (1).vertex ().value (), 3);
+      TS_ASSERT_EQUALS (g.get_node_by_id (2).vertex ().value (), 1);
+      TS_ASSERT_EQUALS (g.get_node_by_id (3).vertex ().value (), 0);
+    }
+
+    void test_directed ()
+    {
+      dgraph g1, g2;
+      _fill_weighted (g1, g2);
+      _assert_same (g1, g2);
+    }
+
+    void test_undirected ()
+    {
+      ugraph g1, g2;
+      _fill_weighted (g1, g2);
+      _assert_same (g1, g2);
+    }
+
+    void test_simple ()
+    {
+      vgraph g1, g2;
+      _fill_simple (g1, g2);
+      _assert_same (g1, g2);
+    }
+
+    void test_hashed ()
+    {
+      hdgraph g1, g2;
+      _fill_weighted (g1, g2);
+      _assert_same (g1, g2);
+
+      hvgraph g3, g4;
+      _fill_simple (g3, g4);
+      _assert_same (g3, g4);
+    }
+
+    void test_existing_edges ()
+    {
+      ugraph g1, g2;
+
+      for (int i = 0; i < 4; i++)
+      {
+        g1.insert_vertex (i);
+        g2.insert_vertex (i);
+      }
+
+      g1.insert_edge (10, 0, 1);
+      g2.insert_edge (10, 0, 1);
+
+      ugraph::edge_spec _edges [] = { ugraph::edge_spec (1, 1, 0), ugraph::edge_spec (2, 2, 3), ugraph::edge_spec (3, 3, 2), ugraph::edge_spec (4, 0, 1) };
+
+      for (int i = 0; i < 4; i++)
+        g1.insert_edge (_edges [i].value (), _edges [i].v1 (), _edges [i].v2 ());
+
+      g2.insert_edges (_edges, _edges + 4);
+
+      _assert_same (g1, g2);
+      TS_ASSERT_EQUALS (g2.get_node_by_id (0).adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (g2.get_node_by_id (2).adjlist ().begin ()->edge ().value (), 2);
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_GRAPH_BULK_CXX_H_
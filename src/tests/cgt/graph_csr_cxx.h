@@ -0,0 +1,323 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/graph_csr_cxx.h
+ * \brief Functional tests for CSR snapshots of graphs (graph::freeze).
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_GRAPH_CSR_CXX_H_
+#define __CGTL__CXXTEST_CGT_GRAPH_CSR_CXX_H_
+
+#include <cxxtest/TestSuite.h>
+#include <vector>
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/graph.h"
+
+
+class graph_csr_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                        dgraph;
+    typedef cgt::graph<int, int, cgt::_Undirected>      ugraph;
+    typedef cgt::graph<int>                             sgraph;
+    typedef dgraph::csr_graph                           dcsr;
+    typedef ugraph::csr_graph                           ucsr;
+    typedef sgraph::csr_graph                           scsr;
+
+    static const int NUM_VERTICES = 50;
+
+  private:
+    template<typename _TpGraph>
+      static void _make_sparse (_TpGraph& g)
+      {
+        for (int i = 0; i < NUM_VERTICES; i++)
+          g.insert_vertex (i);
+
+        for (int i = 0; i < NUM_VERTICES; i++)
+        {
+          g.insert_edge (i % 7 + 1, i, (i * 7 + 3) % NUM_VERTICES);
+          g.insert_edge (i % 5 + 1, i, (i * 11 + 5) % NUM_VERTICES);
+        }
+      }
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_structure ()
+    {
+      dgraph g;
+      _make_sparse (g);
+      dcsr c = g.freeze ();
+
+      TS_ASSERT_EQUALS (c.num_vertices (), static_cast<size_t>(NUM_VERTICES));
+      TS_ASSERT_EQUALS (c.is_directed (), true);
+
+      size_t _num_edges = 0;
+      size_t _id = 0;
+
+      for (dgraph::iterator it = g.begin (); it != g.end (); ++it, ++_id)
+      {
+        TS_ASSERT_EQUALS (c.id (*it), _id);
+        TS_ASSERT_EQUALS (&(c.node (_id)), &(*it));
+        TS_ASSERT_EQUALS (c.degree (_id), it->adjlist ().size ());
+
+        dgraph::adjlist::const_iterator itA = it->adjlist ().begin ();
+
+        for (size_t _pos = c.adj_begin (_id); _pos < c.adj_end (_id); ++_pos, ++itA)
+        {
+          TS_ASSERT_EQUALS (&(c.node (c.target (_pos))), &(itA->node ()));
+          TS_ASSERT_EQUALS (&(c.edge (_pos)), &(itA->edge ()));
+          TS_ASSERT_EQUALS (c.weight (_pos), itA->edge ().value ());
+        }
+
+        _num_edges += it->adjlist ().size ();
+      }
+
+      TS_ASSERT_EQUALS (c.num_edges (), _num_edges);
+
+      /* the snapshot doesn't see nodes inserted after freeze () */
+      dgraph::iterator itNew = g.insert_vertex (-1);
+      TS_ASSERT_EQUALS (c.id (*itNew), dcsr::npos);
+    }
+
+    void test_breadth ()
+    {
+      dgraph g;
+      _make_sparse (g);
+      dcsr c = g.freeze ();
+
+      std::vector<const dgraph::node *> v1, v2;
+
+      for (dgraph::biterator it = g.bbegin (g.find (17)); it != g.bend (); ++it)
+        v1.push_back (&(*it));
+
+      for (dcsr::biterator it = c.bbegin (17); it != c.bend (); ++it)
+        v2.push_back (&(*it));
+
+      TS_ASSERT_EQUALS (v1.size (), static_cast<size_t>(NUM_VERTICES));
+      TS_ASSERT (v1 == v2);
+    }
+
+    void test_depth ()
+    {
+      dgraph g;
+      _make_sparse (g);
+      dcsr c = g.freeze ();
+
+      std::vector<const dgraph::node *> v1, v2;
+
+      for (dgraph::diterator it = g.dbegin (); it != g.dend (); ++it)
+        v1.push_back (&(*it));
+
+      dcsr::diterator it = c.dbegin ();
+
+      for (; it != c.dend (); ++it)
+      {
+        v2.push_back (&(*it));
+
+        if (it.parent (it.id ()) != dcsr::npos)
+          TS_ASSERT (it.discovery (it.parent (it.id ())) < it.discovery (it.id ()));
+      }
+
+      TS_ASSERT_EQUALS (v1.size (), static_cast<size_t>(NUM_VERTICES));
+      TS_ASSERT (v1 == v2);
+    }
+
+    void test_toposort ()
+    {
+      sgraph g;
+
+      for (int i = 0; i < 30; i++)
+        g.insert_vertex ((i * 13) % 30);
+
+      for (int i = 0; i < 30; i++)
+      {
+        g.insert_edge (i, (i * 3 + 1) % 30 > i ? (i * 3 + 1) % 30 : 29);
+        g.insert_edge (i, (i + 7) % 30 > i ? (i + 7) % 30 : 29);
+      }
+
+      scsr c = g.freeze ();
+
+      std::vector<const sgraph::node *> v1, v2;
+
+      for (sgraph::tsiterator it = g.tsbegin (); it != g.tsend (); ++it)
+        v1.push_back (&(*it));
+
+      for (scsr::tsiterator it = c.tsbegin (); it != c.tsend (); ++it)
+        v2.push_back (&(*it));
+
+      TS_ASSERT_EQUALS (v1.size (), static_cast<size_t>(30));
+      TS_ASSERT (v1 == v2);
+    }
+
+    void test_dijkstra ()
+    {
+      dgraph g;
+
+      for (int i = 0; i < 8; i++)
+        g.insert_vertex (i);
+
+      g.insert_edge (4, 0, 1);
+      g.insert_edge (1, 0, 2);
+      g.insert_edge (2, 2, 1);
+      g.insert_edge (1, 1, 3);
+      g.insert_edge (5, 2, 3);
+      g.insert_edge (3, 3, 4);
+      g.insert_edge (1, 5, 6);
+      g.insert_edge (1, 6, 5);
+
+      dcsr c = g.freeze ();
+
+      const int _distance [] = { 0, 3, 1, 4, 7 };
+      const int _previous [] = { -1, 2, 0, 1, 3 };
+      size_t _count = 0;
+      int _last = 0;
+
+      dcsr::djiterator it = c.djbegin (0);
+
+      for (; it != c.djend (); ++it, ++_count)
+      {
+        int _v = it->vertex ().value ();
+        TS_ASSERT (_v < 5);
+        TS_ASSERT_EQUALS (it.distance (it.id ()), _distance [_v]);
+        TS_ASSERT (_last <= it.distance (it.id ()));
+        _last = it.distance (it.id ());
+      }
+
+      TS_ASSERT_EQUALS (_count, static_cast<size_t>(5));
+
+      it = c.djbegin (0);
+      while (it != c.djend ())
+        ++it;
+
+      for (size_t i = 1; i < 5; i++)
+        TS_ASSERT_EQUALS (it.previous (i), static_cast<size_t>(_previous [i]));
+
+      TS_ASSERT_EQUALS (it.inf_distance (5), true);
+    }
+
+    void test_minspantree ()
+    {
+      ugraph g;
+
+      for (int i = 0; i < 5; i++)
+        g.insert_vertex (i);
+
+      g.insert_edge (2, 0, 1);
+      g.insert_edge (6, 0, 3);
+      g.insert_edge (3, 1, 2);
+      g.insert_edge (8, 1, 3);
+      g.insert_edge (5, 1, 4);
+      g.insert_edge (7, 2, 4);
+      g.insert_edge (9, 3, 4);
+
+      ucsr c = g.freeze ();
+
+      TS_ASSERT_EQUALS (c.is_directed (), false);
+      TS_ASSERT_EQUALS (c.num_edges (), static_cast<size_t>(14));
+
+      int _sum = 0;
+      size_t _count = 0;
+
+      for (ucsr::piterator it = c.pbegin (); it != c.pend (); ++it, ++_count)
+        _sum += it->value ();
+
+      TS_ASSERT_EQUALS (_count, static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (_sum, 16);
+
+      _sum = 0;
+      _count = 0;
+      int _last = 0;
+
+      for (ucsr::kiterator it = c.kbegin (); it != c.kend (); ++it, ++_count)
+      {
+        TS_ASSERT (_last <= it->value ());
+        _last = it->value ();
+        _sum += it->value ();
+      }
+
+      TS_ASSERT_EQUALS (_count, static_cast<size_t>(4));
+      TS_ASSERT_EQUALS (_sum, 16);
+    }
+
+    void test_scc ()
+    {
+      sgraph g;
+
+      for (int i = 0; i < 6; i++)
+        g.insert_vertex (i);
+
+      g.insert_edge (0, 1);
+      g.insert_edge (1, 2);
+      g.insert_edge (2, 0);
+      g.insert_edge (2, 3);
+      g.insert_edge (3, 4);
+      g.insert_edge (4, 3);
+
+      scsr c = g.freeze ();
+
+      std::vector<int> _component (6, -1);
+      size_t _count = 0;
+
+      for (scsr::scciterator it = c.sccbegin (); it != c.sccend (); ++it, ++_count)
+      {
+        for (cgt::csr::_CSRComponent::const_iterator itC = it->begin (); itC != it->end (); ++itC)
+        {
+          TS_ASSERT_EQUALS (_component [*itC], -1);
+          _component [*itC] = static_cast<int>(it.index ());
+        }
+      }
+
+      TS_ASSERT_EQUALS (_count, static_cast<size_t>(3));
+      TS_ASSERT_EQUALS (_component [0], _component [1]);
+      TS_ASSERT_EQUALS (_component [0], _component [2]);
+      TS_ASSERT_EQUALS (_component [3], _component [4]);
+      TS_ASSERT_DIFFERS (_component [0], _component [3]);
+      TS_ASSERT_DIFFERS (_component [5], _component [0]);
+      TS_ASSERT_DIFFERS (_component [5], _component [3]);
+    }
+
+    void test_empty ()
+    {
+      dgraph g;
+      dcsr c = g.freeze ();
+
+      TS_ASSERT_EQUALS (c.num_vertices (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (c.bbegin (), c.bend ());
+      TS_ASSERT_EQUALS (c.dbegin (), c.dend ());
+      TS_ASSERT_EQUALS (c.djbegin (), c.djend ());
+      TS_ASSERT_EQUALS (c.pbegin (), c.pend ());
+      TS_ASSERT_EQUALS (c.kbegin (), c.kend ());
+      TS_ASSERT_EQUALS (c.sccbegin (), c.sccend ());
+      TS_ASSERT_EQUALS (c.tsbegin (), c.tsend ());
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_GRAPH_CSR_CXX_H_
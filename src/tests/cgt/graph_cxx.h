@@ -88,6 +88,22 @@ class list_cxx : public CxxTest::TestSuite
 			++itn;
 			TS_ASSERT_EQUALS (true, itn->adjlist ().empty ());
 		}
+
+		void test_node_ids ()
+		{
+			TS_ASSERT_EQUALS (g.num_vertices (), static_cast<size_t>(4));
+
+			for (size_t i = 0; itn != g.end (); ++itn, ++i)
+			{
+				TS_ASSERT_EQUALS (itn->id (), i);
+				TS_ASSERT_EQUALS (&(g.get_node_by_id (i)), &(*itn));
+			}
+
+			/* an existing vertex keeps its id */
+			g.insert_vertex (2);
+			TS_ASSERT_EQUALS (g.num_vertices (), static_cast<size_t>(4));
+			TS_ASSERT_EQUALS (g.get_node (2)->id (), static_cast<size_t>(1));
+		}
 };
 
 #endif // __CGTL__CXXTEST_CGT_GRAPH_CXX_H_
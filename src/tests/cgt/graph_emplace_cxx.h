@@ -0,0 +1,191 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/graph_emplace_cxx.h
+ * \brief Functional tests for the methods that build vertices and edges in place.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * These methods need C++11 (see cgt/misc/cxx11.h): built as C++98, the
+ * tests are empty.
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_GRAPH_EMPLACE_CXX_H_
+#define __CGTL__CXXTEST_CGT_GRAPH_EMPLACE_CXX_H_
+
+#include <string>
+
+#include <cxxtest/TestSuite.h>
+
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/graph.h"
+
+
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+/* a value that counts how many times values of its type were copied and moved */
+struct _Counted
+{
+  _Counted (const int& _v) : value (_v) { }
+  _Counted (const int& _v1, const int& _v2) : value (_v1 * _v2) { }
+  _Counted (const _Counted& _c) : value (_c.value) { copies++; }
+  _Counted (_Counted&& _c) : value (_c.value) { moves++; }
+
+  _Counted& operator=(const _Counted& _c) { value = _c.value; copies++; return *this; }
+  const bool operator==(const _Counted& _c) const { return (value == _c.value); }
+
+  static void reset () { copies = 0; moves = 0; }
+
+  int value;
+
+  static int copies;
+  static int moves;
+};
+
+int _Counted::copies = 0;
+int _Counted::moves = 0;
+#endif
+
+
+class graph_emplace_cxx : public CxxTest::TestSuite
+{
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_emplace_vertex ()
+    {
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+      typedef cgt::graph<_Counted, int> graph;
+      graph g;
+
+      _Counted::reset ();
+      graph::iterator it1 = g.emplace_vertex (1);
+      graph::iterator it2 = g.emplace_vertex (2, 3);
+      graph::iterator it3 = g.insert_vertex (_Counted (4));
+
+      TS_ASSERT_EQUALS (_Counted::copies, 0);
+      TS_ASSERT_EQUALS (_Counted::moves, 3);
+
+      TS_ASSERT_EQUALS (it1->value ().value, 1);
+      TS_ASSERT_EQUALS (it2->value ().value, 6);
+      TS_ASSERT_EQUALS (it3->value ().value, 4);
+
+      /* a vertex already in the graph isn't inserted again */
+      _Counted::reset ();
+      TS_ASSERT (g.emplace_vertex (6) == it2);
+      TS_ASSERT_EQUALS (g.num_vertices (), static_cast<size_t>(3));
+      TS_ASSERT_EQUALS (_Counted::copies, 0);
+      TS_ASSERT_EQUALS (_Counted::moves, 0);
+
+      TS_ASSERT_EQUALS (g.get_node_by_id (1).value ().value, 6);
+#endif
+    }
+
+    void test_emplace_edge ()
+    {
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+      typedef cgt::graph<std::string, _Counted> graph;
+      graph g;
+
+      graph::iterator it1 = g.emplace_vertex ("a");
+      graph::iterator it2 = g.emplace_vertex (3, 'b');
+      graph::iterator it3 = g.insert_vertex (std::string ("c"));
+
+      TS_ASSERT_EQUALS (it2->value (), std::string ("bbb"));
+
+      _Counted::reset ();
+      g.emplace_edge (it1, it2, 5);
+      g.emplace_edge ("b", "c", 2, 4);
+      g.insert_edge (_Counted (7), it3, it1);
+
+      /* values built in place are never copied nor moved, rvalues are moved once */
+      TS_ASSERT_EQUALS (_Counted::copies, 0);
+      TS_ASSERT_EQUALS (_Counted::moves, 1);
+
+      TS_ASSERT_EQUALS (g.get_node ("a")->adjlist ().front ().edge ().value ().value, 5);
+      TS_ASSERT_EQUALS (g.get_node ("bbb")->adjlist ().size (), static_cast<size_t>(0));
+      TS_ASSERT_EQUALS (it3->adjlist ().front ().edge ().value ().value, 7);
+
+      /* an edge that's already in the graph isn't built, and one with an unknown vertex neither */
+      _Counted::reset ();
+      g.emplace_edge (it1, it2, 9);
+      g.insert_edge (_Counted (9), it3, it1);
+      TS_ASSERT_EQUALS (_Counted::moves, 0);
+      TS_ASSERT_EQUALS (it1->adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (it1->adjlist ().front ().edge ().value ().value, 5);
+
+      g.emplace_edge ("bbb", "c", 8);
+      TS_ASSERT_EQUALS (it2->adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (it2->get_edge (*it3)->value ().value, 8);
+#endif
+    }
+
+    void test_emplace_undirected ()
+    {
+#ifdef CGTL_HAS_RVALUE_REFERENCES
+      typedef cgt::graph<std::string, _Counted, cgt::_Undirected> graph;
+      graph g;
+
+      g.emplace_vertex ("x");
+      g.emplace_vertex ("y");
+
+      _Counted::reset ();
+      g.emplace_edge ("x", "y", 1);
+      g.emplace_edge ("y", "x", 2);
+
+      /* one edge, shared by both nodes */
+      TS_ASSERT_EQUALS (_Counted::copies, 0);
+      TS_ASSERT_EQUALS (g.get_node ("x")->adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (g.get_node ("y")->adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (&(g.get_node ("x")->adjlist ().front ().edge ()), &(g.get_node ("y")->adjlist ().front ().edge ()));
+#endif
+    }
+
+    void test_list_emplace_back ()
+    {
+#if defined (CGTL_HAS_RVALUE_REFERENCES) && defined (CGTL_DO_NOT_USE_STL)
+      cgt::base::list<_Counted> l;
+
+      _Counted::reset ();
+      l.emplace_back (2, 5);
+      l.push_back (_Counted (3));
+
+      TS_ASSERT_EQUALS (_Counted::copies, 0);
+      TS_ASSERT_EQUALS (_Counted::moves, 1);
+      TS_ASSERT_EQUALS (l.size (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (l.front ().value, 10);
+      TS_ASSERT_EQUALS (l.back ().value, 3);
+
+      /* an lvalue is copied once, with no temporary item */
+      _Counted c (4);
+      l.push_back (c);
+      TS_ASSERT_EQUALS (_Counted::copies, 1);
+#endif
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_GRAPH_EMPLACE_CXX_H_
@@ -0,0 +1,185 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/graph_no_inverse_cxx.h
+ * \brief Functional tests for graphs without inverted adjacency lists.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_GRAPH_NO_INVERSE_CXX_H_
+#define __CGTL__CXXTEST_CGT_GRAPH_NO_INVERSE_CXX_H_
+
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/graph.h"
+
+
+class graph_no_inverse_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                                  dgraph;
+    typedef cgt::graph<int, int, cgt::_DirectedNoInverse>         fgraph;
+    typedef cgt::graph<int, void, cgt::_UndirectedNoInverse>      ugraph;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  private:
+    /* two cycles (0, 1, 2) and (3, 4), linked by 2 -> 3, and an isolated vertex 5 */
+    template<typename _TpGraph>
+      void _build (_TpGraph& g)
+      {
+        for (int i = 0; i < 6; i++)
+          g.insert_vertex (i);
+
+        g.insert_edge (1, 0, 1);
+        g.insert_edge (2, 1, 2);
+        g.insert_edge (3, 2, 0);
+        g.insert_edge (4, 2, 3);
+        g.insert_edge (5, 3, 4);
+        g.insert_edge (6, 4, 3);
+      }
+
+    /* the index of the component of each vertex, in the order given by the scciterator */
+    template<typename _TpGraph>
+      std::vector<int> _components (_TpGraph& g)
+      {
+        std::vector<int> _component (6, -1);
+        int _count = 0;
+
+        for (typename _TpGraph::scciterator it = g.sccbegin (); it != g.sccend (); ++it, ++_count)
+        {
+          typename _TpGraph::scc::const_iterator itEnd = it->end ();
+
+          for (typename _TpGraph::scc::const_iterator itC = it->begin (); itC != itEnd; ++itC)
+          {
+            TS_ASSERT_EQUALS (_component [itC->node ().vertex ().value ()], -1);
+            _component [itC->node ().vertex ().value ()] = _count;
+          }
+        }
+
+        return _component;
+      }
+
+    template<typename _TpGraph>
+      void _assert_no_inverse (const _TpGraph& g)
+      {
+        for (typename _TpGraph::const_iterator it = g.begin (); it != g.end (); ++it)
+          TS_ASSERT (it->iadjlist ().empty ());
+      }
+
+  public:
+    void test_adjlist ()
+    {
+      fgraph g;
+      _build (g);
+
+      _assert_no_inverse (g);
+
+      fgraph::const_iterator it = g.begin ();
+      ++it; ++it;
+
+      TS_ASSERT_EQUALS (it->adjlist ().size (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (it->adjlist ().front ().edge ().value (), 3);
+      TS_ASSERT_EQUALS (it->adjlist ().back ().edge ().value (), 4);
+      TS_ASSERT (it->get_edge (g.get_node (3)->vertex ()));
+      TS_ASSERT (! g.get_node (3)->get_edge (it->vertex ()));
+    }
+
+    void test_insert_edges ()
+    {
+      fgraph g;
+
+      for (int i = 0; i < 3; i++)
+        g.insert_vertex (i);
+
+      std::vector<fgraph::edge_spec> edges;
+      edges.push_back (fgraph::edge_spec (1, 0, 1));
+      edges.push_back (fgraph::edge_spec (2, 1, 2));
+      edges.push_back (fgraph::edge_spec (3, 0, 1));
+
+      g.insert_edges (edges.begin (), edges.end ());
+
+      _assert_no_inverse (g);
+      TS_ASSERT_EQUALS (g.get_node (0)->adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (g.get_node (1)->adjlist ().size (), static_cast<size_t>(1));
+    }
+
+    void test_undirected ()
+    {
+      ugraph g;
+
+      for (int i = 0; i < 3; i++)
+        g.insert_vertex (i);
+
+      g.insert_edge (0, 1);
+      g.insert_edge (1, 2);
+
+      _assert_no_inverse (g);
+      TS_ASSERT_EQUALS (g.get_node (0)->adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (g.get_node (1)->adjlist ().size (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (g.get_node (2)->adjlist ().size (), static_cast<size_t>(1));
+    }
+
+    void test_scc ()
+    {
+      /*
+       * the scciterator copies nodes through references in STL
+       * mode (for any graph type), so it's only tested without STL
+       */
+#ifdef CGTL_DO_NOT_USE_STL
+      dgraph d;
+      fgraph f;
+
+      _build (d);
+      _build (f);
+
+      std::vector<int> _cd = _components (d);
+      std::vector<int> _cf = _components (f);
+
+      TS_ASSERT (_cd == _cf);
+      TS_ASSERT_EQUALS (_cf [0], _cf [1]);
+      TS_ASSERT_EQUALS (_cf [0], _cf [2]);
+      TS_ASSERT_EQUALS (_cf [3], _cf [4]);
+      TS_ASSERT_DIFFERS (_cf [0], _cf [3]);
+      TS_ASSERT_DIFFERS (_cf [5], _cf [0]);
+      TS_ASSERT_DIFFERS (_cf [5], _cf [3]);
+
+      /* the inverted lists built for the scciterator are released */
+      _assert_no_inverse (f);
+
+      /* and the graph still has its own edges */
+      TS_ASSERT_EQUALS (f.get_node (2)->adjlist ().size (), static_cast<size_t>(2));
+#endif
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_GRAPH_NO_INVERSE_CXX_H_
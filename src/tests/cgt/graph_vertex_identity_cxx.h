@@ -0,0 +1,182 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/graph_vertex_identity_cxx.h
+ * \brief Checks that iterators and edge insertion compare nodes by identity, not vertices by value.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_GRAPH_VERTEX_IDENTITY_CXX_H_
+#define __CGTL__CXXTEST_CGT_GRAPH_VERTEX_IDENTITY_CXX_H_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/graph.h"
+
+
+/* a vertex named by a string, that counts the comparisons between vertices */
+struct _Name
+{
+  _Name () { }
+  _Name (const int& _i)
+  {
+    char _buf [32];
+    sprintf (_buf, "vertex-%04d", _i);
+    name = _buf;
+  }
+
+  const bool operator==(const _Name& _n) const { compares++; return (name == _n.name); }
+
+  std::string name;
+
+  static size_t compares;
+};
+
+size_t _Name::compares = 0;
+
+
+class graph_vertex_identity_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<_Name, int> graph;
+
+    static const int NUM_VERTICES = 64;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  private:
+    /* edges i -> i + 1 and i -> 2i + 1 (the same for i = 0): a DAG whose nodes are all reachable from the first one */
+    static void _build (graph& g)
+    {
+      std::vector<graph::iterator> its;
+
+      for (int i = 0; i < NUM_VERTICES; i++)
+        its.push_back (g.insert_vertex (_Name (i)));
+
+      for (int i = 0; i < NUM_VERTICES; i++)
+      {
+        if (i + 1 < NUM_VERTICES)
+          g.insert_edge (1, its [i], its [i + 1]);
+
+        if (2 * i + 1 < NUM_VERTICES)
+          g.insert_edge (2, its [i], its [2 * i + 1]);
+      }
+
+      _Name::compares = 0;
+    }
+
+  public:
+    void test_insert_edge ()
+    {
+      graph g;
+      _build (g);
+
+      graph::iterator it1 = g.begin ();
+      graph::iterator it2 = g.begin ();
+      ++it2;
+
+      /* the edge is already there: it's found by the address of its node */
+      g.insert_edge (3, it1, it2);
+      TS_ASSERT_EQUALS (it1->adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (it1->get_edge (*it2)->value (), 1);
+      TS_ASSERT_EQUALS (_Name::compares, static_cast<size_t>(0));
+    }
+
+    void test_search ()
+    {
+      graph g;
+      _build (g);
+
+      int _count = 0;
+
+      for (graph::diterator it = g.dbegin (); it != g.dend (); ++it)
+        _count++;
+
+      for (graph::biterator it = g.bbegin (); it != g.bend (); ++it)
+        _count++;
+
+      TS_ASSERT_EQUALS (_count, 2 * NUM_VERTICES);
+      TS_ASSERT_EQUALS (_Name::compares, static_cast<size_t>(0));
+    }
+
+    void test_toposort ()
+    {
+      graph g;
+      _build (g);
+
+      int _count = 0;
+
+      for (graph::tsiterator it = g.tsbegin (); it != g.tsend (); ++it)
+        _count++;
+
+      TS_ASSERT_EQUALS (_count, NUM_VERTICES);
+      TS_ASSERT_EQUALS (_Name::compares, static_cast<size_t>(0));
+    }
+
+    void test_shortpath ()
+    {
+      /* the djiterator copies nodes through references in STL mode too (see test_dijkstra.cc) */
+#ifdef CGTL_DO_NOT_USE_STL
+      graph g;
+      _build (g);
+
+      int _count = 0;
+
+      for (graph::djiterator it = g.djbegin (); it != g.djend (); ++it)
+        _count++;
+
+      TS_ASSERT_EQUALS (_count, NUM_VERTICES);
+      TS_ASSERT_EQUALS (_Name::compares, static_cast<size_t>(0));
+#endif
+    }
+
+    void test_scc ()
+    {
+      /* the scciterator copies nodes through references in STL mode (see graph_no_inverse_cxx) */
+#ifdef CGTL_DO_NOT_USE_STL
+      graph g;
+      _build (g);
+
+      int _count = 0;
+
+      for (graph::scciterator it = g.sccbegin (); it != g.sccend (); ++it)
+        _count++;
+
+      TS_ASSERT_EQUALS (_count, NUM_VERTICES);
+      TS_ASSERT_EQUALS (_Name::compares, static_cast<size_t>(0));
+#endif
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_GRAPH_VERTEX_IDENTITY_CXX_H_
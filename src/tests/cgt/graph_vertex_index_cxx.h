@@ -0,0 +1,124 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/graph_vertex_index_cxx.h
+ * \brief Functional tests for graphs with an index of vertices.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_GRAPH_VERTEX_INDEX_CXX_H_
+#define __CGTL__CXXTEST_CGT_GRAPH_VERTEX_INDEX_CXX_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include <string>
+
+#include "cgt/misc/cxxtest_defs.h"
+#include "cgt/graph.h"
+
+
+struct string_hash
+{
+  const size_t operator()(const std::string& _s) const
+  {
+    size_t _h = 0;
+
+    for (size_t i = 0; i < _s.size (); i++)
+      _h = 31*_h + static_cast<unsigned char>(_s [i]);
+
+    return _h;
+  }
+};
+
+
+class graph_vertex_index_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, void, cgt::_Directed, cgt::base::_HashFunc<int> >         igraph;
+    typedef cgt::graph<std::string, int, cgt::_Undirected, string_hash>              sgraph;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  public:
+    void test_find ()
+    {
+      igraph g;
+
+      for (int i = 0; i < 100; i++)
+        g.insert_vertex (i);
+
+      for (int i = 0; i < 100; i++)
+      {
+        TS_ASSERT_DIFFERS (g.find (i), g.end ());
+        TS_ASSERT_EQUALS (g.find (i)->vertex ().value (), i);
+        TS_ASSERT_EQUALS (g.get_node (i), &(*(g.find (i))));
+      }
+
+      TS_ASSERT_EQUALS (g.find (100), g.end ());
+      TS_ASSERT_EQUALS (g.get_node (-1), static_cast<const igraph::node *>(NULL));
+    }
+
+    void test_insert_duplicated ()
+    {
+      igraph g;
+
+      igraph::iterator it = g.insert_vertex (1);
+      g.insert_vertex (2);
+
+      TS_ASSERT_EQUALS (g.insert_vertex (1), it);
+
+      size_t _count = 0;
+      for (igraph::iterator itn = g.begin (); itn != g.end (); ++itn)
+        _count++;
+
+      TS_ASSERT_EQUALS (_count, static_cast<size_t>(2));
+    }
+
+    void test_insert_edge ()
+    {
+      sgraph g;
+
+      g.insert_vertex ("a");
+      g.insert_vertex ("b");
+      g.insert_vertex ("c");
+
+      g.insert_edge (1, "a", "b");
+      g.insert_edge (2, "b", "c");
+      g.insert_edge (3, "a", "d");
+
+      sgraph::iterator it = g.find ("b");
+      TS_ASSERT_DIFFERS (it, g.end ());
+      TS_ASSERT_EQUALS (it->vertex ().value (), "b");
+      TS_ASSERT_EQUALS (it->adjlist ().size (), static_cast<size_t>(2));
+      TS_ASSERT_EQUALS (g.find ("a")->adjlist ().size (), static_cast<size_t>(1));
+      TS_ASSERT_EQUALS (g.find ("d"), g.end ());
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_GRAPH_VERTEX_INDEX_CXX_H_
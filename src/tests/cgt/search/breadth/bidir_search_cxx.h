@@ -0,0 +1,206 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/search/breadth/bidir_search_cxx.h
+ * \brief Contains unit tests for class cgt::search::breadth::_BidirSearch.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_SEARCH_BREADTH_BIDIR_SEARCH_CXX_H_
+#define __CGTL__CXXTEST_CGT_SEARCH_BREADTH_BIDIR_SEARCH_CXX_H_
+
+#include <cstdlib>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/graph.h"
+
+
+class bidir_search_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                                                            mygraph;
+    typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> >                dgraph;
+    typedef cgt::graph<int, int, cgt::_Undirected, cgt::base::_HashFunc<int> >              ugraph;
+    typedef cgt::graph<int, int, cgt::_DirectedNoInverse, cgt::base::_HashFunc<int> >       fgraph;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  private:
+    /* a random graph of _n vertices and _m edges per vertex */
+    template<typename _TpGraph>
+      void _build (_TpGraph& g, const int& _n, const int& _m)
+      {
+        std::vector<typename _TpGraph::iterator> its;
+
+        for (int i = 0; i < _n; i++)
+          its.push_back (g.insert_vertex (i));
+
+        srand (1);
+        for (int i = 0; i < _n; i++)
+          for (int j = 0; j < _m; j++)
+            g.insert_edge (j, its [i], its [rand () % _n]);
+      }
+
+    /*
+     * compares the distances from some nodes to random targets with the
+     * levels of a local biterator, and checks that each path is made of
+     * edges from the source to the target
+     */
+    template<typename _TpGraph>
+      void _check (_TpGraph& g)
+      {
+        typename _TpGraph::bdsearch s = g.bdsearch_init ();
+        typename _TpGraph::search_workspace ws;
+        size_t _n = g.num_vertices ();
+        size_t _unreachable = 0;
+
+        srand (2);
+        for (int k = 0; k < 10; k++)
+        {
+          const typename _TpGraph::node& _source = g.get_node_by_id (rand () % _n);
+          std::vector<size_t> _level (_n, _TpGraph::bdsearch::npos);
+
+          typename _TpGraph::biterator it = g.bbegin (g.find (_source.value ()), ws);
+
+          for (; it != g.bend (); ++it)
+          {
+            const typename _TpGraph::node* _ptr_parent = it.info (*it)->parent ();
+            _level [it->id ()] = (_ptr_parent ? _level [_ptr_parent->id ()] + 1 : 0);
+          }
+
+          for (int j = 0; j < 20; j++)
+          {
+            const typename _TpGraph::node& _target = g.get_node_by_id (rand () % _n);
+
+            TS_ASSERT_EQUALS (s.run (_source, _target), _level [_target.id ()]);
+            TS_ASSERT_EQUALS (s.distance (), _level [_target.id ()]);
+
+            if (s.distance () == _TpGraph::bdsearch::npos)
+            {
+              TS_ASSERT (s.path ().empty ());
+              _unreachable++;
+              continue;
+            }
+
+            TS_ASSERT_EQUALS (s.path ().size (), s.distance () + 1);
+            TS_ASSERT_EQUALS (s.path ().front (), &_source);
+            TS_ASSERT_EQUALS (s.path ().back (), &_target);
+
+            for (size_t i = 1; i < s.path ().size (); i++)
+              TS_ASSERT (s.path () [i - 1]->get_edge (*(s.path () [i])));
+          }
+        }
+      }
+
+  public:
+    void test_basic ()
+    {
+      mygraph g;
+
+      g.insert_vertex (1);
+      g.insert_vertex (2);
+      g.insert_vertex (3);
+      g.insert_vertex (4);
+      g.insert_vertex (5);
+      g.insert_vertex (6);
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 2, 3);
+      g.insert_edge (30, 2, 4);
+      g.insert_edge (40, 3, 5);
+      g.insert_edge (50, 4, 5);
+      g.insert_edge (60, 5, 6);
+
+      mygraph::bdsearch s = g.bdsearch_init ();
+
+      TS_ASSERT_EQUALS (s.run (*g.get_node (1), *g.get_node (6)), 4);
+      TS_ASSERT_EQUALS (s.path ().size (), 5);
+      TS_ASSERT_EQUALS (s.path () [0], g.get_node (1));
+      TS_ASSERT_EQUALS (s.path () [1], g.get_node (2));
+      TS_ASSERT_EQUALS (s.path () [3], g.get_node (5));
+      TS_ASSERT_EQUALS (s.path () [4], g.get_node (6));
+
+      TS_ASSERT_EQUALS (s.run (*g.get_node (3), *g.get_node (3)), 0);
+      TS_ASSERT_EQUALS (s.path ().size (), 1);
+      TS_ASSERT_EQUALS (s.path () [0], g.get_node (3));
+
+      /* the edges are directed */
+      TS_ASSERT_EQUALS (s.run (*g.get_node (6), *g.get_node (1)), mygraph::bdsearch::npos);
+      TS_ASSERT (s.path ().empty ());
+
+      TS_ASSERT_EQUALS (s.run (*g.get_node (2), *g.get_node (5)), 2);
+    }
+
+    void test_directed ()
+    {
+      dgraph g;
+      _build (g, 5000, 2);
+      _check (g);
+    }
+
+    void test_undirected ()
+    {
+      ugraph g;
+      _build (g, 5000, 2);
+      _check (g);
+    }
+
+    void test_no_inverse ()
+    {
+      /* without inverted lists the search grows from the source only */
+      fgraph g;
+      _build (g, 5000, 2);
+      _check (g);
+    }
+
+    void test_explored ()
+    {
+      /* a path of _n nodes: the search from both ends explores each node once */
+      ugraph g;
+      const int _n = 1000;
+
+      for (int i = 0; i < _n; i++)
+        g.insert_vertex (i);
+
+      for (int i = 1; i < _n; i++)
+        g.insert_edge (i, i - 1, i);
+
+      ugraph::bdsearch s = g.bdsearch_init ();
+
+      TS_ASSERT_EQUALS (s.run (*g.get_node (0), *g.get_node (_n - 1)), _n - 1);
+      TS_ASSERT_EQUALS (s.explored (), _n);
+
+      TS_ASSERT_EQUALS (s.run (*g.get_node (400), *g.get_node (410)), 10);
+      /* two nodes per level on each side, at most */
+      TS_ASSERT (s.explored () <= 2 * 10 + 2);
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_SEARCH_BREADTH_BIDIR_SEARCH_CXX_H_
@@ -0,0 +1,167 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/search/breadth/bitparallel_search_cxx.h
+ * \brief Contains unit tests for class cgt::search::breadth::_BitParallelSearch.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_SEARCH_BREADTH_BITPARALLEL_SEARCH_CXX_H_
+#define __CGTL__CXXTEST_CGT_SEARCH_BREADTH_BITPARALLEL_SEARCH_CXX_H_
+
+#include <cstdlib>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/graph.h"
+
+
+class bitparallel_search_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                                                  mygraph;
+    typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> >      dgraph;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  private:
+    /* compares the search of each source with a local biterator from it */
+    void _check (dgraph& g, const dgraph::mssearch& _s)
+    {
+      dgraph::search_workspace ws;
+
+      for (size_t i = 0; i < _s.num_sources (); i++)
+      {
+        std::vector<size_t> _level (g.num_vertices (), dgraph::mssearch::npos);
+        size_t _count = 0;
+        size_t _max = 0;
+        unsigned long _sum = 0;
+
+        dgraph::iterator itSource = g.find (_s.source (i).vertex ().value ());
+
+        for (dgraph::biterator it = g.bbegin (itSource, ws); it != g.bend (); ++it, ++_count)
+        {
+          const dgraph::node* _ptr_parent = it.info (*it)->parent ();
+          _level [it->id ()] = (_ptr_parent ? _level [_ptr_parent->id ()] + 1 : 0);
+          _sum += _level [it->id ()];
+          _max = _level [it->id ()];
+        }
+
+        TS_ASSERT_EQUALS (_s.reached (i), _count);
+        TS_ASSERT_EQUALS (_s.distance_sum (i), _sum);
+        TS_ASSERT_EQUALS (_s.eccentricity (i), _max);
+
+        for (size_t j = 0; j < g.num_vertices (); j++)
+        {
+          TS_ASSERT_EQUALS (_s.distance (i, g.get_node_by_id (j)), _level [j]);
+          TS_ASSERT_EQUALS (_s.is_reached (i, g.get_node_by_id (j)), _level [j] != dgraph::mssearch::npos);
+        }
+      }
+    }
+
+  public:
+    void test_basic ()
+    {
+      mygraph g;
+      std::vector<mygraph::iterator> its;
+
+      its.push_back (g.insert_vertex (1));
+      its.push_back (g.insert_vertex (2));
+      its.push_back (g.insert_vertex (3));
+      its.push_back (g.insert_vertex (4));
+      its.push_back (g.insert_vertex (5));
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 2, 3);
+      g.insert_edge (30, 2, 4);
+      g.insert_edge (40, 3, 5);
+
+      mygraph::mssearch s = g.mssearch_init ();
+      s.keep_distances (true);
+      s.run (its.begin (), its.end ());
+
+      TS_ASSERT_EQUALS (s.capacity (), cgt::base::_BITS_PER_WORD);
+      TS_ASSERT_EQUALS (s.num_sources (), 5);
+
+      /* from 1: 2 at 1, 3 and 4 at 2, 5 at 3 */
+      TS_ASSERT_EQUALS (s.reached (0), 5);
+      TS_ASSERT_EQUALS (s.distance_sum (0), 8);
+      TS_ASSERT_EQUALS (s.eccentricity (0), 3);
+      TS_ASSERT_EQUALS (s.distance (0, *g.get_node (4)), 2);
+
+      /* from 3: only 5 */
+      TS_ASSERT_EQUALS (s.reached (2), 2);
+      TS_ASSERT_EQUALS (s.distance (2, *g.get_node (5)), 1);
+      TS_ASSERT_EQUALS (s.distance (2, *g.get_node (1)), mygraph::mssearch::npos);
+      TS_ASSERT (! s.is_reached (2, *g.get_node (4)));
+
+      /* from 5: nothing else */
+      TS_ASSERT_EQUALS (s.reached (4), 1);
+      TS_ASSERT_EQUALS (s.eccentricity (4), 0);
+    }
+
+    void test_random ()
+    {
+      dgraph g;
+      std::vector<dgraph::iterator> its;
+
+      for (int i = 0; i < 3000; i++)
+        its.push_back (g.insert_vertex (i));
+
+      srand (1);
+      for (int i = 0; i < 3000; i++)
+        for (int j = 0; j < 2; j++)
+          g.insert_edge (j, its [i], its [rand () % 3000]);
+
+      /* 100 sources in 2 words, with a repeated one */
+      std::vector<dgraph::iterator> sources;
+
+      for (int i = 0; i < 99; i++)
+        sources.push_back (its [rand () % 3000]);
+
+      sources.push_back (sources [0]);
+
+      dgraph::mssearch s = g.mssearch_init (2);
+      s.keep_distances (true);
+      s.run (sources.begin (), sources.end ());
+
+      TS_ASSERT_EQUALS (s.num_sources (), 100);
+      _check (g, s);
+
+      /* one word: only the first 64 (or 32) sources */
+      dgraph::mssearch s1 = g.mssearch_init (1);
+      s1.keep_distances (true);
+      s1.run (sources.begin (), sources.end ());
+
+      TS_ASSERT_EQUALS (s1.num_sources (), s1.capacity ());
+      _check (g, s1);
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_SEARCH_BREADTH_BITPARALLEL_SEARCH_CXX_H_
@@ -33,6 +33,8 @@
 #ifndef __CGTL__CXXTEST_CGT_SEARCH_BREADTH_BREADTH_ITERATOR_CXX_H_
 #define __CGTL__CXXTEST_CGT_SEARCH_BREADTH_BREADTH_ITERATOR_CXX_H_
 
+#include <vector>
+
 #include <cxxtest/TestSuite.h>
 //#include "cgt/misc/cxxtest_defs.h"
 #include "cgt/graph.h"
@@ -42,6 +44,7 @@ class breadth_iterator_cxx : public CxxTest::TestSuite
 {
   private:
     typedef cgt::graph<int, int> mygraph;
+    typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> > hgraph;
 
   public:
     void setUp () { }
@@ -94,6 +97,225 @@ class breadth_iterator_cxx : public CxxTest::TestSuite
 
       TS_ASSERT_EQUALS (it, itEnd);
     }
+
+    void test_info ()
+    {
+      mygraph g;
+
+      g.insert_vertex (1);
+      g.insert_vertex (2);
+      g.insert_vertex (3);
+      g.insert_vertex (4);
+      g.insert_vertex (5);
+      g.insert_vertex (6);
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 2, 3);
+      g.insert_edge (30, 2, 4);
+      g.insert_edge (40, 3, 5);
+
+      mygraph::biterator it = g.bbegin ();
+
+      while (it != g.bend ())
+        ++it;
+
+      /* every node was finished, and 6 (not reachable from 1) started a new tree */
+      TS_ASSERT_EQUALS (it.info (*g.get_node (1))->parent (), static_cast<const mygraph::node*>(NULL));
+      TS_ASSERT_EQUALS (it.info (*g.get_node (2))->parent (), g.get_node (1));
+      TS_ASSERT_EQUALS (it.info (*g.get_node (3))->parent (), g.get_node (2));
+      TS_ASSERT_EQUALS (it.info (*g.get_node (4))->parent (), g.get_node (2));
+      TS_ASSERT_EQUALS (it.info (g.get_node (5))->parent (), g.get_node (3));
+      TS_ASSERT_EQUALS (it.info (g.get_node (6))->parent (), static_cast<const mygraph::node*>(NULL));
+
+      int _count = 0;
+
+      for (mygraph::biiterator itI = g.bibegin (it); itI != g.biend (it); ++itI, ++_count)
+      {
+        TS_ASSERT_EQUALS (itI->color (), mygraph::breadth_info::BLACK);
+        TS_ASSERT (itI->discovery () < itI->finish ());
+      }
+
+      TS_ASSERT_EQUALS (_count, 6);
+    }
+
+    void test_workspace ()
+    {
+      mygraph g;
+      mygraph::search_workspace ws;
+
+      mygraph::iterator it1 = g.insert_vertex (1);
+      mygraph::iterator it2 = g.insert_vertex (2);
+      mygraph::iterator it3 = g.insert_vertex (3);
+      g.insert_vertex (4);
+      g.insert_vertex (5);
+      g.insert_vertex (6);
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 2, 3);
+      g.insert_edge (30, 2, 4);
+      g.insert_edge (40, 3, 5);
+      g.insert_edge (50, 6, 1);
+
+      /* a local search visits only the nodes reachable from the first one */
+      const int _order [] = { 2, 3, 4, 5 };
+      int _count = 0;
+
+      mygraph::biterator it = g.bbegin (it2, ws);
+
+      for (; it != g.bend (); ++it, ++_count)
+        TS_ASSERT_EQUALS (it->vertex ().value (), _order [_count]);
+
+      TS_ASSERT_EQUALS (_count, 4);
+      TS_ASSERT_EQUALS (ws.size (), 4);
+      TS_ASSERT_EQUALS (it.info (*g.get_node (1)), static_cast<const mygraph::breadth_info*>(NULL));
+      TS_ASSERT_EQUALS (it.info (*g.get_node (6)), static_cast<const mygraph::breadth_info*>(NULL));
+      TS_ASSERT_EQUALS (it.info (*g.get_node (2))->parent (), static_cast<const mygraph::node*>(NULL));
+      TS_ASSERT_EQUALS (it.info (*g.get_node (5))->parent (), g.get_node (3));
+
+      _count = 0;
+
+      for (mygraph::biiterator itI = g.bibegin (it); itI != g.biend (it); ++itI, ++_count)
+      {
+        TS_ASSERT_EQUALS (itI->color (), mygraph::breadth_info::BLACK);
+        TS_ASSERT (itI->discovery () < itI->finish ());
+      }
+
+      TS_ASSERT_EQUALS (_count, 4);
+
+      /* the next search reuses the workspace, and forgets the nodes of the previous one */
+      _count = 0;
+
+      for (it = g.bbegin (it3, ws); it != g.bend (); ++it)
+        _count++;
+
+      TS_ASSERT_EQUALS (_count, 2);
+      TS_ASSERT_EQUALS (ws.size (), 2);
+      TS_ASSERT_EQUALS (it.info (*g.get_node (2)), static_cast<const mygraph::breadth_info*>(NULL));
+      TS_ASSERT_EQUALS (it.info (*g.get_node (5))->color (), mygraph::breadth_info::BLACK);
+
+      _count = 0;
+
+      for (it = g.bbegin (it1, ws); it != g.bend (); ++it)
+        _count++;
+
+      TS_ASSERT_EQUALS (_count, 5);
+    }
+
+    void test_many_sources ()
+    {
+      mygraph g;
+      mygraph::search_workspace ws;
+      std::vector<mygraph::iterator> sources;
+
+      mygraph::iterator it1 = g.insert_vertex (1);
+      g.insert_vertex (2);
+      mygraph::iterator it3 = g.insert_vertex (3);
+      g.insert_vertex (4);
+      g.insert_vertex (5);
+      mygraph::iterator it6 = g.insert_vertex (6);
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 2, 3);
+      g.insert_edge (30, 2, 4);
+      g.insert_edge (40, 3, 5);
+      g.insert_edge (50, 6, 5);
+
+      /* the sources come first, and each node is reached from the nearest one */
+      sources.push_back (it1);
+      sources.push_back (it6);
+
+      const int _order [] = { 1, 6, 2, 5, 3, 4 };
+      int _count = 0;
+
+      mygraph::biterator it = g.bbegin (sources.begin (), sources.end (), ws);
+
+      for (; it != g.bend (); ++it, ++_count)
+        TS_ASSERT_EQUALS (it->vertex ().value (), _order [_count]);
+
+      TS_ASSERT_EQUALS (_count, 6);
+      TS_ASSERT_EQUALS (it.info (*g.get_node (6))->parent (), static_cast<const mygraph::node*>(NULL));
+      TS_ASSERT_EQUALS (it.info (*g.get_node (5))->parent (), g.get_node (6));
+
+      /* repeated sources are visited once */
+      sources.clear ();
+      sources.push_back (it3);
+      sources.push_back (it6);
+      sources.push_back (it3);
+      _count = 0;
+
+      for (it = g.bbegin (sources.begin (), sources.end (), ws); it != g.bend (); ++it)
+        _count++;
+
+      TS_ASSERT_EQUALS (_count, 3);
+      TS_ASSERT_EQUALS (it.info (*g.get_node (5))->parent (), g.get_node (3));
+
+      /* no sources, no search */
+      sources.clear ();
+      TS_ASSERT_EQUALS (g.bbegin (sources.begin (), sources.end (), ws), g.bend ());
+    }
+
+    void test_long_path ()
+    {
+      /* a path of 100000 nodes, visited in order (quadratic searches took minutes) */
+
+      const int _n = 100000;
+      hgraph g;
+      hgraph::iterator itPrev = g.insert_vertex (0);
+
+      for (int i = 1; i < _n; i++)
+      {
+        hgraph::iterator itV = g.insert_vertex (i);
+        g.insert_edge (i, itPrev, itV);
+        itPrev = itV;
+      }
+
+      int _count = 0;
+
+      for (hgraph::biterator it = g.bbegin (); it != g.bend (); ++it, ++_count)
+        TS_ASSERT_EQUALS (it->vertex ().value (), _count);
+
+      TS_ASSERT_EQUALS (_count, _n);
+    }
+
+    void test_copy ()
+    {
+      /* copies share the search: a copy keeps its node, and postfix ++ returns the previous one */
+
+      mygraph g;
+
+      g.insert_vertex (1);
+      g.insert_vertex (2);
+      g.insert_vertex (3);
+      g.insert_vertex (4);
+      g.insert_vertex (5);
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 2, 3);
+      g.insert_edge (30, 2, 4);
+      g.insert_edge (40, 3, 5);
+
+      mygraph::biterator it = g.bbegin ();
+      mygraph::biterator itCopy = it;
+
+      TS_ASSERT_EQUALS (itCopy->vertex ().value (), 1);
+
+      mygraph::biterator itOld = it++;
+
+      TS_ASSERT_EQUALS (itOld->vertex ().value (), 1);
+      TS_ASSERT_EQUALS (it->vertex ().value (), 2);
+      TS_ASSERT_EQUALS (itCopy->vertex ().value (), 1);
+
+      ++it;
+      ++it;
+      ++it;
+
+      TS_ASSERT_EQUALS (it->vertex ().value (), 5);
+      TS_ASSERT_EQUALS (itOld.info (*g.get_node (5))->parent (), g.get_node (3));
+
+      it++;
+
+      TS_ASSERT_EQUALS (it, g.bend ());
+    }
 };
 
 #endif // __CGTL__CXXTEST_CGT_SEARCH_BREADTH_BREADTH_ITERATOR_CXX_H_
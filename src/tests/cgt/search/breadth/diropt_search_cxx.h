@@ -0,0 +1,214 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/search/breadth/diropt_search_cxx.h
+ * \brief Contains unit tests for class cgt::search::breadth::_DirOptSearch.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_SEARCH_BREADTH_DIROPT_SEARCH_CXX_H_
+#define __CGTL__CXXTEST_CGT_SEARCH_BREADTH_DIROPT_SEARCH_CXX_H_
+
+#include <cstdlib>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/graph.h"
+
+
+class diropt_search_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                                                            mygraph;
+    typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> >                dgraph;
+    typedef cgt::graph<int, int, cgt::_Undirected, cgt::base::_HashFunc<int> >              ugraph;
+    typedef cgt::graph<int, int, cgt::_DirectedNoInverse, cgt::base::_HashFunc<int> >       fgraph;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  private:
+    /* a random graph of _n vertices and _m edges per vertex */
+    template<typename _TpGraph>
+      void _build (_TpGraph& g, const int& _n, const int& _m)
+      {
+        std::vector<typename _TpGraph::iterator> its;
+
+        for (int i = 0; i < _n; i++)
+          its.push_back (g.insert_vertex (i));
+
+        srand (1);
+        for (int i = 0; i < _n; i++)
+          for (int j = 0; j < _m; j++)
+            g.insert_edge (j, its [i], its [rand () % _n]);
+      }
+
+    /*
+     * compares the search from the node with id 0 with a local biterator:
+     * the same nodes at the same levels, and each parent at the previous
+     * level, with an edge to its child
+     */
+    template<typename _TpGraph>
+      void _check (_TpGraph& g, const typename _TpGraph::dosearch& _s)
+      {
+        typename _TpGraph::search_workspace ws;
+        std::vector<size_t> _level (g.num_vertices (), _TpGraph::dosearch::npos);
+        size_t _count = 0;
+
+        typename _TpGraph::biterator it = g.bbegin (g.begin (), ws);
+
+        for (; it != g.bend (); ++it, ++_count)
+        {
+          const typename _TpGraph::node* _ptr_parent = it.info (*it)->parent ();
+          _level [it->id ()] = (_ptr_parent ? _level [_ptr_parent->id ()] + 1 : 0);
+        }
+
+        TS_ASSERT_EQUALS (_s.size (), _count);
+
+        for (size_t i = 0; i < g.num_vertices (); i++)
+        {
+          const typename _TpGraph::node& _node = g.get_node_by_id (i);
+
+          TS_ASSERT_EQUALS (_s.level (_node), _level [i]);
+
+          if (_s.parent (_node))
+          {
+            TS_ASSERT_EQUALS (_s.level (*(_s.parent (_node))) + 1, _s.level (_node));
+            TS_ASSERT (_s.parent (_node)->get_edge (_node));
+          }
+        }
+      }
+
+  public:
+    void test_basic ()
+    {
+      mygraph g;
+
+      g.insert_vertex (1);
+      g.insert_vertex (2);
+      g.insert_vertex (3);
+      g.insert_vertex (4);
+      g.insert_vertex (5);
+      g.insert_vertex (6);
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 2, 3);
+      g.insert_edge (30, 2, 4);
+      g.insert_edge (40, 3, 5);
+      g.insert_edge (50, 4, 5);
+
+      /* top-down only, so the parents are the ones of the biterator */
+      mygraph::dosearch s = g.dosearch_init ();
+      s.set_alpha (0);
+      s.run (*g.get_node (1));
+
+      TS_ASSERT_EQUALS (s.size (), 5);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (1)), 0);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (2)), 1);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (4)), 2);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (5)), 3);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (6)), mygraph::dosearch::npos);
+      TS_ASSERT_EQUALS (s.parent (*g.get_node (1)), static_cast<const mygraph::node*>(NULL));
+      TS_ASSERT_EQUALS (s.parent (*g.get_node (5)), g.get_node (3));
+      TS_ASSERT_EQUALS (s.parent (*g.get_node (6)), static_cast<const mygraph::node*>(NULL));
+      TS_ASSERT_EQUALS (s.bottom_up_steps (), 0);
+
+      /* the next search starts over */
+      s.run (*g.get_node (3));
+
+      TS_ASSERT_EQUALS (s.size (), 2);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (1)), mygraph::dosearch::npos);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (5)), 1);
+    }
+
+    void test_bottom_up ()
+    {
+      dgraph g;
+      _build (g, 5000, 8);
+
+      dgraph::dosearch s = g.dosearch_init ();
+      s.run (g.get_node_by_id (0));
+
+      TS_ASSERT (s.bottom_up_steps () > 0);
+      TS_ASSERT (s.top_down_steps () > 0);
+      _check (g, s);
+
+      /* the same result top-down */
+      s.set_alpha (0);
+      s.run (g.get_node_by_id (0));
+
+      TS_ASSERT_EQUALS (s.bottom_up_steps (), 0);
+      _check (g, s);
+    }
+
+    void test_beta_zero ()
+    {
+      dgraph g;
+      _build (g, 5000, 8);
+
+      dgraph::dosearch s = g.dosearch_init ();
+      s.run (g.get_node_by_id (0));
+
+      size_t _top_down = s.top_down_steps ();
+
+      /* beta 0: once bottom-up, the search never goes back top-down */
+      s.set_beta (0);
+      s.run (g.get_node_by_id (0));
+
+      TS_ASSERT (s.bottom_up_steps () > 0);
+      TS_ASSERT (s.top_down_steps () < _top_down);
+      _check (g, s);
+    }
+
+    void test_undirected ()
+    {
+      ugraph g;
+      _build (g, 5000, 4);
+
+      ugraph::dosearch s = g.dosearch_init ();
+      s.run (g.get_node_by_id (0));
+
+      TS_ASSERT (s.bottom_up_steps () > 0);
+      _check (g, s);
+    }
+
+    void test_no_inverse ()
+    {
+      /* without inverted lists there's no bottom-up step */
+      fgraph g;
+      _build (g, 5000, 8);
+
+      fgraph::dosearch s = g.dosearch_init ();
+      s.run (g.get_node_by_id (0));
+
+      TS_ASSERT_EQUALS (s.bottom_up_steps (), 0);
+      _check (g, s);
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_SEARCH_BREADTH_DIROPT_SEARCH_CXX_H_
@@ -0,0 +1,174 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/search/breadth/parallel_search_cxx.h
+ * \brief Contains unit tests for class cgt::search::breadth::_ParallelSearch.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_SEARCH_BREADTH_PARALLEL_SEARCH_CXX_H_
+#define __CGTL__CXXTEST_CGT_SEARCH_BREADTH_PARALLEL_SEARCH_CXX_H_
+
+#include <cstdlib>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/graph.h"
+
+
+class parallel_search_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                                                  mygraph;
+    typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> >      dgraph;
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  private:
+    /*
+     * compares the search from the node with id 0 with a local biterator:
+     * the same nodes at the same levels, and each parent at the previous
+     * level, with an edge to its child
+     */
+    void _check (dgraph& g, const dgraph::psearch& _s)
+    {
+      dgraph::search_workspace ws;
+      std::vector<size_t> _level (g.num_vertices (), dgraph::psearch::npos);
+      size_t _count = 0;
+
+      for (dgraph::biterator it = g.bbegin (g.begin (), ws); it != g.bend (); ++it, ++_count)
+      {
+        const dgraph::node* _ptr_parent = it.info (*it)->parent ();
+        _level [it->id ()] = (_ptr_parent ? _level [_ptr_parent->id ()] + 1 : 0);
+      }
+
+      TS_ASSERT_EQUALS (_s.size (), _count);
+      TS_ASSERT_EQUALS (_s.levels ().size (), g.num_vertices ());
+
+      for (size_t i = 0; i < g.num_vertices (); i++)
+      {
+        const dgraph::node& _node = g.get_node_by_id (i);
+
+        TS_ASSERT_EQUALS (_s.levels () [i], _level [i]);
+        TS_ASSERT_EQUALS (_s.parents () [i], _s.parent (_node));
+
+        if (_s.parent (_node))
+        {
+          TS_ASSERT_EQUALS (_s.level (*(_s.parent (_node))) + 1, _s.level (_node));
+          TS_ASSERT (_s.parent (_node)->get_edge (_node));
+        }
+      }
+    }
+
+  public:
+    void test_basic ()
+    {
+      mygraph g;
+
+      g.insert_vertex (1);
+      g.insert_vertex (2);
+      g.insert_vertex (3);
+      g.insert_vertex (4);
+      g.insert_vertex (5);
+      g.insert_vertex (6);
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 2, 3);
+      g.insert_edge (30, 2, 4);
+      g.insert_edge (40, 3, 5);
+
+      mygraph::psearch s = g.psearch_init (4);
+      s.run (*g.get_node (1));
+
+      TS_ASSERT_EQUALS (s.num_threads (), 4);
+      TS_ASSERT_EQUALS (s.size (), 5);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (1)), 0);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (4)), 2);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (5)), 3);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (6)), mygraph::psearch::npos);
+      TS_ASSERT_EQUALS (s.parent (*g.get_node (1)), static_cast<const mygraph::node*>(NULL));
+      TS_ASSERT_EQUALS (s.parent (*g.get_node (5)), g.get_node (3));
+
+      /* the next search starts over */
+      s.run (*g.get_node (3));
+
+      TS_ASSERT_EQUALS (s.size (), 2);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (1)), mygraph::psearch::npos);
+      TS_ASSERT_EQUALS (s.level (*g.get_node (5)), 1);
+    }
+
+    void test_random ()
+    {
+      dgraph g;
+      std::vector<dgraph::iterator> its;
+
+      for (int i = 0; i < 20000; i++)
+        its.push_back (g.insert_vertex (i));
+
+      srand (1);
+      for (int i = 0; i < 20000; i++)
+        for (int j = 0; j < 4; j++)
+          g.insert_edge (j, its [i], its [rand () % 20000]);
+
+      for (size_t t = 1; t <= 8; t *= 2)
+      {
+        dgraph::psearch s = g.psearch_init (t);
+
+        s.run (g.get_node_by_id (0));
+        _check (g, s);
+
+        s.run (g.get_node_by_id (0));
+        _check (g, s);
+      }
+    }
+
+    void test_long_path ()
+    {
+      /* many levels of a single node: the threads meet 3 times at each one */
+      const int _n = 2000;
+      dgraph g;
+      dgraph::iterator itPrev = g.insert_vertex (0);
+
+      for (int i = 1; i < _n; i++)
+      {
+        dgraph::iterator itV = g.insert_vertex (i);
+        g.insert_edge (i, itPrev, itV);
+        itPrev = itV;
+      }
+
+      dgraph::psearch s = g.psearch_init (3);
+      s.run (g.get_node_by_id (0));
+
+      TS_ASSERT_EQUALS (s.size (), _n);
+      TS_ASSERT_EQUALS (s.level (g.get_node_by_id (_n - 1)), _n - 1);
+      _check (g, s);
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_SEARCH_BREADTH_PARALLEL_SEARCH_CXX_H_
@@ -0,0 +1,417 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/search/search_visitor_cxx.h
+ * \brief Contains unit tests for cgt::search::breadth_first and cgt::search::depth_first.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+#ifndef __CGTL__CXXTEST_CGT_SEARCH__SEARCH_VISITOR_CXX_H_
+#define __CGTL__CXXTEST_CGT_SEARCH__SEARCH_VISITOR_CXX_H_
+
+#include <cstdlib>
+#include <vector>
+#include <utility>
+
+#include <cxxtest/TestSuite.h>
+#include "cgt/graph.h"
+
+
+class search_visitor_cxx : public CxxTest::TestSuite
+{
+  private:
+    typedef cgt::graph<int, int>                                                            mygraph;
+    typedef cgt::graph<int, int, cgt::_Directed, cgt::base::_HashFunc<int> >                dgraph;
+    typedef cgt::graph<int, int, cgt::_Undirected, cgt::base::_HashFunc<int> >              ugraph;
+
+    /* records the nodes discovered (and their parents), the edges examined and the nodes finished */
+    template<typename _TpGraph>
+      struct _Recorder : public _TpGraph::visitor
+      {
+        typedef typename _TpGraph::node     _Node;
+        typedef typename _TpGraph::adjacency _Adjacency;
+
+        _Recorder () : _edges (0), _limit (0) { }
+
+        void discover (const _Node& _node, const _Node* _ptr_parent) { _nodes.push_back (&_node); _parents.push_back (_ptr_parent); }
+        void examine_edge (const _Node& _node, const _Adjacency& _adj) { _edges++; }
+        void finish (const _Node& _node) { _finished.push_back (&_node); }
+        const bool done () const { return (_limit && _nodes.size () == _limit); }
+
+        std::vector<const _Node*> _nodes;
+        std::vector<const _Node*> _parents;
+        std::vector<const _Node*> _finished;
+        size_t _edges;
+        size_t _limit;
+      };
+
+    /* counts the nodes with even values, and nothing else */
+    struct _EvenCounter : public dgraph::visitor
+    {
+      _EvenCounter () : _count (0) { }
+
+      void discover (const dgraph::node& _node, const dgraph::node* _ptr_parent) { if (_node.vertex ().value () % 2 == 0) _count++; }
+
+      size_t _count;
+    };
+
+    /* records the edges of each class, as pairs of values, and counts the nodes discovered without a parent */
+    template<typename _TpGraph>
+      struct _Classifier : public _TpGraph::visitor
+      {
+        typedef typename _TpGraph::node     _Node;
+        typedef typename _TpGraph::adjacency _Adjacency;
+        typedef std::vector<std::pair<int, int> > _Edges;
+
+        _Classifier () : _roots (0), _examined (0) { }
+
+        void discover (const _Node& _node, const _Node* _ptr_parent) { if (! _ptr_parent) _roots++; }
+        void examine_edge (const _Node& _node, const _Adjacency& _adj) { _examined++; }
+        void tree_edge (const _Node& _node, const _Adjacency& _adj) { _add (_tree, _node, _adj); }
+        void back_edge (const _Node& _node, const _Adjacency& _adj) { _add (_back, _node, _adj); }
+        void forward_edge (const _Node& _node, const _Adjacency& _adj) { _add (_forward, _node, _adj); }
+        void cross_edge (const _Node& _node, const _Adjacency& _adj) { _add (_cross, _node, _adj); }
+
+        void _add (_Edges& _e, const _Node& _node, const _Adjacency& _adj) { _e.push_back (std::make_pair (_node.vertex ().value (), _adj.node ().vertex ().value ())); }
+
+        _Edges _tree;
+        _Edges _back;
+        _Edges _forward;
+        _Edges _cross;
+        size_t _roots;
+        size_t _examined;
+      };
+
+  public:
+    void setUp () { }
+    void tearDown () { }
+
+  private:
+    /* a random graph of _n vertices and _m edges per vertex */
+    void _build (dgraph& g, const int& _n, const int& _m)
+    {
+      std::vector<dgraph::iterator> its;
+
+      for (int i = 0; i < _n; i++)
+        its.push_back (g.insert_vertex (i));
+
+      srand (1);
+      for (int i = 0; i < _n; i++)
+        for (int j = 0; j < _m; j++)
+          g.insert_edge (j, its [i], its [rand () % _n]);
+    }
+
+    /* the nodes of a visitor and of a local iterator, with their parents, in the same order */
+    template<typename _TpIterator>
+      void _compare (const _Recorder<dgraph>& _r, _TpIterator it, const _TpIterator& _end)
+      {
+        size_t i = 0;
+
+        for (; it != _end; ++it, ++i)
+        {
+          TS_ASSERT (i < _r._nodes.size ());
+
+          if (i >= _r._nodes.size ())
+            return;
+
+          TS_ASSERT_EQUALS (_r._nodes [i], &(*it));
+          TS_ASSERT_EQUALS (_r._parents [i], it.info (*it)->parent ());
+        }
+
+        TS_ASSERT_EQUALS (i, _r._nodes.size ());
+        TS_ASSERT_EQUALS (_r._finished.size (), _r._nodes.size ());
+      }
+
+  public:
+    void test_basic ()
+    {
+      mygraph g;
+
+      g.insert_vertex (1);
+      g.insert_vertex (2);
+      g.insert_vertex (3);
+      g.insert_vertex (4);
+      g.insert_vertex (5);
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 1, 3);
+      g.insert_edge (30, 2, 4);
+      g.insert_edge (40, 3, 4);
+
+      _Recorder<mygraph> b;
+      TS_ASSERT_EQUALS (cgt::search::breadth_first (g, *g.get_node (1), b), 4);
+      TS_ASSERT_EQUALS (b._nodes.size (), 4);
+      TS_ASSERT_EQUALS (b._nodes [0], g.get_node (1));
+      TS_ASSERT_EQUALS (b._parents [0], static_cast<const mygraph::node*>(NULL));
+      TS_ASSERT_EQUALS (b._nodes [1], g.get_node (2));
+      TS_ASSERT_EQUALS (b._nodes [2], g.get_node (3));
+      TS_ASSERT_EQUALS (b._nodes [3], g.get_node (4));
+      TS_ASSERT_EQUALS (b._parents [3], g.get_node (2));
+      TS_ASSERT_EQUALS (b._edges, 4);
+      TS_ASSERT_EQUALS (b._finished.size (), 4);
+
+      _Recorder<mygraph> d;
+      TS_ASSERT_EQUALS (cgt::search::depth_first (g, *g.get_node (1), d), 4);
+      TS_ASSERT_EQUALS (d._nodes [1], g.get_node (2));
+      TS_ASSERT_EQUALS (d._nodes [2], g.get_node (4));
+      TS_ASSERT_EQUALS (d._nodes [3], g.get_node (3));
+      TS_ASSERT_EQUALS (d._edges, 4);
+
+      /* 4 is finished first, 1 last */
+      TS_ASSERT_EQUALS (d._finished.front (), g.get_node (4));
+      TS_ASSERT_EQUALS (d._finished.back (), g.get_node (1));
+    }
+
+    void test_iterator_order ()
+    {
+      dgraph g;
+      _build (g, 3000, 2);
+
+      dgraph::visit_workspace vws;
+      dgraph::search_workspace ws;
+
+      for (int k = 0; k < 5; k++)
+      {
+        dgraph::iterator itSource = g.find (k * 100);
+
+        _Recorder<dgraph> b;
+        cgt::search::breadth_first (g, *itSource, b, vws);
+        _compare (b, g.bbegin (itSource, ws), g.bend ());
+
+        _Recorder<dgraph> d;
+        cgt::search::depth_first (g, *itSource, d, vws);
+        _compare (d, g.dbegin (itSource, ws), g.dend ());
+
+        /* each node discovered has all its adjacencies examined */
+        size_t _edges = 0;
+
+        for (size_t i = 0; i < d._nodes.size (); i++)
+          _edges += d._nodes [i]->adjlist ().size ();
+
+        TS_ASSERT_EQUALS (d._edges, _edges);
+        TS_ASSERT_EQUALS (b._edges, _edges);
+      }
+    }
+
+    void test_done ()
+    {
+      dgraph g;
+      _build (g, 3000, 2);
+
+      _Recorder<dgraph> b;
+      b._limit = 10;
+      TS_ASSERT_EQUALS (cgt::search::breadth_first (g, g.get_node_by_id (0), b), 10);
+      TS_ASSERT_EQUALS (b._nodes.size (), 10);
+
+      _Recorder<dgraph> d;
+      d._limit = 10;
+      TS_ASSERT_EQUALS (cgt::search::depth_first (g, g.get_node_by_id (0), d), 10);
+      TS_ASSERT_EQUALS (d._nodes.size (), 10);
+    }
+
+    void test_counter ()
+    {
+      dgraph g;
+      _build (g, 3000, 2);
+
+      dgraph::visit_workspace vws;
+      dgraph::search_workspace ws;
+
+      _EvenCounter c;
+      size_t _reached = cgt::search::breadth_first (g, g.get_node_by_id (0), c, vws);
+
+      size_t _count = 0;
+      size_t _n = 0;
+
+      for (dgraph::biterator it = g.bbegin (g.find (0), ws); it != g.bend (); ++it, ++_n)
+        if (it->vertex ().value () % 2 == 0)
+          _count++;
+
+      TS_ASSERT_EQUALS (_reached, _n);
+      TS_ASSERT_EQUALS (c._count, _count);
+
+      /* the workspace starts over */
+      _EvenCounter c2;
+      TS_ASSERT_EQUALS (cgt::search::depth_first (g, g.get_node_by_id (0), c2, vws), _n);
+      TS_ASSERT_EQUALS (c2._count, _count);
+    }
+
+    void test_edge_classes ()
+    {
+      mygraph g;
+
+      g.insert_vertex (1);
+      g.insert_vertex (2);
+      g.insert_vertex (3);
+      g.insert_vertex (4);
+      g.insert_vertex (5);
+
+      g.insert_edge (10, 1, 2);
+      g.insert_edge (20, 1, 3);
+      g.insert_edge (30, 2, 3);
+      g.insert_edge (40, 3, 1);
+      g.insert_edge (50, 4, 3);
+      g.insert_edge (60, 4, 5);
+      g.insert_edge (70, 5, 5);
+
+      /* from 1: 1 -> 2 -> 3 are tree edges, 3 -> 1 goes back, and 1 -> 3 forward */
+
+      _Classifier<mygraph> c;
+      TS_ASSERT_EQUALS (cgt::search::depth_first (g, *g.get_node (1), c), 3);
+      TS_ASSERT_EQUALS (c._tree.size (), 2);
+      TS_ASSERT_EQUALS (c._tree [0], std::make_pair (1, 2));
+      TS_ASSERT_EQUALS (c._tree [1], std::make_pair (2, 3));
+      TS_ASSERT_EQUALS (c._back.size (), 1);
+      TS_ASSERT_EQUALS (c._back [0], std::make_pair (3, 1));
+      TS_ASSERT_EQUALS (c._forward.size (), 1);
+      TS_ASSERT_EQUALS (c._forward [0], std::make_pair (1, 3));
+      TS_ASSERT_EQUALS (c._cross.size (), 0);
+
+      /* the forest goes on from 4: 4 -> 3 crosses to the first tree, and 5 -> 5 goes back */
+
+      _Classifier<mygraph> f;
+      TS_ASSERT_EQUALS (cgt::search::depth_first_forest (g, f), 5);
+      TS_ASSERT_EQUALS (f._roots, 2);
+      TS_ASSERT_EQUALS (f._tree.size (), 3);
+      TS_ASSERT_EQUALS (f._tree [2], std::make_pair (4, 5));
+      TS_ASSERT_EQUALS (f._back.size (), 2);
+      TS_ASSERT_EQUALS (f._back [1], std::make_pair (5, 5));
+      TS_ASSERT_EQUALS (f._forward.size (), 1);
+      TS_ASSERT_EQUALS (f._cross.size (), 1);
+      TS_ASSERT_EQUALS (f._cross [0], std::make_pair (4, 3));
+      TS_ASSERT_EQUALS (f._examined, 7);
+    }
+
+    void test_edge_classes_random ()
+    {
+      /* each edge has a class, and there's a tree edge for each node that isn't a root */
+
+      dgraph g;
+      _build (g, 3000, 3);
+
+      dgraph::visit_workspace vws;
+      size_t _edges = 0;
+
+      for (dgraph::iterator it = g.begin (); it != g.end (); ++it)
+        _edges += it->adjlist ().size ();
+
+      for (int k = 0; k < 2; k++)
+      {
+        _Classifier<dgraph> c;
+        TS_ASSERT_EQUALS (cgt::search::depth_first_forest (g, c, vws), 3000);
+        TS_ASSERT_EQUALS (c._examined, _edges);
+        TS_ASSERT_EQUALS (c._tree.size () + c._back.size () + c._forward.size () + c._cross.size (), c._examined);
+        TS_ASSERT_EQUALS (c._tree.size () + c._roots, 3000);
+        TS_ASSERT (c._back.size () > 0);
+      }
+    }
+
+    void test_has_cycle ()
+    {
+      dgraph g;
+      std::vector<dgraph::iterator> its;
+
+      for (int i = 0; i < 6; i++)
+        its.push_back (g.insert_vertex (i));
+
+      /* a DAG: every node points to the ones after it */
+
+      for (int i = 0; i < 6; i++)
+        for (int j = i + 1; j < 6; j++)
+          g.insert_edge (i, its [i], its [j]);
+
+      TS_ASSERT (! cgt::search::has_cycle (g));
+
+      g.insert_edge (10, its [5], its [2]);
+      TS_ASSERT (cgt::search::has_cycle (g));
+
+      dgraph h;
+      dgraph::iterator it = h.insert_vertex (1);
+      h.insert_vertex (2);
+      TS_ASSERT (! cgt::search::has_cycle (h));
+
+      h.insert_edge (1, it, it);
+      TS_ASSERT (cgt::search::has_cycle (h));
+    }
+
+    void test_has_cycle_undirected ()
+    {
+      ugraph g;
+      std::vector<ugraph::iterator> its;
+
+      for (int i = 0; i < 7; i++)
+        its.push_back (g.insert_vertex (i));
+
+      /* a forest: a binary tree of 0 to 5, and 6 alone */
+
+      for (int i = 1; i < 6; i++)
+        g.insert_edge (i, its [(i - 1) / 2], its [i]);
+
+      TS_ASSERT (! cgt::search::has_cycle (g));
+
+      g.insert_edge (10, its [3], its [4]);
+      TS_ASSERT (cgt::search::has_cycle (g));
+
+      ugraph h;
+      ugraph::iterator it = h.insert_vertex (1);
+      ugraph::iterator it2 = h.insert_vertex (2);
+      h.insert_edge (1, it, it2);
+      TS_ASSERT (! cgt::search::has_cycle (h));
+
+      h.insert_edge (2, it, it);
+      TS_ASSERT (cgt::search::has_cycle (h));
+    }
+
+    void test_long_chain ()
+    {
+      /* a path of 1000000 nodes, and an edge from its end to its beginning: no recursion */
+
+      const int _n = 1000000;
+      dgraph g;
+      dgraph::iterator itFirst = g.insert_vertex (0);
+      dgraph::iterator itPrev = itFirst;
+
+      for (int i = 1; i < _n; i++)
+      {
+        dgraph::iterator itV = g.insert_vertex (i);
+        g.insert_edge (i, itPrev, itV);
+        itPrev = itV;
+      }
+
+      TS_ASSERT (! cgt::search::has_cycle (g));
+
+      g.insert_edge (0, itPrev, itFirst);
+
+      _Classifier<dgraph> c;
+      TS_ASSERT_EQUALS (cgt::search::depth_first (g, *itFirst, c), _n);
+      TS_ASSERT_EQUALS (c._tree.size (), _n - 1);
+      TS_ASSERT_EQUALS (c._back.size (), 1);
+      TS_ASSERT (cgt::search::has_cycle (g));
+    }
+};
+
+#endif // __CGTL__CXXTEST_CGT_SEARCH__SEARCH_VISITOR_CXX_H_
@@ -0,0 +1,298 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/shortpath/single/astar/test_astar.cc
+ * \brief Functional tests for the A* iterator.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "cgt/graph.h"
+
+
+typedef cgt::graph<int, int>                      DGraph;
+typedef cgt::graph<int, int, cgt::_Undirected>    UGraph;
+
+/* no estimate: the search is Dijkstra's */
+class Zero
+{
+	public:
+		int operator()(const int& v) const { return 0; }
+};
+
+/* the manhattan distance to a target in a grid with <side> columns, times the lowest edge value */
+class Manhattan
+{
+	public:
+		Manhattan (const int& side, const int& target, const int& unit) : mSide (side), mTarget (target), mUnit (unit) { }
+
+	public:
+		int operator()(const int& v) const
+		{
+			int dr = v / mSide - mTarget / mSide;
+			int dc = v % mSide - mTarget % mSide;
+
+			return mUnit * ((dr < 0 ? -dr : dr) + (dc < 0 ? -dc : dc));
+		}
+
+	private:
+		int mSide;
+		int mTarget;
+		int mUnit;
+};
+
+/* the exact distances to the target for odd vertices, 0 for even ones: admissible, but not consistent */
+class Uneven
+{
+	public:
+		Uneven (const std::vector<int>& dist) : mDist (&dist) { }
+
+	public:
+		int operator()(const int& v) const { return (v % 2 ? (*mDist) [v] : 0); }
+
+	private:
+		const std::vector<int>* mDist;
+};
+
+/* a random graph of n vertices and m edges per vertex, with values from 1 to 20 */
+template<typename _TpGraph>
+	void build (_TpGraph& g, const int& n, const int& m)
+	{
+		std::vector<typename _TpGraph::iterator> its;
+
+		for (int i = 0; i < n; i++)
+			its.push_back (g.insert_vertex (i));
+
+		srand (1);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < m; j++)
+				g.insert_edge (1 + rand () % 20, its [i], its [rand () % n]);
+	}
+
+/* a grid of side x side vertices, with edges to the right and bottom neighbours, with values from 10 to 29 */
+void build_grid (UGraph& g, const int& side)
+{
+	std::vector<UGraph::iterator> its;
+
+	for (int i = 0; i < side * side; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (2);
+	for (int r = 0; r < side; r++)
+	{
+		for (int c = 0; c < side; c++)
+		{
+			if (c + 1 < side)
+				g.insert_edge (10 + rand () % 20, its [r * side + c], its [r * side + c + 1]);
+
+			if (r + 1 < side)
+				g.insert_edge (10 + rand () % 20, its [r * side + c], its [(r + 1) * side + c]);
+		}
+	}
+}
+
+/* the distances from the node with id s, by the dijkstra iterator (-1 if it's not reachable) */
+template<typename _TpGraph>
+	std::vector<int> distances (_TpGraph& g, const int& s)
+	{
+		std::vector<int> dist (g.num_vertices (), -1);
+		typename _TpGraph::djiterator it = g.djbegin (g.find (s));
+
+		for (; it != g.djend (); ++it)
+			dist [it->value ()] = it.info (*it)->distance ();
+
+		return dist;
+	}
+
+/* the sum of the edges from the target back to the source, following the previous nodes */
+template<typename _TpGraph, typename _TpIterator>
+	int length (_TpIterator& it, const typename _TpGraph::node& source, const typename _TpGraph::node& target)
+	{
+		int total = 0;
+		const typename _TpGraph::node* ptr = &target;
+
+		while (ptr != &source)
+		{
+			const typename _TpGraph::node* prev = it.info (ptr)->previous ();
+			EXPECT_TRUE(prev != NULL);
+
+			if (! prev)
+				break;
+
+			total += prev->get_edge (*ptr)->value ();
+			ptr = prev;
+		}
+
+		return total;
+	}
+
+TEST(AStar, Basic) {
+	DGraph g;
+	DGraph::iterator v1 = g.insert_vertex(1);
+	DGraph::iterator v2 = g.insert_vertex(2);
+	DGraph::iterator v3 = g.insert_vertex(3);
+	DGraph::iterator v4 = g.insert_vertex(4);
+	DGraph::iterator v5 = g.insert_vertex(5);
+
+	g.insert_edge(2, v1, v2);
+	g.insert_edge(1, v1, v3);
+	g.insert_edge(10, v2, v4);
+	g.insert_edge(5, v3, v4);
+
+	DGraph::astar<Zero>::iterator it = g.asbegin (v1, Zero ());
+
+	EXPECT_EQ(&(*v1), &(*it));
+	EXPECT_EQ(0, it.info (*v1)->distance ());
+	EXPECT_TRUE(it.info (*v1)->previous () == NULL);
+
+	/* 5 has no edges to it, so it's never reached */
+	std::vector<int> order;
+
+	for (; it != g.asend<Zero> (); ++it)
+		order.push_back (it->value ());
+
+	ASSERT_EQ(4u, order.size ());
+	EXPECT_EQ(1, order [0]);
+	EXPECT_EQ(3, order [1]);
+	EXPECT_EQ(2, order [2]);
+	EXPECT_EQ(4, order [3]);
+
+	EXPECT_TRUE(it.info (*v5) == NULL);
+	EXPECT_EQ(6, it.info (*v4)->distance ());
+	EXPECT_EQ(&(*v3), it.info (*v4)->previous ());
+	EXPECT_EQ(4u, it.reached ());
+}
+
+TEST(AStar, ZeroIsDijkstra) {
+	/* with no estimate, all reachable nodes come out with the distances of the dijkstra iterator */
+
+	DGraph g;
+	build (g, 500, 3);
+
+	for (int s = 0; s < 500; s += 97)
+	{
+		std::vector<int> dist = distances (g, s);
+		DGraph::astar<Zero>::iterator it = g.asbegin (g.find (s), Zero ());
+		int last = 0;
+		size_t count = 0;
+
+		for (; it != g.asend<Zero> (); ++it)
+		{
+			EXPECT_EQ(dist [it->value ()], it.info (*it)->distance ());
+			EXPECT_LE(last, it.info (*it)->distance ());
+			last = it.info (*it)->distance ();
+			count++;
+		}
+
+		size_t reachable = 0;
+
+		for (size_t i = 0; i < dist.size (); i++)
+			if (dist [i] >= 0)
+				reachable++;
+
+		EXPECT_EQ(reachable, count);
+	}
+}
+
+TEST(AStar, Grid) {
+	/* the manhattan estimate takes the target with its shortest distance, and few other nodes */
+
+	const int side = 60;
+	UGraph g;
+	build_grid (g, side);
+
+	const int pairs [][2] = { { 0, side * side - 1 }, { side - 1, side * (side - 1) }, { 5 * side + 7, 40 * side + 50 }, { 30 * side + 30, 31 * side + 35 } };
+
+	for (size_t k = 0; k < sizeof (pairs) / sizeof (pairs [0]); k++)
+	{
+		int s = pairs [k][0];
+		int t = pairs [k][1];
+		std::vector<int> dist = distances (g, s);
+		const UGraph::node& source = *g.find (s);
+		const UGraph::node& target = *g.find (t);
+
+		/* the nodes the dijkstra iterator takes before the target */
+		size_t closer = 0;
+
+		for (size_t i = 0; i < dist.size (); i++)
+			if (dist [i] < dist [t])
+				closer++;
+
+		Manhattan h (side, t, 10);
+		UGraph::astar<Manhattan>::iterator it = g.asbegin (g.find (s), h);
+		size_t taken = 1;
+
+		while (&(*it) != &target)
+		{
+			++it;
+			taken++;
+		}
+
+		EXPECT_EQ(dist [t], it.info (target)->distance ());
+		EXPECT_EQ(dist [t], (length<UGraph> (it, source, target)));
+		EXPECT_LT(taken, closer);
+	}
+}
+
+TEST(AStar, Inconsistent) {
+	/* an admissible estimate that isn't consistent: nodes may come out again, the target with its shortest distance */
+
+	UGraph g;
+	build (g, 500, 2);
+
+	for (int t = 0; t < 500; t += 61)
+	{
+		std::vector<int> toTarget = distances (g, t);
+
+		for (int s = 3; s < 500; s += 53)
+		{
+			if (toTarget [s] < 0)
+				continue;
+
+			Uneven h (toTarget);
+			UGraph::astar<Uneven>::iterator it = g.asbegin (g.find (s), h);
+			const UGraph::node& target = *g.find (t);
+
+			while (it != g.asend<Uneven> () && &(*it) != &target)
+				++it;
+
+			ASSERT_TRUE(it != g.asend<Uneven> ());
+			EXPECT_EQ(toTarget [s], it.info (target)->distance ());
+			EXPECT_EQ(toTarget [s], (length<UGraph> (it, *g.find (s), target)));
+		}
+	}
+}
+
+int main (int argc, char* argv[])
+{
+	::testing::InitGoogleTest (&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,241 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/shortpath/single/deltastep/test_delta_stepping.cc
+ * \brief Functional tests for the parallel delta-stepping search.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "cgt/graph.h"
+
+
+typedef cgt::graph<int, int>                        DGraph;
+typedef cgt::graph<int, int, cgt::_Undirected>      UGraph;
+typedef cgt::graph<int, double>                     FGraph;
+
+/* a random graph of n vertices and m edges per vertex, with values from 0 to 99 */
+template<typename _TpGraph>
+	void build (_TpGraph& g, const int& n, const int& m)
+	{
+		std::vector<typename _TpGraph::iterator> its;
+
+		for (int i = 0; i < n; i++)
+			its.push_back (g.insert_vertex (i));
+
+		srand (1);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < m; j++)
+				g.insert_edge (rand () % 100, its [i], its [rand () % n]);
+	}
+
+/* the infos of the search are the ones of the dijkstra iterator, and the previous nodes form shortest paths */
+template<typename _TpGraph, typename _TpEdge>
+	void compare (_TpGraph& g, const size_t& threads, const _TpEdge& delta)
+	{
+		typename _TpGraph::deltastep ds = g.deltastep_init (threads, delta);
+		int n = g.num_vertices ();
+
+		EXPECT_EQ(threads, ds.num_threads ());
+
+		for (int s = 0; s < n; s += 101)
+		{
+			typename _TpGraph::iterator itSource = g.find (s);
+			typename _TpGraph::djiterator it = g.djbegin (itSource);
+			size_t reached = 0;
+
+			for (; it != g.djend (); ++it)
+				reached++;
+
+			ds.run (*itSource);
+			EXPECT_EQ(reached, ds.size ());
+
+			for (int v = 0; v < n; v++)
+			{
+				const typename _TpGraph::node& node = g.get_node_by_id (v);
+				const typename _TpGraph::dijkstra_info* expected = it.info (node);
+				typename _TpGraph::dijkstra_info info = ds.info (node);
+
+				ASSERT_EQ(expected->inf_distance (), info.inf_distance ());
+				EXPECT_EQ(! expected->inf_distance (), ds.reached (node));
+
+				if (info.inf_distance ())
+					continue;
+
+				EXPECT_EQ(expected->distance (), info.distance ());
+
+				if (&node == &(*itSource))
+					EXPECT_TRUE(info.previous () == NULL);
+				else
+				{
+					const typename _TpGraph::node* prev = info.previous ();
+					ASSERT_TRUE(prev != NULL);
+					ASSERT_TRUE(ds.reached (*prev));
+					EXPECT_EQ(info.distance (), ds.distance (*prev) + prev->get_edge (node)->value ());
+				}
+			}
+		}
+	}
+
+TEST(DeltaStepping, Basic) {
+	DGraph g;
+	DGraph::iterator v1 = g.insert_vertex(1);
+	DGraph::iterator v2 = g.insert_vertex(2);
+	DGraph::iterator v3 = g.insert_vertex(3);
+	DGraph::iterator v4 = g.insert_vertex(4);
+	DGraph::iterator v5 = g.insert_vertex(5);
+
+	g.insert_edge(2, v1, v2);
+	g.insert_edge(1, v1, v3);
+	g.insert_edge(10, v2, v4);
+	g.insert_edge(5, v3, v4);
+
+	DGraph::deltastep ds = g.deltastep_init (2, 3);
+	EXPECT_EQ(3, ds.delta ());
+
+	ds.run (*v1);
+	EXPECT_EQ(4u, ds.size ());
+	EXPECT_EQ(6, ds.distance (*v4));
+	EXPECT_EQ(&(*v3), ds.previous (*v4));
+	EXPECT_TRUE(ds.previous (*v1) == NULL);
+	EXPECT_FALSE(ds.reached (*v5));
+	EXPECT_TRUE(ds.info (*v5).inf_distance ());
+
+	/* runs again from another node */
+	ds.run (*v2);
+	EXPECT_EQ(2u, ds.size ());
+	EXPECT_EQ(10, ds.distance (*v4));
+	EXPECT_FALSE(ds.reached (*v1));
+}
+
+TEST(DeltaStepping, DefaultDelta) {
+	/* the greatest edge value over the average number of edges of a node: 30 / 2 */
+
+	DGraph g;
+	DGraph::iterator v1 = g.insert_vertex(1);
+	DGraph::iterator v2 = g.insert_vertex(2);
+	DGraph::iterator v3 = g.insert_vertex(3);
+
+	g.insert_edge(30, v1, v2);
+	g.insert_edge(4, v1, v3);
+	g.insert_edge(5, v2, v1);
+	g.insert_edge(6, v2, v3);
+	g.insert_edge(7, v3, v1);
+	g.insert_edge(8, v3, v2);
+
+	DGraph::deltastep ds = g.deltastep_init (1);
+	EXPECT_EQ(15, ds.delta ());
+	EXPECT_EQ(1u, ds.num_threads ());
+
+	ds.run (*v1);
+	EXPECT_EQ(12, ds.distance (*v2));
+
+	/* all cores of the machine */
+	EXPECT_LT(0u, g.deltastep_init ().num_threads ());
+}
+
+TEST(DeltaStepping, Threads) {
+	DGraph g;
+	build (g, 2000, 4);
+
+	compare (g, 1, 20);
+	compare (g, 2, 20);
+	compare (g, 4, 20);
+}
+
+TEST(DeltaStepping, Delta) {
+	/* from Dijkstra's (delta 1) to Bellman-Ford's (delta beyond all edges) */
+
+	DGraph g;
+	build (g, 2000, 4);
+
+	compare (g, 3, 1);
+	compare (g, 3, 7);
+	compare (g, 3, 1000);
+}
+
+TEST(DeltaStepping, LongEdges) {
+	/* edges far longer than delta: the buckets beyond the ring wait in the overflow lists */
+
+	DGraph h;
+	DGraph::iterator v1 = h.insert_vertex(1);
+	DGraph::iterator v2 = h.insert_vertex(2);
+	h.insert_edge(20000000, v1, v2);
+
+	DGraph::deltastep ds = h.deltastep_init (1, 1);
+	ds.run (*v1);
+	EXPECT_EQ(20000000, ds.distance (*v2));
+	EXPECT_EQ(&(*v1), ds.previous (*v2));
+
+	DGraph g;
+	std::vector<DGraph::iterator> its;
+
+	for (int i = 0; i < 500; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (3);
+	for (int i = 0; i < 500; i++)
+		for (int j = 0; j < 4; j++)
+			g.insert_edge (rand () % 100000, its [i], its [rand () % 500]);
+
+	compare (g, 1, 40);
+	compare (g, 4, 40);
+	compare (g, 3, 700);
+}
+
+TEST(DeltaStepping, Undirected) {
+	UGraph g;
+	build (g, 2000, 2);
+
+	compare (g, 4, 25);
+}
+
+TEST(DeltaStepping, Double) {
+	FGraph g;
+	std::vector<FGraph::iterator> its;
+
+	for (int i = 0; i < 1000; i++)
+		its.push_back (g.insert_vertex (i));
+
+	srand (2);
+	for (int i = 0; i < 1000; i++)
+		for (int j = 0; j < 4; j++)
+			g.insert_edge ((rand () % 1000) / 8.0, its [i], its [rand () % 1000]);
+
+	compare (g, 4, 12.5);
+	compare (g, 2, 0.0);
+}
+
+int main (int argc, char* argv[])
+{
+	::testing::InitGoogleTest (&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,264 @@
+/*
+ * CGTL - A graph template library for C++
+ * ---------------------------------------
+ * Copyright (C) 2009 Leandro Costa
+ *
+ * This file is part of CGTL.
+ *
+ * CGTL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * CGTL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with CGTL. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file tests/cgt/shortpath/single/dijkstra/test_dijkstra_path.cc
+ * \brief Functional tests for the point-to-point dijkstra search.
+ * \author Leandro Costa
+ * \date 2011
+ *
+ * $LastChangedDate$
+ * $LastChangedBy$
+ * $Revision$
+ */
+
+
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "cgt/graph.h"
+
+
+typedef cgt::graph<int, int>                                                            DGraph;
+typedef cgt::graph<int, int, cgt::_Undirected>                                          UGraph;
+typedef cgt::graph<int, int, cgt::_DirectedNoInverse>                                   NGraph;
+
+/* a random graph of n vertices and m edges per vertex, with values from 1 to 20 */
+template<typename _TpGraph>
+	void build (_TpGraph& g, const int& n, const int& m)
+	{
+		std::vector<typename _TpGraph::iterator> its;
+
+		for (int i = 0; i < n; i++)
+			its.push_back (g.insert_vertex (i));
+
+		srand (1);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < m; j++)
+				g.insert_edge (1 + rand () % 20, its [i], its [rand () % n]);
+	}
+
+/* the sum of the edges of the path found by p, that must go from source to target */
+template<typename _TpGraph>
+	int length (const typename _TpGraph::djpath& p, const typename _TpGraph::node& source, const typename _TpGraph::node& target)
+	{
+		int total = 0;
+
+		EXPECT_EQ(&source, p.path ().front ());
+		EXPECT_EQ(&target, p.path ().back ());
+
+		for (size_t i = 0; i + 1 < p.path ().size (); i++)
+		{
+			const typename _TpGraph::edge* e = p.path () [i]->get_edge (*(p.path () [i + 1]));
+			EXPECT_TRUE(e != NULL);
+			total += (e ? e->value () : 0);
+		}
+
+		return total;
+	}
+
+/* distances found by both searches are the ones of the dijkstra iterator */
+template<typename _TpGraph>
+	void compare (_TpGraph& g)
+	{
+		typename _TpGraph::djpath p = g.djpath_init ();
+		int n = g.num_vertices ();
+
+		for (int k = 0; k < 10; k++)
+		{
+			typename _TpGraph::iterator itSource = g.find ((k * 37) % n);
+			typename _TpGraph::djiterator itd = g.djbegin (itSource);
+
+			while (itd != g.djend ())
+				++itd;
+
+			for (int t = 0; t < n; t += 7)
+			{
+				const typename _TpGraph::node& target = g.get_node_by_id (t);
+				const typename _TpGraph::dijkstra_info* info = itd.info (target);
+
+				bool found = p.run (*itSource, target);
+				EXPECT_EQ(! info->inf_distance (), found);
+
+				if (found)
+				{
+					EXPECT_EQ(info->distance (), p.distance ());
+					EXPECT_EQ(p.distance (), length<_TpGraph> (p, *itSource, target));
+				}
+
+				found = p.run_bidirectional (*itSource, target);
+				EXPECT_EQ(! info->inf_distance (), found);
+
+				if (found)
+				{
+					EXPECT_EQ(info->distance (), p.distance ());
+					EXPECT_EQ(p.distance (), length<_TpGraph> (p, *itSource, target));
+				}
+			}
+		}
+	}
+
+TEST(DijkstraPath, Basic) {
+	DGraph g;
+	DGraph::iterator v1 = g.insert_vertex(1);
+	DGraph::iterator v2 = g.insert_vertex(2);
+	DGraph::iterator v3 = g.insert_vertex(3);
+	DGraph::iterator v4 = g.insert_vertex(4);
+	DGraph::iterator v5 = g.insert_vertex(5);
+
+	g.insert_edge(2, v1, v2);
+	g.insert_edge(1, v1, v3);
+	g.insert_edge(10, v2, v4);
+	g.insert_edge(5, v3, v4);
+
+	DGraph::djpath p = g.djpath_init ();
+
+	EXPECT_TRUE(p.run (*v1, *v4));
+	EXPECT_EQ(6, p.distance ());
+	ASSERT_EQ(3u, p.path ().size ());
+	EXPECT_EQ(&(*v3), p.path () [1]);
+
+	EXPECT_TRUE(p.run_bidirectional (*v1, *v4));
+	EXPECT_EQ(6, p.distance ());
+	ASSERT_EQ(3u, p.path ().size ());
+	EXPECT_EQ(&(*v1), p.path () [0]);
+	EXPECT_EQ(&(*v3), p.path () [1]);
+	EXPECT_EQ(&(*v4), p.path () [2]);
+
+	/* the edges are directed, and 5 has none */
+	EXPECT_FALSE(p.run (*v4, *v1));
+	EXPECT_FALSE(p.run_bidirectional (*v4, *v1));
+	EXPECT_TRUE(p.path ().empty ());
+	EXPECT_FALSE(p.run_bidirectional (*v1, *v5));
+
+	EXPECT_TRUE(p.run_bidirectional (*v2, *v2));
+	EXPECT_EQ(0, p.distance ());
+	EXPECT_EQ(1u, p.path ().size ());
+
+	int distance = -1;
+	cgt::base::array<const DGraph::node*> path;
+	EXPECT_TRUE(cgt::shortpath::single::dijkstra::shortest_path (g, *v1, *v4, distance, path));
+	EXPECT_EQ(6, distance);
+	EXPECT_EQ(3u, path.size ());
+}
+
+TEST(DijkstraPath, StopsAtTarget) {
+	/* a path 0 - 1 - ... - 999: the search from 0 to 10 takes 11 nodes */
+
+	UGraph g;
+	UGraph::iterator itPrev = g.insert_vertex (0);
+
+	for (int i = 1; i < 1000; i++)
+	{
+		UGraph::iterator itV = g.insert_vertex (i);
+		g.insert_edge (1, itPrev, itV);
+		itPrev = itV;
+	}
+
+	UGraph::djpath p = g.djpath_init ();
+
+	EXPECT_TRUE(p.run (*g.find (0), *g.find (10)));
+	EXPECT_EQ(10, p.distance ());
+	EXPECT_EQ(11u, p.settled ());
+
+	/* both sides meet in the middle: each one takes the nodes up to 10 away, in both directions */
+	EXPECT_TRUE(p.run_bidirectional (*g.find (500), *g.find (520)));
+	EXPECT_EQ(20, p.distance ());
+	EXPECT_EQ(21u, p.path ().size ());
+	EXPECT_LE(p.settled (), 2u * 21u);
+}
+
+TEST(DijkstraPath, Directed) {
+	DGraph g;
+	build (g, 500, 3);
+	compare (g);
+}
+
+TEST(DijkstraPath, Undirected) {
+	UGraph g;
+	build (g, 500, 2);
+	compare (g);
+}
+
+TEST(DijkstraPath, NoInverse) {
+	/* without inverted lists, the bidirectional search runs from the source only */
+	NGraph g;
+	build (g, 500, 3);
+	compare (g);
+}
+
+/* the same graph with unsigned edges (kept in a radix heap or in Dial's buckets, see _DijkstraQueue) */
+template<typename _TpEdge>
+	void compare_unsigned (const int& n, const int& m)
+	{
+		typedef cgt::graph<int, _TpEdge> UnsignedGraph;
+
+		DGraph g;
+		UnsignedGraph ug;
+		build (g, n, m);
+		build (ug, n, m);
+
+		typename UnsignedGraph::djpath p = ug.djpath_init ();
+
+		for (int s = 0; s < n; s += 37)
+		{
+			DGraph::djiterator it = g.djbegin (g.find (s));
+			typename UnsignedGraph::djiterator uit = ug.djbegin (ug.find (s));
+			_TpEdge last = 0;
+
+			while (it != g.djend ())
+				++it;
+
+			for (; uit != ug.djend (); ++uit)
+			{
+				_TpEdge d = uit.info (*uit)->distance ();
+				EXPECT_LE(last, d);
+				EXPECT_EQ(it.info (g.get_node_by_id (uit->id ()))->distance (), static_cast<int>(d));
+				last = d;
+			}
+
+			for (int t = 0; t < n; t += 11)
+			{
+				const DGraph::dijkstra_info* info = it.info (g.get_node_by_id (t));
+
+				EXPECT_EQ(! info->inf_distance (), p.run_bidirectional (ug.get_node_by_id (s), ug.get_node_by_id (t)));
+
+				if (p.found ())
+				{
+					EXPECT_EQ(info->distance (), static_cast<int>(p.distance ()));
+				}
+			}
+		}
+	}
+
+TEST(DijkstraPath, Unsigned) {
+	compare_unsigned<unsigned int> (500, 3);
+	compare_unsigned<unsigned long> (500, 3);
+	compare_unsigned<unsigned short> (500, 3);
+	compare_unsigned<unsigned char> (100, 3);
+}
+
+int main (int argc, char* argv[])
+{
+	::testing::InitGoogleTest (&argc, argv);
+	return RUN_ALL_TESTS();
+}